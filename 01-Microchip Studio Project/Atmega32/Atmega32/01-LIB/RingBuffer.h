@@ -0,0 +1,200 @@
+/**
+ * @file RingBuffer.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file is a header file that contains the single-producer/single-consumer (SPSC) ring buffer.
+ *         The buffer is lock-free on AVR: each index is a single byte owned by one side only
+ *         (head by the producer, tail by the consumer), so a load or a store of it is atomic
+ *         and no interrupt disabling is needed when one side runs in an ISR and the other in the super loop.
+ *
+ *         - the size must be a power of two (2,4,8,...,RINGBUF_MAX_SIZE) so wrapping is a single AND.
+ *         - the indices are free running, so (head-tail) is the number of stored bytes.
+ *         - bulk push/pop are all-or-nothing, so multi-byte records (events, LCD commands, trace records) are never torn.
+ *         - the regions (RingBuf_GetWriteRegion()/RingBuf_GetReadRegion()) give the storage itself to the producer or
+ *           the consumer, the bytes are not copied (framing, drivers).
+ *
+ * @par Example:
+ *   @code
+ *    RINGBUF_DEFINE(keypadQueue,8);       // static storage + descriptor, size checked at compile time
+ *
+ *    ISR(INT0_VECT)                       // producer
+ *    {
+ *        RingBuf_Push(&keypadQueue,key);
+ *    }
+ *
+ *    if (RingBuf_Pop(&keypadQueue,&key)==STD_OK)  // consumer (super loop)
+ *    {
+ *        // use key
+ *    }
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef RINGBUFFER_H_
+#define RINGBUFFER_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define RINGBUF_MAX_SIZE      128 /**< largest size that keeps (head-tail) unambiguous with 8-bit free running indices */
+
+/**
+ * @brief Checks at compile time that a ring buffer size is a power of two in the range [2,RINGBUF_MAX_SIZE].
+ */
+#define RINGBUF_IS_VALID_SIZE(size)   ( ((size)>=2) && ((size)<=RINGBUF_MAX_SIZE) && (((size)&((size)-1))==0) )
+
+/**
+ * @brief Defines a ring buffer with its static storage.
+ *
+ * The descriptor is initialized at compile time, so RingBuf_Init() is not needed for it.
+ * An invalid size stops the build with a negative array size error.
+ *
+ * @param name The name of the RingBuf_t object.
+ * @param size The size in bytes (power of two, max RINGBUF_MAX_SIZE).
+ */
+#define RINGBUF_DEFINE(name,size)                                                          \
+	typedef u8 name##_sizeMustBePowerOfTwo[(RINGBUF_IS_VALID_SIZE(size)) ? 1 : -1];       \
+	static u8 name##_storage[(size)];                                                      \
+	RingBuf_t name={ .buffer=name##_storage, .mask=(u8)((size)-1), .head=0, .tail=0 }
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef struct
+{
+	u8 *buffer;        /**< storage of the buffer */
+	u8 mask;           /**< size-1 , used to wrap the free running indices */
+	volatile u8 head;  /**< write index , written only by the producer */
+	volatile u8 tail;  /**< read index  , written only by the consumer */
+}RingBuf_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes a ring buffer on a user supplied storage.
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param storage Pointer to the storage array.
+ * @param size Size of the storage, must be a power of two in the range [2,RINGBUF_MAX_SIZE].
+ * @return STD_OK , STD_NULL_POINTER or STD_INVALID_ARG (size is not a valid power of two).
+ */
+Std_Error_t RingBuf_Init(RingBuf_t *rb, u8 storage[], u8 size);
+
+/**
+ * @brief Pushes one byte (producer side).
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param data The byte to push.
+ * @return STD_OK or STD_BUFFER_FULL.
+ */
+Std_Error_t RingBuf_Push(RingBuf_t *rb, u8 data);
+
+/**
+ * @brief Pops one byte (consumer side).
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param data Pointer to store the popped byte.
+ * @return STD_OK or STD_BUFFER_EMPTY.
+ */
+Std_Error_t RingBuf_Pop(RingBuf_t *rb, u8 *data);
+
+/**
+ * @brief Reads a byte without removing it (consumer side).
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param offset Offset from the oldest byte (0 is the next byte RingBuf_Pop() returns).
+ * @param data Pointer to store the byte.
+ * @return STD_OK or STD_BUFFER_EMPTY (less than offset+1 bytes are stored).
+ */
+Std_Error_t RingBuf_Peek(const RingBuf_t *rb, u8 offset, u8 *data);
+
+/**
+ * @brief Pushes len bytes at once (producer side).
+ *
+ * All bytes are published to the consumer together, nothing is pushed if they don't fit.
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param data The bytes to push.
+ * @param len Number of bytes.
+ * @return STD_OK or STD_BUFFER_FULL.
+ */
+Std_Error_t RingBuf_PushBulk(RingBuf_t *rb, const u8 data[], u8 len);
+
+/**
+ * @brief Pops len bytes at once (consumer side).
+ *
+ * Nothing is popped if less than len bytes are stored.
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param data Array to store the popped bytes.
+ * @param len Number of bytes.
+ * @return STD_OK or STD_BUFFER_EMPTY.
+ */
+Std_Error_t RingBuf_PopBulk(RingBuf_t *rb, u8 data[], u8 len);
+
+/**
+ * @brief Returns the contiguous free bytes at the head (producer side, zero-copy): the producer writes them in place
+ *        then publishes them with RingBuf_CommitWrite().
+ *
+ * The region ends at the end of the storage, a wrapped write takes two regions.
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param region Pointer to store the address of the region.
+ * @return The length of the region (0: the buffer is full).
+ */
+u8 RingBuf_GetWriteRegion(const RingBuf_t *rb, u8 **region);
+
+/**
+ * @brief Publishes len bytes written in the region of RingBuf_GetWriteRegion() (producer side).
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param len Number of bytes, at most the length of the region.
+ */
+void RingBuf_CommitWrite(RingBuf_t *rb, u8 len);
+
+/**
+ * @brief Returns the contiguous stored bytes at the tail (consumer side, zero-copy): the consumer reads them in place
+ *        then releases them with RingBuf_Release().
+ *
+ * The region ends at the end of the storage, the wrapped bytes are the next region.
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param region Pointer to store the address of the region.
+ * @return The length of the region (0: the buffer is empty).
+ */
+u8 RingBuf_GetReadRegion(const RingBuf_t *rb, const u8 **region);
+
+/**
+ * @brief Releases len bytes read in the region of RingBuf_GetReadRegion() (consumer side).
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param len Number of bytes, at most the length of the region.
+ */
+void RingBuf_Release(RingBuf_t *rb, u8 len);
+
+/**
+ * @brief Returns the number of stored bytes.
+ */
+u8 RingBuf_Count(const RingBuf_t *rb);
+
+/**
+ * @brief Returns the number of free bytes.
+ */
+u8 RingBuf_Free(const RingBuf_t *rb);
+
+/**
+ * @brief Drops all stored bytes (consumer side).
+ */
+void RingBuf_Flush(RingBuf_t *rb);
+
+#endif /* RINGBUFFER_H_ */
@@ -94,6 +94,15 @@ typedef enum{
  */
 void Dio_Init(void);
 
+/**
+ * @brief Disables the JTAG interface so that PC2..PC5 (TCK, TMS, TDO, TDI) are DIO pins (JTD of MCUCSR, written twice
+ *        within 4 cycles), to be called before Dio_Init(). The JTAGEN fuse is then left as it is.
+ *
+ * @param None
+ * @return None
+ */
+void Dio_DisableJtag(void);
+
 /**
  * @brief Reads the voltage level of a specific pin.
  *
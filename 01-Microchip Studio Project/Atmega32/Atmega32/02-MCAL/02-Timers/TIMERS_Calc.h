@@ -0,0 +1,103 @@
+/**
+ * @file TIMERS_Calc.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the compile-time timer period calculator.
+ *         From the timer clock (F_CPU), a period in microseconds and the timer width it selects the smallest
+ *         prescaler that generates the period EXACTLY (a whole number of timer counts that fits the timer),
+ *         then gives the compare value (CTC TOP) or the reload value (normal mode).
+ *
+ *         - The macros are integer constant expressions: they can be used in #if (to emit #error)
+ *           and they are folded by the compiler (no runtime arithmetic).
+ *         - The results are 64-bit constants, cast them to the register type (u8 / u16) in C code.
+ *         - The timer clock is a parameter so the asynchronous TIMER2 clock (32768Hz) can be used too.
+ *
+ * @par Example:
+ *   @code
+ *    #define TICK_US   1000UL
+ *    #if (TIMER_CALC_DIV(F_CPU,TICK_US,8)==0)
+ *    #error "TICK_US can't be generated exactly by TIMER0"
+ *    #endif
+ *    TIMER0_SetCompareValue(TIMER_CALC_TOP(F_CPU,TICK_US,8));          // 124 at 8MHz
+ *    TIMER0_Init(TIMER0_CTC_OCRN_TOP,TIMER_OCx_MODE_DICONNECTED,
+ *                TIMER_CALC_PRE_CLK(TIMER_CALC_DIV(F_CPU,TICK_US,8)));  // TIMER_Pre_CLK_64 at 8MHz
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef TIMERS_CALC_H_
+#define TIMERS_CALC_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The number of timer counts in (us) microseconds with the prescaler (div) (rounded down),
+ *        a div of 0 (no prescaler found) is counted as 1.
+ */
+#define TIMER_CALC_COUNTS(clk,us,div)     ( ((clk)*1ULL*(us)) / (((div)?(div):1)*1000000ULL) )
+
+/**
+ * @brief True when (us) is a whole number of counts with the prescaler (div).
+ */
+#define TIMER_CALC_EXACT(clk,us,div)      ( (((clk)*1ULL*(us)) % (((div)?(div):1)*1000000ULL))==0 )
+
+/**
+ * @brief True when (us) is exact with the prescaler (div) and its counts fit a (bits) wide timer (1 .. 2^bits).
+ */
+#define TIMER_CALC_FITS(clk,us,div,bits)  ( TIMER_CALC_EXACT(clk,us,div) && (TIMER_CALC_COUNTS(clk,us,div)>=1) && \
+                                            (TIMER_CALC_COUNTS(clk,us,div)<=(1ULL<<(bits))) )
+
+/**
+ * @brief The smallest TIMER0/TIMER1 prescaler (1, 8, 64, 256, 1024) that generates (us) exactly, 0 if none.
+ */
+#define TIMER_CALC_DIV(clk,us,bits)       ( TIMER_CALC_FITS(clk,us,1,bits)    ? 1    : \
+                                            TIMER_CALC_FITS(clk,us,8,bits)    ? 8    : \
+                                            TIMER_CALC_FITS(clk,us,64,bits)   ? 64   : \
+                                            TIMER_CALC_FITS(clk,us,256,bits)  ? 256  : \
+                                            TIMER_CALC_FITS(clk,us,1024,bits) ? 1024 : 0 )
+
+/**
+ * @brief The smallest TIMER2 prescaler (1, 8, 32, 64, 128, 256, 1024) that generates (us) exactly, 0 if none.
+ */
+#define TIMER2_CALC_DIV(clk,us)           ( TIMER_CALC_FITS(clk,us,1,8)    ? 1    : \
+                                            TIMER_CALC_FITS(clk,us,8,8)    ? 8    : \
+                                            TIMER_CALC_FITS(clk,us,32,8)   ? 32   : \
+                                            TIMER_CALC_FITS(clk,us,64,8)   ? 64   : \
+                                            TIMER_CALC_FITS(clk,us,128,8)  ? 128  : \
+                                            TIMER_CALC_FITS(clk,us,256,8)  ? 256  : \
+                                            TIMER_CALC_FITS(clk,us,1024,8) ? 1024 : 0 )
+
+/**
+ * @brief The compare value (CTC mode TOP) that generates (us): counts-1.
+ */
+#define TIMER_CALC_TOP(clk,us,bits)       ( TIMER_CALC_COUNTS(clk,us,TIMER_CALC_DIV(clk,us,bits))-1 )
+#define TIMER2_CALC_TOP(clk,us)           ( TIMER_CALC_COUNTS(clk,us,TIMER2_CALC_DIV(clk,us))-1 )
+
+/**
+ * @brief The counter reload value (normal mode, overflow interrupt) that generates (us): 2^bits-counts.
+ */
+#define TIMER_CALC_RELOAD(clk,us,bits)    ( (1ULL<<(bits))-TIMER_CALC_COUNTS(clk,us,TIMER_CALC_DIV(clk,us,bits)) )
+#define TIMER2_CALC_RELOAD(clk,us)        ( 256ULL-TIMER_CALC_COUNTS(clk,us,TIMER2_CALC_DIV(clk,us)) )
+
+/**
+ * @brief The TIMERS_Pre_CLK_t of a TIMER0/TIMER1 prescaler (TIMER_Pre_CLK_0 if it is not valid).
+ */
+#define TIMER_CALC_PRE_CLK(div)           ( ((div)==1)    ? TIMER_Pre_CLK_1    : \
+                                            ((div)==8)    ? TIMER_Pre_CLK_8    : \
+                                            ((div)==64)   ? TIMER_Pre_CLK_64   : \
+                                            ((div)==256)  ? TIMER_Pre_CLK_256  : \
+                                            ((div)==1024) ? TIMER_Pre_CLK_1024 : TIMER_Pre_CLK_0 )
+
+/**
+ * @brief The clock select bits (CS22:0) of a TIMER2 prescaler as TIMERS_Pre_CLK_t (0 if it is not valid).
+ */
+#define TIMER2_CALC_PRE_CLK(div)          ( (TIMERS_Pre_CLK_t)( ((div)==1)   ? 1 : ((div)==8)   ? 2 : ((div)==32)   ? 3 : \
+                                                                ((div)==64)  ? 4 : ((div)==128) ? 5 : ((div)==256)  ? 6 : \
+                                                                ((div)==1024)? 7 : 0 ) )
+
+#endif /* TIMERS_CALC_H_ */
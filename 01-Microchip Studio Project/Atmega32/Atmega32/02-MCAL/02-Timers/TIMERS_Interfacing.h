@@ -22,6 +22,7 @@
 #define    TIMER0_GetCounterValue()            ((u8)TCNT0)
 #define    TIMER0_SetCompareValue(value)       (OCR0=((u8)(value)))
 #define    TIMER0_GetCompareValue()            ((u8)OCR0)
+#define    TIMER0_GetCompareFlag()             ((u8)((TIFR>>1)&1))   /* OCF0: compare match pending */
 
 #define    TIMER1_SetCounterValue(value)       (TCNT1=( (u16)(value) ) )
 #define    TIMER1_GetCounterValue()            ((u16)TCNT1)
@@ -37,6 +38,7 @@
 #define    TIMER2_GetCounterValue()            ((u8)TCNT2)
 #define    TIMER2_SetCompareValue(value)       (OCR2=((u8)(value)))
 #define    TIMER2_GetCompareValue()            ((u8)OCR2)
+#define    TIMER2_IsUpdateBusy()               ((u8)((ASSR&0b00000111)!=0))   /* asynchronous mode: TCN2UB, OCR2UB or TCR2UB */
 
 /*------------------------------------------------------------------------------*/
 /*                                                                              */
@@ -205,6 +207,37 @@ void TIMER2_Init(TIMER2_Modes_t timerMode, TIMER_OC_MODE_t compareMode, TIMERS_P
  */
 void TIMER_ONOFF(TIMERn_t timer, Std_OnOff_t status);
 
+/**
+ * @brief Configures the Timer1 input capture unit (ICP1 pin, PD6).
+ *
+ * The counter value is copied to ICR1 on the selected edge of ICP1 (TIMER1_GetICRValue()),
+ * the noise canceler delays the capture by 4 CPU clocks and filters shorter pulses.
+ * The capture flag set by the edge change is cleared.
+ *
+ * @param edge The capture edge (RISING or FALLING).
+ * @param noiseCanceler STD_ENABLED or STD_DISABLED.
+ *
+ * @return None.
+ *
+ */
+void TIMER1_ICU_Init(ICU_Edge_type edge, Std_EnableDisable_t noiseCanceler);
+
+/**
+ * @brief Initializes TIMER2 in asynchronous mode: clocked by the crystal on TOSC1/TOSC2 (PC6/PC7).
+ *
+ * The sequence of the datasheet is followed: the TIMER2 interrupts are disabled, AS2 is set,
+ * TCNT2 (0), OCR2 and TCCR2 are written, the update busy flags are waited for, then the interrupt flags are cleared.
+ * TIMER2 keeps counting in Power-save sleep mode.
+ *
+ * @param timerMode The timer mode to be set for TIMER2.
+ * @param compareValue The value of OCR2.
+ * @param CLk_select The clock select of TIMER2 (TIMER2_CALC_PRE_CLK()).
+ *
+ * @note The crystal needs about 1s to be stable after power-up, the first periods may be inaccurate.
+ *       The TIMER2 interrupts are left disabled.
+ */
+void TIMER2_AsyncInit(TIMER2_Modes_t timerMode, u8 compareValue, TIMERS_Pre_CLK_t CLk_select);
+
 
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
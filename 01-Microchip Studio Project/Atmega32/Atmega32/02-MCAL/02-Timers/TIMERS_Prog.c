@@ -143,6 +143,69 @@ void TIMER_ONOFF(TIMERn_t timer, Std_OnOff_t status)
 	}
 }
 
+/**
+ * @brief Configures the Timer1 input capture unit (ICP1 pin, PD6).
+ *
+ * The counter value is copied to ICR1 on the selected edge of ICP1 (TIMER1_GetICRValue()),
+ * the noise canceler delays the capture by 4 CPU clocks and filters shorter pulses.
+ * The capture flag set by the edge change is cleared.
+ *
+ * @param edge The capture edge (RISING or FALLING).
+ * @param noiseCanceler STD_ENABLED or STD_DISABLED.
+ *
+ * @return None.
+ *
+ */
+void TIMER1_ICU_Init(ICU_Edge_type edge, Std_EnableDisable_t noiseCanceler)
+{
+	write_bit(TCCR1B, TCCR1B_ICES1, (edge==RISING));
+	write_bit(TCCR1B, TCCR1B_ICNC1, noiseCanceler);
+	TIFR=(1<<TIFR_ICF1); /*< cleared by writing 1 */
+}
+
+/**
+ * @brief Initializes TIMER2 in asynchronous mode: clocked by the crystal on TOSC1/TOSC2 (PC6/PC7).
+ *
+ * @param timerMode The timer mode to be set for TIMER2.
+ * @param compareValue The value of OCR2.
+ * @param CLk_select The clock select of TIMER2 (TIMER2_CALC_PRE_CLK()).
+ *
+ * @return None.
+ *
+ */
+void TIMER2_AsyncInit(TIMER2_Modes_t timerMode, u8 compareValue, TIMERS_Pre_CLK_t CLk_select)
+{
+	u8 tccr2=(u8)CLk_select&0b00000111; /*< OC2 disconnected */
+
+	// [1] the interrupts may fire while the clock source is switched
+	clear_bit(TIMSK, TIMSK_TOIE2);
+	clear_bit(TIMSK, TIMSK_OCIE2);
+
+	// [2] select the crystal
+	set_bit(ASSR, ASSR_AS2);
+
+	// [3] every register is written once: it goes to a temporary register, copied in the TOSC1 clock domain
+	if (timerMode&0b001)
+	{
+		set_bit(tccr2, TCCR2_WGM20);
+	}
+	if (timerMode&0b100)
+	{
+		set_bit(tccr2, TCCR2_WGM21);
+	}
+	Timer2_Clk = CLk_select;
+	TIMER2_SetCounterValue(0);
+	TIMER2_SetCompareValue(compareValue);
+	TCCR2=tccr2;
+	while (TIMER2_IsUpdateBusy())
+	{
+		//two TOSC1 cycles at most (61us at 32768Hz)
+	}
+
+	// [4] the flags may be set by the switching
+	TIFR=(1<<TIFR_TOV2)|(1<<TIFR_OCF2); /*< cleared by writing 1 */
+}
+
 
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
@@ -625,6 +688,7 @@ static void TIMER_setClk(TIMERn_t timer, TIMERS_Pre_CLK_t CLk_select)
 /*                         Interrupt Service Routines                          */
 /*                                                                             */
 /*-----------------------------------------------------------------------------*/
+#if (TIMER0_OVF_ISR_OWNER==TIMER_ISR_DRIVER)
 ISR(TIMER0_OVF_VECT)
 {
 	if (TIMER0_OVF_Fptr != NULL_PTR)
@@ -632,6 +696,8 @@ ISR(TIMER0_OVF_VECT)
 		TIMER0_OVF_Fptr();
 	}
 }
+#endif
+#if (TIMER0_COMP_ISR_OWNER==TIMER_ISR_DRIVER)
 ISR(TIMER0_COMP_VECT)
 {
 	if (TIMER0_COMP_Fptr != NULL_PTR)
@@ -639,6 +705,8 @@ ISR(TIMER0_COMP_VECT)
 		TIMER0_COMP_Fptr();
 	}
 }
+#endif
+#if (TIMER1_OVF_ISR_OWNER==TIMER_ISR_DRIVER)
 ISR(TIMER1_OVF_VECT)
 {
 	if (TIMER1_OVF_Fptr != NULL_PTR)
@@ -646,6 +714,8 @@ ISR(TIMER1_OVF_VECT)
 		TIMER1_OVF_Fptr();
 	}
 }
+#endif
+#if (TIMER1_COMPA_ISR_OWNER==TIMER_ISR_DRIVER)
 ISR(TIMER1_COMPA_VECT)
 {
 	if (TIMER1_COMPA_Fptr != NULL_PTR)
@@ -653,6 +723,8 @@ ISR(TIMER1_COMPA_VECT)
 		TIMER1_COMPA_Fptr();
 	}
 }
+#endif
+#if (TIMER1_COMPB_ISR_OWNER==TIMER_ISR_DRIVER)
 ISR(TIMER1_COMPB_VECT)
 {
 	if (TIMER1_COMPB_Fptr != NULL_PTR)
@@ -660,6 +732,8 @@ ISR(TIMER1_COMPB_VECT)
 		TIMER1_COMPB_Fptr();
 	}
 }
+#endif
+#if (TIMER1_CAPT_ISR_OWNER==TIMER_ISR_DRIVER)
 ISR(TIMER1_CAPT_VECT)
 {
 	if (TIMER1_CAPT_Fptr != NULL_PTR)
@@ -667,6 +741,8 @@ ISR(TIMER1_CAPT_VECT)
 		TIMER1_CAPT_Fptr();
 	}
 }
+#endif
+#if (TIMER2_OVF_ISR_OWNER==TIMER_ISR_DRIVER)
 ISR(TIMER2_OVF_VECT)
 {
 	if (TIMER2_OVF_Fptr != NULL_PTR)
@@ -674,6 +750,8 @@ ISR(TIMER2_OVF_VECT)
 		TIMER2_OVF_Fptr();
 	}
 }
+#endif
+#if (TIMER2_COMP_ISR_OWNER==TIMER_ISR_DRIVER)
 ISR(TIMER2_COMP_VECT)
 {
 	if (TIMER2_COMP_Fptr != NULL_PTR)
@@ -681,3 +759,4 @@ ISR(TIMER2_COMP_VECT)
 		TIMER2_COMP_Fptr();
 	}
 }
+#endif
@@ -12,6 +12,32 @@
 #ifndef EXTI_LCFG_H_
 #define EXTI_LCFG_H_
 
+/**
+ * @brief The owner (binding) of an EXTI interrupt vector.
+ *  - EXTI_ISR_DRIVER : runtime binding, the driver defines the ISR and calls the callback set by EXTI_SetCallBack()
+ *                      (the overhead is estimated at about 86 cycles + the callback, not measured yet:
+ *                      bench.py --exti-isr both gives the prologue/epilogue of both bindings).
+ *  - EXTI_ISR_APP    : build-time binding, the driver does not define the ISR, the application defines
+ *                      ISR(INTx_VECT) itself and only the registers it uses are saved
+ *                      (EXTI_SetCallBack() has no effect for this vector).
+ */
+#define EXTI_ISR_DRIVER           0
+#define EXTI_ISR_APP              1
+
+/**
+ * @brief The owner of each vector, INT2 is the door interlock (main.c).
+ *        They can be set from the command line to compare the bindings (bench.py/isr.py --exti-isr app).
+ */
+#ifndef INT0_ISR_OWNER
+#define INT0_ISR_OWNER            EXTI_ISR_DRIVER
+#endif
+#ifndef INT1_ISR_OWNER
+#define INT1_ISR_OWNER            EXTI_ISR_DRIVER
+#endif
+#ifndef INT2_ISR_OWNER
+#define INT2_ISR_OWNER            EXTI_ISR_DRIVER
+#endif
+
 
 
 
@@ -0,0 +1,36 @@
+/**
+ * @file SLEEP_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private information of the sleep module of the microcontroller.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SLEEP_PRIVATE_H_
+#define SLEEP_PRIVATE_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* MCU Control Register MCUCR */
+enum {
+	/* bit 0:3 for EXTI */
+	MCUCR_SM0=4,    // Sleep Mode Select Bit 0
+	MCUCR_SM1=5,    // Sleep Mode Select Bit 1
+	MCUCR_SM2=6,    // Sleep Mode Select Bit 2
+	MCUCR_SE =7     // Sleep Enable
+	};
+
+#define SLEEP_MODE_MASK     0b01110000
+
+#endif /* SLEEP_PRIVATE_H_ */
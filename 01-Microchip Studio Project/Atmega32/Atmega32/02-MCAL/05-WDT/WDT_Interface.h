@@ -0,0 +1,81 @@
+/**
+ * @file WDT_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the watchdog timer of the microcontroller.
+ *         The watchdog resets the microcontroller when it is not reset (WDT_Reset__asm()) within its timeout.
+ *         It is clocked by its own 1MHz oscillator, it keeps running in every sleep mode.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef WDT_INTERFACE_H_
+#define WDT_INTERFACE_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Macro like FUNCTIONS                                */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#if defined(HOST_BUILD)
+#define WDT_Reset__asm()    ((void)0)                         /* the host port has no watchdog */
+#else
+#define WDT_Reset__asm()    __asm__ __volatile__ ("wdr" ::)   /* restarts the timeout */
+#endif
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The reset flags of MCUCSR, returned by WDT_GetResetCause() (more than one can be set).
+ */
+#define WDT_RESET_POWER_ON        0x01   /* PORF  */
+#define WDT_RESET_EXTERNAL        0x02   /* EXTRF */
+#define WDT_RESET_BROWN_OUT       0x04   /* BORF  */
+#define WDT_RESET_WATCHDOG        0x08   /* WDRF  */
+#define WDT_RESET_JTAG            0x10   /* JTRF  */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef enum {
+	// WDP2 WDP1 WDP0    (typical at VCC=5V)
+	WDT_TIMEOUT_16MS  =0,  // 0 0 0   16.3ms
+	WDT_TIMEOUT_32MS  =1,  // 0 0 1   32.5ms
+	WDT_TIMEOUT_65MS  =2,  // 0 1 0   65ms
+	WDT_TIMEOUT_130MS =3,  // 0 1 1   0.13s
+	WDT_TIMEOUT_260MS =4,  // 1 0 0   0.26s
+	WDT_TIMEOUT_520MS =5,  // 1 0 1   0.52s
+	WDT_TIMEOUT_1000MS=6,  // 1 1 0   1.0s
+	WDT_TIMEOUT_2100MS=7   // 1 1 1   2.1s
+	}WDT_Timeout_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Resets then enables the watchdog with the selected timeout (or changes the timeout).
+ *
+ * @param timeout The timeout (typical at VCC=5V, it is longer at 3V).
+ */
+void WDT_Enable(WDT_Timeout_t timeout);
+
+/**
+ * @brief Disables the watchdog (timed sequence: WDTOE and WDE, then 0 within 4 cycles).
+ */
+void WDT_Disable(void);
+
+/**
+ * @brief Returns the reset flags of MCUCSR (WDT_RESET_xxx) and clears them, to be called once at startup.
+ */
+u8 WDT_GetResetCause(void);
+
+#endif /* WDT_INTERFACE_H_ */
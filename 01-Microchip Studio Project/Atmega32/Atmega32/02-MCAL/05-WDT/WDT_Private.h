@@ -0,0 +1,36 @@
+/**
+ * @file WDT_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private information of the watchdog timer of the microcontroller.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef WDT_PRIVATE_H_
+#define WDT_PRIVATE_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* Watchdog Timer Control Register WDTCR */
+enum {
+	WDTCR_WDP0=0,   // Watchdog Timer Prescaler 0
+	WDTCR_WDP1,     // Watchdog Timer Prescaler 1
+	WDTCR_WDP2,     // Watchdog Timer Prescaler 2
+	WDTCR_WDE,      // Watchdog Enable
+	WDTCR_WDTOE     // Watchdog Turn-off Enable
+	};
+
+#define WDT_RESET_FLAGS_MASK    0b00011111   /* MCUCSR: JTRF WDRF BORF EXTRF PORF (ISC2 and JTD are kept) */
+
+#endif /* WDT_PRIVATE_H_ */
@@ -0,0 +1,94 @@
+/**
+ * @file UART_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private information of the USART driver: the register bits and the baud rate
+ *         computation.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef UART_PRIVATE_H_
+#define UART_PRIVATE_H_
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* USART Control and Status Register A UCSRA */
+enum {
+	UCSRA_MPCM=0,   // Multi-processor Communication Mode
+	UCSRA_U2X,      // Double the USART Transmission Speed
+	UCSRA_PE,       // Parity Error
+	UCSRA_DOR,      // Data OverRun
+	UCSRA_FE,       // Frame Error
+	UCSRA_UDRE,     // USART Data Register Empty
+	UCSRA_TXC,      // USART Transmit Complete
+	UCSRA_RXC       // USART Receive Complete
+	};
+
+/* USART Control and Status Register B UCSRB */
+enum {
+	UCSRB_TXB8=0,   // Transmit Data Bit 8
+	UCSRB_RXB8,     // Receive Data Bit 8
+	UCSRB_UCSZ2,    // Character Size
+	UCSRB_TXEN,     // Transmitter Enable
+	UCSRB_RXEN,     // Receiver Enable
+	UCSRB_UDRIE,    // USART Data Register Empty Interrupt Enable
+	UCSRB_TXCIE,    // TX Complete Interrupt Enable
+	UCSRB_RXCIE     // RX Complete Interrupt Enable
+	};
+
+/* USART Control and Status Register C UCSRC (shares its address with UBRRH) */
+enum {
+	UCSRC_UCPOL=0,  // Clock Polarity
+	UCSRC_UCSZ0,    // Character Size
+	UCSRC_UCSZ1,    // Character Size
+	UCSRC_USBS,     // Stop Bit Select
+	UCSRC_UPM0,     // Parity Mode
+	UCSRC_UPM1,     // Parity Mode
+	UCSRC_UMSEL,    // USART Mode Select
+	UCSRC_URSEL     // Register Select: 1 writes UCSRC, 0 writes UBRRH
+	};
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define UART_RX_ERRORS_MASK       ((1<<UCSRA_FE)|(1<<UCSRA_DOR)|(1<<UCSRA_PE))
+
+/* the nearest UBRR of a mode (16 or 8 samples per bit) and its error in per mille */
+#define UART_UBRR(samples)        ( ((F_CPU*1UL)+((samples)*UART_BAUD/2UL))/((samples)*UART_BAUD)-1UL )
+#define UART_ACTUAL_BAUD(samples) ( (F_CPU*1UL)/((samples)*(UART_UBRR(samples)+1UL)) )
+#define UART_ERROR_PERMILLE(samples)                                                                        \
+	( (UART_ACTUAL_BAUD(samples)>UART_BAUD)? (((UART_ACTUAL_BAUD(samples)-UART_BAUD)*1000UL)/UART_BAUD) :  \
+	                                         (((UART_BAUD-UART_ACTUAL_BAUD(samples))*1000UL)/UART_BAUD) )
+
+/* the normal mode unless the double speed mode is more accurate */
+#define UART_USE_U2X              ( UART_ERROR_PERMILLE(8) < UART_ERROR_PERMILLE(16) )
+#define UART_SAMPLES              ( UART_USE_U2X? 8UL : 16UL )
+#define UART_UBRR_VALUE           ( (u16)UART_UBRR(UART_SAMPLES) )
+
+/* the saturated increment of a 16-bit counter */
+#define UART_COUNT(counter)       do{ if ((counter)!=0xFFFF) { (counter)++; } }while(0)
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Static Global Vaiables                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+RINGBUF_DEFINE(UART_TxBuffer,UART_TX_SIZE);   /*< written by the tasks, read by the UDRE ISR */
+RINGBUF_DEFINE(UART_RxBuffer,UART_RX_SIZE);   /*< written by the RXC ISR, read by the tasks */
+static UART_Stats_t UART_Stats={0,0,0,0};      /*< written by the RXC ISR */
+static Std_Bool_t UART_IsTxUsed=STD_FALSE;     /*< a byte was written since UART_Init() (TXC is 0 until one is sent) */
+
+#endif /* UART_PRIVATE_H_ */
@@ -3,7 +3,11 @@
 
 
 #define F_CPU 8000000
+#if defined(HOST_BUILD)
+#include "HOST_Interface.h"  /*< _delay_ms()/_delay_us() advance the virtual time of the host port */
+#else
 #include <util/delay.h>
+#endif
 
 
 #endif /* MCU_CONFIG_H_ */
\ No newline at end of file
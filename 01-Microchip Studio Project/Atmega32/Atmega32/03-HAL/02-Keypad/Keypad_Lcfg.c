@@ -8,15 +8,15 @@
 #include "Keypad_private.h"
 
 
-const u8 keypad_charArray[ROWS][COLS]={ { '7'  , '8' , '9'  , '\0' },
+const u8 keypad_charArray[ROWS][COLS]={ { '7'  , '8' , '9'  , 'D'  },
 										{ '4'  , '5' , '6'  , '\0' },
 										{ '1'  , '2' , '3'  , '\0' },
-										{ '\0' , '0' , '\0' , '\0' }
+										{ '*'  , '0' , '#'  , '+'  }
 									  };
 
 
 
 const keypad_pinMap_t keypad_pinMap={
-	.kEYPAD_rows={PD0,PD1,PD2,PD3},
-	.kEYPAD_cols={PD4,PD5,PD6,PD7}
+	.kEYPAD_rows={PC4,PC5,PD2,PD3}, /*< PD0/PD1 (RXD/TXD) are the USART, PC4/PC5 (TDO/TDI) need the JTAG disabled (Dio_DisableJtag()) */
+	.kEYPAD_cols={PD4,PD5,PA4,PD7} /*< PD6 (ICP1) is the turntable encoder */
 };
\ No newline at end of file
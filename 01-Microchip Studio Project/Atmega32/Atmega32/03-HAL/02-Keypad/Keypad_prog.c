@@ -9,11 +9,13 @@
 #include "Keypad_Lcfg.h"
 #include "Keypad_private.h"
 
+static u8 keypad_heldKey='\0'; /*< the key pressed at the previous call ('\0': none), it is reported once */
+
 
 Std_Error_t KEYPAD_GetKey(u8 *key)
 {
 	Std_Error_t error=STD_NOK;
-	Std_Status_t isKeyPressed=STD_FALSE;
+	Std_Bool_t isKeyPressed=STD_FALSE;
 	
 	u8 rowsCounter,colsCounter;
 	
@@ -35,13 +37,20 @@ Std_Error_t KEYPAD_GetKey(u8 *key)
 				if (Dio_ReadPin(keypad_pinMap.kEYPAD_cols[colsCounter])==DIO_VOLT_LOW) /*< check which col pin is "low volt" */
 				{
 					isKeyPressed=STD_TRUE; /*< there is key pressed so it is not needed to loop more*/
-					*key=keypad_charArray[rowsCounter][colsCounter]; /*< get key */
-					while(Dio_ReadPin(keypad_pinMap.kEYPAD_cols[colsCounter])==DIO_VOLT_LOW);/*< busy wait until key released */
-					error=STD_OK; /*< indicate that function get key successfully */
+					if (keypad_charArray[rowsCounter][colsCounter]!=keypad_heldKey) /*< a new press, no busy wait for the release */
+					{
+						*key=keypad_charArray[rowsCounter][colsCounter]; /*< get key */
+						error=STD_OK; /*< indicate that function get key successfully */
+					}
+					keypad_heldKey=keypad_charArray[rowsCounter][colsCounter];
 				}
 			}
 		}
 		Dio_WritePin(keypad_pinMap.kEYPAD_rows[rowsCounter],DIO_VOLT_HIGH); /*< switch this row pin to "high volt" again */
 	}
+	if (isKeyPressed==STD_FALSE)
+	{
+		keypad_heldKey='\0'; /*< released */
+	}
 	return error;
 }
\ No newline at end of file
@@ -122,11 +122,29 @@ void LCD_BackSpace(u8 copy_u8_LCD_ID);
  * LCD_Ldfg.c has an array of LCD_CONFIG_t structures that contains the configuration of each LCD.
  * lcd_init() must be called before any other LCD functions.
  * It sets the function set, display off control, clears the display, and sets the entry mode.
- * @see	LCD_lcfg.c
+ * It blocks for about 60ms, use LCD_InitAsync() from a scheduled task to avoid blocking.
+ * @see	LCD_Lcfg.c
  * @param copy_u8_LCD_ID The ID of the LCD.
  */
 void LCD_init(u8 copy_u8_LCD_ID);
 
+/**
+ * @brief Initializes the LCD without blocking (protothread version of LCD_init()).
+ * 
+ * It must be called repeatedly (e.g. from a scheduled task) until it returns PT_ENDED,
+ * it returns PT_WAITING while the LCD is busy (power-on, clear display, ...).
+ * No other LCD function may be called before it ends.
+ * 
+ * @param copy_u8_LCD_ID The ID of the LCD.
+ * @param copy_u16_NowMs The current time in milliseconds (wraps around), e.g. SCHED_GetTick().
+ * @return PT_WAITING or PT_ENDED.
+ * 
+ * @example
+ * // in a periodic task
+ * if (LCD_InitAsync(LCD_ID1,SCHED_GetTick())==PT_ENDED) { isLcdReady=STD_TRUE; }
+ */
+PT_Status_t LCD_InitAsync(u8 copy_u8_LCD_ID, u16 copy_u16_NowMs);
+
 /**
  * @brief Write a character to the LCD.
  * 
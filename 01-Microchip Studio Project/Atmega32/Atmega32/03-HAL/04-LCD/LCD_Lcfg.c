@@ -19,6 +19,7 @@
 * LIB
 */
 #include "Std_Types.h"
+#include "Protothread.h"
 
 /*
 * Include MCAL layer files
@@ -28,9 +29,9 @@
 /*
 * Include own files
 */
-#include "LCD_interface.h"
-#include "LCD_lcfg.h"
-#include "LCD_private.h"
+#include "LCD_Interface.h"
+#include "LCD_Lcfg.h"
+#include "LCD_Private.h"
 
 
 /*
@@ -51,9 +52,9 @@ const LCD_CONFIG_t  LCD_arrOfLCD[copy_LCD_Quantity]=
 	     .LCD_Mode=LCD_4BIT_MODE,
 	     .LCD_LINE=LCD_2lineMode,
 	     .LCD_DOTS=LCD_5x7Dots,
-	     .LCD_RS_Pin=PB2,
-	     .LCD_EN_Pin=PB3,
-	     .LCD_pins={PC4,PC5,PC6,PC7}
+	     .LCD_RS_Pin=PB0,
+	     .LCD_EN_Pin=PB1,
+	     .LCD_pins={PB4,PB5,PB6,PB7} /*< PC6/PC7 (TOSC1/TOSC2) are the RTC crystal */
      },
 	 
 	 {
@@ -0,0 +1,50 @@
+/**
+ * @file Turntable_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the turntable rotation monitor.
+ *         - the encoder pulses per revolution
+ *         - the TIMER1 counts per cycle (TIMER1 is set up by the application)
+ *         - the RPM filter
+ *         - the stall limits
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef TURNTABLE_LCFG_H_
+#define TURNTABLE_LCFG_H_
+
+/**
+ * @brief The number of encoder pulses (rising edges on ICP1) per turntable revolution.
+ */
+#define TURNTABLE_PULSES_PER_REV      24
+
+/**
+ * @brief The number of TIMER1 counts in one TIMER1 cycle (CTC: OCR1A+1) and in one second (TIMERS_Calc.h).
+ *
+ * main.c runs TIMER1 in CTC mode with a 1s cycle (31250 counts at 8MHz/256).
+ * A pulse period is measured modulo one cycle, so a period of 1s or more is a stall.
+ */
+#define TURNTABLE_TIMER1_PERIOD_US    1000000UL
+#define TURNTABLE_TIMER1_COUNTS       ((u32)TIMER_CALC_COUNTS(F_CPU,TURNTABLE_TIMER1_PERIOD_US,TIMER_CALC_DIV(F_CPU,TURNTABLE_TIMER1_PERIOD_US,16)))
+
+/**
+ * @brief The filter of the pulse period: filtered += (period - filtered) / 2^TURNTABLE_FILTER_SHIFT.
+ *
+ * 2 : the step response reaches 90% after 8 pulses (a third of a revolution).
+ */
+#define TURNTABLE_FILTER_SHIFT        2
+
+/**
+ * @brief The turntable is stalled when no pulse came for TURNTABLE_STALL_TIMEOUT_MS
+ *        or the filtered speed is below TURNTABLE_MIN_RPM_X10 (tenths of RPM).
+ *
+ * The timeout plus the call period of TURNTABLE_IsStalled() must stay below 1000ms (one TIMER1 cycle),
+ * a longer gap between two pulses would be measured modulo one cycle.
+ * 900ms is 2.8 RPM with 24 pulses per revolution.
+ */
+#define TURNTABLE_STALL_TIMEOUT_MS    900
+#define TURNTABLE_MIN_RPM_X10         30
+
+#endif /* TURNTABLE_LCFG_H_ */
@@ -0,0 +1,174 @@
+/**
+ * @file Turntable_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the turntable rotation monitor.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see Turntable_Interface.h
+ * @see Turntable_Lcfg.h
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_interrupt.h"
+
+// MCAL
+#include "MCU_config.h"
+#include "TIMERS_Interfacing.h"
+#include "TIMERS_Lcfg.h"
+#include "TIMERS_Calc.h"
+
+// own module files
+#include "Turntable_Interface.h"
+#include "Turntable_Lcfg.h"
+#include "Turntable_Private.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief The capture handler: the TIMER1 input capture ISR itself (build-time binding, TIMERS_Lcfg.h)
+ *        or the callback of the driver ISR (runtime binding).
+ */
+#if (TIMER1_CAPT_ISR_OWNER==TIMER_ISR_APP)
+ISR(TIMER1_CAPT_VECT)
+#else
+static void TURNTABLE_CaptureHandler(void)
+#endif
+{
+	u16 capture=TIMER1_GetICRValue();
+	u16 period;
+	u32 filtered;
+
+	if (TURNTABLE_isLastCaptureValid==STD_TRUE)
+	{
+		if (capture>=TURNTABLE_u16LastCapture)
+		{
+			period=capture-TURNTABLE_u16LastCapture;
+		}
+		else
+		{
+			period=(u16)(capture+TURNTABLE_TIMER1_COUNTS-TURNTABLE_u16LastCapture); /*< the counter was cleared at TOP */
+		}
+
+		filtered=TURNTABLE_u32PeriodQ4;
+		if (filtered==0)
+		{
+			filtered=(u32)period<<TURNTABLE_PERIOD_Q; /*< first period */
+		}
+		else
+		{
+			filtered=filtered-(filtered>>TURNTABLE_FILTER_SHIFT)+(((u32)period<<TURNTABLE_PERIOD_Q)>>TURNTABLE_FILTER_SHIFT);
+		}
+		TURNTABLE_u32PeriodQ4=filtered;
+	}
+	TURNTABLE_u16LastCapture=capture;
+	TURNTABLE_isLastCaptureValid=STD_TRUE;
+	TURNTABLE_u8PulseCount++;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes the input capture unit (rising edge, noise canceler) and binds the capture ISR.
+ *        The capture interrupt stays disabled until TURNTABLE_Start().
+ */
+void TURNTABLE_Init(void)
+{
+	TIMER1_CAPT_INT(STD_DISABLED);
+#if (TIMER1_CAPT_ISR_OWNER==TIMER_ISR_DRIVER)
+	TIMER1_CAPT_SetCallBack(TURNTABLE_CaptureHandler);
+#endif
+	TIMER1_ICU_Init(RISING,STD_ENABLED);
+	TURNTABLE_isRunning=STD_FALSE;
+}
+
+/**
+ * @brief Starts the monitoring (motor switched ON): the measurements are reset and the capture interrupt is enabled.
+ */
+void TURNTABLE_Start(u16 nowMs)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm();
+	TURNTABLE_isLastCaptureValid=STD_FALSE; /*< TIMER1 was stopped/cleared, the next capture only starts a period */
+	TURNTABLE_u32PeriodQ4=0;
+	TURNTABLE_u8LastPulseCount=TURNTABLE_u8PulseCount;
+	TURNTABLE_u16LastPulseMs=nowMs;
+	TURNTABLE_isRunning=STD_TRUE;
+	TIMER1_ICU_Init(RISING,STD_ENABLED); /*< clears an old capture flag */
+	TIMER1_CAPT_INT(STD_ENABLED);
+	SREG=sreg;
+}
+
+/**
+ * @brief Stops the monitoring (motor switched OFF): the capture interrupt is disabled.
+ */
+void TURNTABLE_Stop(void)
+{
+	TIMER1_CAPT_INT(STD_DISABLED);
+	TURNTABLE_isRunning=STD_FALSE;
+}
+
+/**
+ * @brief Returns the filtered speed in tenths of RPM.
+ */
+u16 TURNTABLE_GetRpmX10(void)
+{
+	u32 periodQ4;
+	u16 rpmX10=0;
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm(); /*< u32 read is not atomic on AVR */
+	periodQ4=TURNTABLE_u32PeriodQ4;
+	SREG=sreg;
+
+	if (periodQ4!=0)
+	{
+		rpmX10=(u16)(TURNTABLE_RPM_X10_NUMERATOR/periodQ4);
+	}
+	return rpmX10;
+}
+
+/**
+ * @brief Checks if the turntable is stalled: no pulse for TURNTABLE_STALL_TIMEOUT_MS
+ *        or the speed is below TURNTABLE_MIN_RPM_X10.
+ */
+Std_Bool_t TURNTABLE_IsStalled(u16 nowMs)
+{
+	Std_Bool_t isStalled=STD_FALSE;
+	u8 pulseCount=TURNTABLE_u8PulseCount;
+	u16 rpmX10;
+
+	if (TURNTABLE_isRunning==STD_TRUE)
+	{
+		if (pulseCount!=TURNTABLE_u8LastPulseCount)
+		{
+			TURNTABLE_u8LastPulseCount=pulseCount;
+			TURNTABLE_u16LastPulseMs=nowMs;
+		}
+
+		rpmX10=TURNTABLE_GetRpmX10();
+		if ((u16)(nowMs-TURNTABLE_u16LastPulseMs)>TURNTABLE_STALL_TIMEOUT_MS)
+		{
+			isStalled=STD_TRUE;
+		}
+		else if ((rpmX10!=0) && (rpmX10<TURNTABLE_MIN_RPM_X10))
+		{
+			isStalled=STD_TRUE;
+		}
+	}
+	return isStalled;
+}
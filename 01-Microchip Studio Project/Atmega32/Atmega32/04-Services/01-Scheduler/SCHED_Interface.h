@@ -0,0 +1,141 @@
+/**
+ * @file SCHED_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the cooperative scheduler.
+ *         Tasks are created with a period and a phase (in ticks of SCHED_TICK_MS) and are
+ *         released by the uptime service tick (UPTIME_Interface.h). SCHED_Dispatch() is called from the super loop
+ *         and runs every released task to completion (a task must never block).
+ *
+ *         For every task the scheduler records:
+ *          - the number of runs.
+ *          - the worst-case execution time (WCET) in TIMER0 counts.
+ *          - the number of overruns: a job that completed after its deadline (release + period)
+ *            or a release that was lost because the previous job was still running.
+ *
+ * @par Example:
+ *   @code
+ *    UPTIME_Init();
+ *    SCHED_Init();
+ *    SCHED_CreateTask(&keypadTaskId,task_keypad,50,0);   // every 50 ticks, first release at tick 0
+ *    SCHED_CreateTask(&displayTaskId,task_display,100,5); // every 100 ticks, first release at tick 5
+ *    SCHED_Start();
+ *    while(1)
+ *    {
+ *        SCHED_Dispatch();
+ *    }
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SCHED_INTERFACE_H_
+#define SCHED_INTERFACE_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief Converts TIMER0 counts (as reported in SCHED_TaskStats_t) to microseconds.
+ */
+#define SCHED_COUNTS_TO_US(counts)   UPTIME_COUNTS_TO_US(counts)
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef u8 SCHED_TaskId_t;
+
+typedef struct
+{
+	u16 runs;       /**< number of completed jobs */
+	u16 overruns;   /**< number of missed deadlines (late completions + lost releases) */
+	u16 wcet;       /**< worst-case execution time in TIMER0 counts */
+	u16 lastExec;   /**< execution time of the last job in TIMER0 counts */
+}SCHED_TaskStats_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes the scheduler (no task).
+ *
+ * @note The tick is the uptime service tick, UPTIME_Init() must be called before.
+ */
+void SCHED_Init(void);
+
+/**
+ * @brief Creates a periodic task.
+ *
+ * The task is released at tick (phase), then every (period) ticks.
+ * Tasks run in creation order when they are released at the same tick.
+ *
+ * @param id Pointer to store the id of the created task (may be NULL_PTR).
+ * @param task Pointer to the task function.
+ * @param period The period of the task in ticks (1..32767), it is also the deadline of the task.
+ * @param phase The offset of the first release in ticks.
+ * @return STD_OK , STD_NULL_POINTER , STD_INVALID_ARG or STD_OUT_OF_MEMORY (SCHED_MAX_TASKS reached).
+ */
+Std_Error_t SCHED_CreateTask(SCHED_TaskId_t *id, Ptr_VoidFuncVoid_t task, u16 period, u16 phase);
+
+/**
+ * @brief Starts the scheduling: the phases of the created tasks count from now.
+ *
+ * @note The global interrupt must be enabled.
+ */
+void SCHED_Start(void);
+
+/**
+ * @brief Runs every released task once, must be called from the super loop.
+ *        When no task was released it calls the idle hook (SCHED_SetIdleHook()).
+ */
+void SCHED_Dispatch(void);
+
+/**
+ * @brief Returns the current tick: the low 16 bits of the uptime in ticks (wraps around).
+ */
+u16 SCHED_GetTick(void);
+
+/**
+ * @brief Sets the function called by SCHED_Dispatch() when no task is released (NULL_PTR: no hook, busy loop).
+ *
+ * The hook is called with the global interrupt disabled right after the check, so a release can't be missed:
+ * it must enable the interrupts and wait for the next one in one step (SLEEP_Enter()).
+ *
+ * @param LocalPtr Pointer to the idle function.
+ */
+void SCHED_SetIdleHook(Ptr_VoidFuncVoid_t LocalPtr);
+
+/**
+ * @brief Returns the CPU load of the last SCHED_LOAD_WINDOW_MS window in percent (100 until the first window ends).
+ *
+ * The idle time is the time of the SCHED_Dispatch() calls that run no task (sleeping in the idle hook or polling),
+ * the rest (tasks, ISRs, dispatcher) is the load.
+ */
+u8 SCHED_GetCpuLoad(void);
+
+/**
+ * @brief Gets the run-time statistics of a task.
+ *
+ * @param id The id of the task.
+ * @param stats Pointer to store the statistics.
+ * @return STD_OK , STD_NULL_POINTER or STD_NOT_EXIST.
+ */
+Std_Error_t SCHED_GetTaskStats(SCHED_TaskId_t id, SCHED_TaskStats_t *stats);
+
+/**
+ * @brief Clears the run-time statistics of a task.
+ *
+ * @param id The id of the task.
+ * @return STD_OK or STD_NOT_EXIST.
+ */
+Std_Error_t SCHED_ResetTaskStats(SCHED_TaskId_t id);
+
+#endif /* SCHED_INTERFACE_H_ */
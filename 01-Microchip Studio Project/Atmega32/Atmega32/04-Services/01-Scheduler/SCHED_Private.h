@@ -0,0 +1,80 @@
+/**
+ * @file SCHED_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private types, static global variables and functions of the cooperative scheduler.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SCHED_PRIVATE_H_
+#define SCHED_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The load window in TIMER0 counts.
+ */
+#define SCHED_LOAD_WINDOW_COUNTS    ((u32)((SCHED_LOAD_WINDOW_MS/UPTIME_TICK_MS)*UPTIME_TICK_COUNTS))
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef struct
+{
+	Ptr_VoidFuncVoid_t task; /**< task function */
+	u16 period;              /**< period (and relative deadline) in ticks */
+	u16 nextRelease;         /**< tick of the next release */
+	SCHED_TaskStats_t stats; /**< run-time statistics */
+}SCHED_Task_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Static Global Vaiables                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static SCHED_Task_t SCHED_arrOfTasks[SCHED_MAX_TASKS];
+static u8 SCHED_u8TasksCount=0;
+
+static u16 SCHED_u16InitTick=0; /**< tick of SCHED_Init(), the phases count from it until SCHED_Start() */
+
+static Ptr_VoidFuncVoid_t SCHED_IdleHook=NULL_PTR; /**< called when no task is released (SCHED_SetIdleHook()) */
+static u32 SCHED_u32IdleCounts=0;   /**< TIMER0 counts spent idle in the current load window */
+static u32 SCHED_u32WindowStart=0;  /**< start of the current load window in TIMER0 counts (UPTIME_GetCounts()) */
+static u8 SCHED_u8CpuLoad=100;      /**< the CPU load of the last window in percent */
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns a timestamp in TIMER0 counts (UPTIME_GetCounts()), it wraps around.
+ *
+ * Used to measure execution times shorter than 65536 counts.
+ */
+static u16 SCHED_GetTimestamp(void);
+
+/**
+ * @brief Returns STD_TRUE when at least one task is released at the current tick.
+ */
+static Std_Bool_t SCHED_IsAnyReleased(void);
+
+/**
+ * @brief Closes the load window when SCHED_LOAD_WINDOW_MS passed: computes the load and starts a new window.
+ */
+static void SCHED_UpdateLoad(void);
+
+#endif /* SCHED_PRIVATE_H_ */
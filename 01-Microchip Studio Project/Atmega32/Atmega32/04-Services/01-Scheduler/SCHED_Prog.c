@@ -0,0 +1,302 @@
+/**
+ * @file SCHED_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the cooperative scheduler.
+ *         The tick is read from the uptime service, the release/deadline bookkeeping is done
+ *         by SCHED_Dispatch() in the super loop so the tick ISR stays short.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see SCHED_Interface.h
+ * @see SCHED_Lcfg.h
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_interrupt.h"
+
+// MCAL
+#include "MCU_config.h"
+#include "TIMERS_Interfacing.h"
+#include "TIMERS_Calc.h"
+
+// Services
+#include "UPTIME_Interface.h"
+#include "UPTIME_Lcfg.h"
+
+// own module files
+#include "SCHED_Lcfg.h"
+#include "SCHED_Interface.h"
+#include "SCHED_Private.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns a timestamp in TIMER0 counts (UPTIME_GetCounts()), it wraps around.
+ *
+ * Used to measure execution times shorter than 65536 counts.
+ */
+static u16 SCHED_GetTimestamp(void)
+{
+	return (u16)UPTIME_GetCounts();
+}
+
+/**
+ * @brief Returns STD_TRUE when at least one task is released at the current tick.
+ */
+static Std_Bool_t SCHED_IsAnyReleased(void)
+{
+	Std_Bool_t isReleased=STD_FALSE;
+	u8 i;
+	u16 now=SCHED_GetTick();
+
+	for (i=0; i<SCHED_u8TasksCount; i++)
+	{
+		if ((s16)(now-SCHED_arrOfTasks[i].nextRelease)>=0)
+		{
+			isReleased=STD_TRUE;
+		}
+	}
+	return isReleased;
+}
+
+/**
+ * @brief Closes the load window when SCHED_LOAD_WINDOW_MS passed: computes the load and starts a new window.
+ */
+static void SCHED_UpdateLoad(void)
+{
+	u32 now=UPTIME_GetCounts();
+	u32 window=now-SCHED_u32WindowStart;
+
+	if (window>=SCHED_LOAD_WINDOW_COUNTS)
+	{
+		SCHED_u8CpuLoad=(u8)(100-((SCHED_u32IdleCounts*100)/window));
+		SCHED_u32IdleCounts=0;
+		SCHED_u32WindowStart=now;
+	}
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes the scheduler (no task).
+ */
+void SCHED_Init(void)
+{
+	SCHED_u8TasksCount=0;
+	SCHED_u16InitTick=SCHED_GetTick();
+	SCHED_u32IdleCounts=0;
+	SCHED_u32WindowStart=UPTIME_GetCounts();
+	SCHED_u8CpuLoad=100;
+}
+
+/**
+ * @brief Creates a periodic task.
+ *
+ * The task is released at tick (phase), then every (period) ticks.
+ * Tasks run in creation order when they are released at the same tick.
+ *
+ * @param id Pointer to store the id of the created task (may be NULL_PTR).
+ * @param task Pointer to the task function.
+ * @param period The period of the task in ticks (1..32767), it is also the deadline of the task.
+ * @param phase The offset of the first release in ticks.
+ * @return STD_OK , STD_NULL_POINTER , STD_INVALID_ARG or STD_OUT_OF_MEMORY (SCHED_MAX_TASKS reached).
+ */
+Std_Error_t SCHED_CreateTask(SCHED_TaskId_t *id, Ptr_VoidFuncVoid_t task, u16 period, u16 phase)
+{
+	Std_Error_t error=STD_OK;
+	SCHED_Task_t *newTask;
+
+	if (task==NULL_PTR)
+	{
+		error=STD_NULL_POINTER;
+	}
+	else if ((period==0) || (period>0x7FFF))
+	{
+		error=STD_INVALID_ARG;
+	}
+	else if (SCHED_u8TasksCount>=SCHED_MAX_TASKS)
+	{
+		error=STD_OUT_OF_MEMORY;
+	}
+	else
+	{
+		newTask=&SCHED_arrOfTasks[SCHED_u8TasksCount];
+		newTask->task=task;
+		newTask->period=period;
+		newTask->nextRelease=SCHED_u16InitTick+phase; /*< moved to the start tick by SCHED_Start() */
+		newTask->stats.runs=0;
+		newTask->stats.overruns=0;
+		newTask->stats.wcet=0;
+		newTask->stats.lastExec=0;
+
+		if (id!=NULL_PTR)
+		{
+			*id=SCHED_u8TasksCount;
+		}
+		SCHED_u8TasksCount++;
+	}
+	return error;
+}
+
+/**
+ * @brief Starts the scheduling: the phases of the created tasks count from now.
+ */
+void SCHED_Start(void)
+{
+	u8 i;
+	u16 shift=SCHED_GetTick()-SCHED_u16InitTick;
+
+	for (i=0; i<SCHED_u8TasksCount; i++)
+	{
+		SCHED_arrOfTasks[i].nextRelease+=shift;
+	}
+}
+
+/**
+ * @brief Runs every released task once, must be called from the super loop.
+ *        When no task was released it calls the idle hook, a call that runs no task is counted as idle time.
+ */
+void SCHED_Dispatch(void)
+{
+	u8 i;
+	u16 now,release,start,exec;
+	u32 idleStart=UPTIME_GetCounts();
+	Std_Bool_t isTaskRun=STD_FALSE;
+	SCHED_Task_t *currentTask;
+
+	for (i=0; i<SCHED_u8TasksCount; i++)
+	{
+		currentTask=&SCHED_arrOfTasks[i];
+		now=SCHED_GetTick();
+
+		if ((s16)(now-currentTask->nextRelease)>=0) /*< the task is released */
+		{
+			release=currentTask->nextRelease;
+			isTaskRun=STD_TRUE;
+
+			start=SCHED_GetTimestamp();
+			currentTask->task();
+			exec=SCHED_GetTimestamp()-start;
+			now=SCHED_GetTick();
+
+			currentTask->stats.runs++;
+			currentTask->stats.lastExec=exec;
+			if (exec>currentTask->stats.wcet)
+			{
+				currentTask->stats.wcet=exec;
+			}
+
+			if ((u16)(now-release)>currentTask->period) /*< completed after its deadline */
+			{
+				currentTask->stats.overruns++;
+			}
+
+			currentTask->nextRelease=release+currentTask->period;
+			while ((s16)(now-currentTask->nextRelease)>=(s16)currentTask->period) /*< a whole period passed, this release is lost */
+			{
+				currentTask->nextRelease+=currentTask->period;
+				currentTask->stats.overruns++;
+			}
+		}
+	}
+
+	if (isTaskRun==STD_FALSE)
+	{
+		if (SCHED_IdleHook!=NULL_PTR)
+		{
+			Global_Interrupt_Disable__asm(); /*< a tick between the check and the sleep would be a lost wake-up */
+			if (SCHED_IsAnyReleased()==STD_FALSE)
+			{
+				SCHED_IdleHook(); /*< returns after the next interrupt */
+			}
+			Global_Interrupt_Enable__asm();
+		}
+		SCHED_u32IdleCounts+=UPTIME_GetCounts()-idleStart;
+	}
+	SCHED_UpdateLoad();
+}
+
+/**
+ * @brief Returns the current tick: the low 16 bits of the uptime in ticks (wraps around).
+ */
+u16 SCHED_GetTick(void)
+{
+	return (u16)(UPTIME_GetMs()/SCHED_TICK_MS);
+}
+
+/**
+ * @brief Sets the function called by SCHED_Dispatch() when no task is released.
+ */
+void SCHED_SetIdleHook(Ptr_VoidFuncVoid_t LocalPtr)
+{
+	SCHED_IdleHook=LocalPtr;
+}
+
+/**
+ * @brief Returns the CPU load of the last SCHED_LOAD_WINDOW_MS window in percent.
+ */
+u8 SCHED_GetCpuLoad(void)
+{
+	return SCHED_u8CpuLoad;
+}
+
+/**
+ * @brief Gets the run-time statistics of a task.
+ *
+ * @param id The id of the task.
+ * @param stats Pointer to store the statistics.
+ * @return STD_OK , STD_NULL_POINTER or STD_NOT_EXIST.
+ */
+Std_Error_t SCHED_GetTaskStats(SCHED_TaskId_t id, SCHED_TaskStats_t *stats)
+{
+	Std_Error_t error=STD_OK;
+	if (stats==NULL_PTR)
+	{
+		error=STD_NULL_POINTER;
+	}
+	else if (id>=SCHED_u8TasksCount)
+	{
+		error=STD_NOT_EXIST;
+	}
+	else
+	{
+		*stats=SCHED_arrOfTasks[id].stats;
+	}
+	return error;
+}
+
+/**
+ * @brief Clears the run-time statistics of a task.
+ *
+ * @param id The id of the task.
+ * @return STD_OK or STD_NOT_EXIST.
+ */
+Std_Error_t SCHED_ResetTaskStats(SCHED_TaskId_t id)
+{
+	Std_Error_t error=STD_OK;
+	if (id>=SCHED_u8TasksCount)
+	{
+		error=STD_NOT_EXIST;
+	}
+	else
+	{
+		SCHED_arrOfTasks[id].stats.runs=0;
+		SCHED_arrOfTasks[id].stats.overruns=0;
+		SCHED_arrOfTasks[id].stats.wcet=0;
+		SCHED_arrOfTasks[id].stats.lastExec=0;
+	}
+	return error;
+}
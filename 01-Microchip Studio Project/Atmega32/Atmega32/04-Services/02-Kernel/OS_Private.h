@@ -0,0 +1,208 @@
+/**
+ * @file OS_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private types, static global variables, context switch macros and functions of the preemptive kernel.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef OS_PRIVATE_H_
+#define OS_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define OS_IDLE_TASK              OS_MAX_TASKS  /**< index of the idle task (main) TCB */
+#define OS_SREG_INIT              0x80          /**< SREG of a new task: global interrupt enabled */
+
+/**
+ * @brief Saves r0, SREG, r1..r31 on the stack of the current task and its SP in OS_pCurrentTCB->sp
+ *        (79 cycles counted, the tick is measured by the OS_TICK_ISR case of bench.py --preemptive).
+ *
+ * The interrupts are disabled after SREG is read, r1 (the zero register) is cleared for the C code that follows.
+ */
+#define OS_SAVE_CONTEXT()                 \
+	__asm__ __volatile__ (                \
+		"push r0                    \n\t" \
+		"in   r0, __SREG__          \n\t" \
+		"cli                        \n\t" \
+		"push r0                    \n\t" \
+		"push r1                    \n\t" \
+		"clr  r1                    \n\t" \
+		"push r2                    \n\t" \
+		"push r3                    \n\t" \
+		"push r4                    \n\t" \
+		"push r5                    \n\t" \
+		"push r6                    \n\t" \
+		"push r7                    \n\t" \
+		"push r8                    \n\t" \
+		"push r9                    \n\t" \
+		"push r10                   \n\t" \
+		"push r11                   \n\t" \
+		"push r12                   \n\t" \
+		"push r13                   \n\t" \
+		"push r14                   \n\t" \
+		"push r15                   \n\t" \
+		"push r16                   \n\t" \
+		"push r17                   \n\t" \
+		"push r18                   \n\t" \
+		"push r19                   \n\t" \
+		"push r20                   \n\t" \
+		"push r21                   \n\t" \
+		"push r22                   \n\t" \
+		"push r23                   \n\t" \
+		"push r24                   \n\t" \
+		"push r25                   \n\t" \
+		"push r26                   \n\t" \
+		"push r27                   \n\t" \
+		"push r28                   \n\t" \
+		"push r29                   \n\t" \
+		"push r30                   \n\t" \
+		"push r31                   \n\t" \
+		"lds  r26, OS_pCurrentTCB   \n\t" \
+		"lds  r27, OS_pCurrentTCB+1 \n\t" \
+		"in   r0, __SP_L__          \n\t" \
+		"st   x+, r0                \n\t" \
+		"in   r0, __SP_H__          \n\t" \
+		"st   x+, r0                \n\t" \
+	)
+
+/**
+ * @brief Loads SP from OS_pCurrentTCB->sp and restores r31..r1, SREG and r0 (77 cycles counted).
+ */
+#define OS_RESTORE_CONTEXT()              \
+	__asm__ __volatile__ (                \
+		"lds  r26, OS_pCurrentTCB   \n\t" \
+		"lds  r27, OS_pCurrentTCB+1 \n\t" \
+		"ld   r28, x+               \n\t" \
+		"out  __SP_L__, r28         \n\t" \
+		"ld   r29, x+               \n\t" \
+		"out  __SP_H__, r29         \n\t" \
+		"pop  r31                   \n\t" \
+		"pop  r30                   \n\t" \
+		"pop  r29                   \n\t" \
+		"pop  r28                   \n\t" \
+		"pop  r27                   \n\t" \
+		"pop  r26                   \n\t" \
+		"pop  r25                   \n\t" \
+		"pop  r24                   \n\t" \
+		"pop  r23                   \n\t" \
+		"pop  r22                   \n\t" \
+		"pop  r21                   \n\t" \
+		"pop  r20                   \n\t" \
+		"pop  r19                   \n\t" \
+		"pop  r18                   \n\t" \
+		"pop  r17                   \n\t" \
+		"pop  r16                   \n\t" \
+		"pop  r15                   \n\t" \
+		"pop  r14                   \n\t" \
+		"pop  r13                   \n\t" \
+		"pop  r12                   \n\t" \
+		"pop  r11                   \n\t" \
+		"pop  r10                   \n\t" \
+		"pop  r9                    \n\t" \
+		"pop  r8                    \n\t" \
+		"pop  r7                    \n\t" \
+		"pop  r6                    \n\t" \
+		"pop  r5                    \n\t" \
+		"pop  r4                    \n\t" \
+		"pop  r3                    \n\t" \
+		"pop  r2                    \n\t" \
+		"pop  r1                    \n\t" \
+		"pop  r0                    \n\t" \
+		"out  __SREG__, r0          \n\t" \
+		"pop  r0                    \n\t" \
+	)
+
+/**
+ * @brief Sets the I bit of the SREG saved by OS_SAVE_CONTEXT() in the tick ISR (7 cycles).
+ *
+ * The CPU clears I when it enters the interrupt, so SREG is saved with I=0, but the preempted task was running with I=1.
+ * The context can be resumed by OS_Yield() (ret, the restored SREG decides I): without this the task would go on
+ * with the interrupts disabled. The saved SREG is at SP+32 (r0 at SP+33, r1..r31 below it),
+ * Y and r16 are free: they are saved.
+ */
+#define OS_SAVED_SREG_SET_I()             \
+	__asm__ __volatile__ (                \
+		"in   r28, __SP_L__         \n\t" \
+		"in   r29, __SP_H__         \n\t" \
+		"ldd  r16, Y+32             \n\t" \
+		"ori  r16, 0x80             \n\t" \
+		"std  Y+32, r16             \n\t" \
+	)
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef enum
+{
+	OS_TASK_UNUSED,     /**< no task has this priority */
+	OS_TASK_READY,      /**< ready (or running) */
+	OS_TASK_BLOCKED,    /**< waiting for wakeTick */
+	OS_TASK_SUSPENDED   /**< stack overflow, never runs again */
+}OS_TaskState_t;
+
+typedef struct
+{
+	u8 *sp;                 /**< saved stack pointer, MUST be the first member (used by OS_SAVE_CONTEXT()/OS_RESTORE_CONTEXT()) */
+	u8 *stackBottom;        /**< lowest address of the stack (the canary), NULL_PTR for the idle task */
+	u16 wakeTick;           /**< tick to wake up at when blocked */
+	OS_TaskState_t state;
+}OS_TCB_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Static Global Vaiables                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static OS_TCB_t OS_arrTCB[OS_MAX_TASKS+1]; /**< indexed by priority, the last one is the idle task */
+static OS_TCB_t * volatile OS_pCurrentTCB=NULL_PTR; /**< the running task (its name is used by the context switch assembly) */
+
+static volatile u16 OS_u16Tick=0;
+
+static OS_TCB_t * volatile OS_pLockTCB=NULL_PTR;  /**< the task that holds the lock (OS_Lock()), NULL_PTR when unlocked */
+static volatile OS_Priority_t OS_u8LockCeiling=0; /**< the tasks of this priority and lower don't preempt it */
+
+static Ptr_VoidFuncU8_t OS_StackOverflow_Fptr=NULL_PTR;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Builds the initial context of a task on its stack (as if it was interrupted at its first instruction).
+ *
+ * @return The initial stack pointer.
+ */
+static u8 *OS_InitStack(u8 stack[], u16 stackSize, Ptr_VoidFuncVoid_t task);
+
+/**
+ * @brief Checks the stack of the current task then selects the highest priority ready task as OS_pCurrentTCB,
+ *        the task that holds the lock is selected while no task above the ceiling is ready.
+ */
+static void OS_Schedule(void);
+
+/**
+ * @brief The tick handler, called from the naked TIMER0 compare match ISR between save and restore context.
+ */
+static void OS_TickHandler(void);
+
+/**
+ * @brief Switches the context from a task (called by OS_Delay()/OS_DelayUntil()/OS_Unlock()).
+ */
+static void OS_Yield(void) __attribute__((naked,noinline));
+
+#endif /* OS_PRIVATE_H_ */
@@ -0,0 +1,42 @@
+/**
+ * @file UPTIME_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the uptime service.
+ *         - the tick of the millisecond counter
+ *         - the TIMER0 settings (CTC mode, compare match interrupt)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UPTIME_LCFG_H_
+#define UPTIME_LCFG_H_
+
+/**
+ * @brief The tick period in milliseconds: the millisecond counter is incremented by UPTIME_TICK_MS every tick.
+ *
+ * @note The preemptive kernel drives the tick when it is enabled, OS_TICK_MS must be the same.
+ */
+#define UPTIME_TICK_MS            1
+
+/**
+ * @brief TIMER0 settings that generate UPTIME_TICK_MS in CTC mode, computed from F_CPU at compile time (TIMERS_Calc.h).
+ *
+ * tick = (UPTIME_TIMER0_COMPARE+1) * prescaler / F_CPU
+ *      = (124+1) * 64 / 8MHz = 1ms
+ *
+ * The build fails (UPTIME_Prog.c) when F_CPU can't generate UPTIME_TICK_MS exactly
+ * or when one TIMER0 count is not a whole number of microseconds.
+ */
+#define UPTIME_TIMER0_DIV         TIMER_CALC_DIV(F_CPU,UPTIME_TICK_MS*1000UL,8)
+#define UPTIME_TIMER0_PRESCALER   TIMER_CALC_PRE_CLK(UPTIME_TIMER0_DIV)
+#define UPTIME_TIMER0_COMPARE     ((u8)TIMER_CALC_TOP(F_CPU,UPTIME_TICK_MS*1000UL,8))
+
+/**
+ * @brief The number of TIMER0 counts in one tick and the microseconds in one count (8us at 8MHz/64).
+ */
+#define UPTIME_TICK_COUNTS        ((u16)UPTIME_TIMER0_COMPARE+1)
+#define UPTIME_US_PER_COUNT       ((u16)((UPTIME_TIMER0_DIV*1000000ULL)/F_CPU))
+
+#endif /* UPTIME_LCFG_H_ */
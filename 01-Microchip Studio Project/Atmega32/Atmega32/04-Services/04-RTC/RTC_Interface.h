@@ -0,0 +1,96 @@
+/**
+ * @file RTC_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the real-time clock service.
+ *         TIMER2 is clocked asynchronously by a 32768Hz watch crystal on TOSC1/TOSC2 (PC6/PC7),
+ *         its overflow interrupt counts the time of day once per second.
+ *
+ *         TIMER2 keeps counting in Power-save sleep mode (TIMER0 and TIMER1 stop): the clock keeps the time
+ *         and its interrupt wakes the CPU up once per second.
+ *
+ * @par Example (Power-save sleep between the seconds):
+ *   @code
+ *    Global_Interrupt_Disable__asm();
+ *    SLEEP_SetMode(SLEEP_POWER_SAVE);
+ *    RTC_PrepareSleep();
+ *    SLEEP_Enter();                    // woken up by the next second (or an external interrupt)
+ *    SLEEP_SetMode(SLEEP_IDLE);
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef RTC_INTERFACE_H_
+#define RTC_INTERFACE_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define RTC_SECONDS_PER_DAY       86400UL
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef struct
+{
+	u8 hour;     /**< 0..23 */
+	u8 minute;   /**< 0..59 */
+	u8 second;   /**< 0..59 */
+}RTC_Time_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Clears the time (00:00:00) and starts TIMER2 in asynchronous mode with the overflow interrupt enabled.
+ *
+ * @note The crystal needs about 1s to be stable after power-up, the first seconds may be inaccurate.
+ */
+void RTC_Init(void);
+
+/**
+ * @brief Sets the time of day, the current second restarts.
+ *
+ * @param time Pointer to the new time.
+ * @return STD_OK , STD_NULL_POINTER or STD_INVALID_ARG (a field out of range).
+ */
+Std_Error_t RTC_SetTime(const RTC_Time_t *time);
+
+/**
+ * @brief Gets the time of day.
+ *
+ * @param time Pointer to store the time.
+ * @return STD_OK or STD_NULL_POINTER.
+ */
+Std_Error_t RTC_GetTime(RTC_Time_t *time);
+
+/**
+ * @brief Returns the seconds since midnight [0,RTC_SECONDS_PER_DAY-1].
+ */
+u32 RTC_GetSecondOfDay(void);
+
+/**
+ * @brief Sets the function called every second by the TIMER2 overflow ISR (after the time is updated).
+ *
+ * @param LocalPtr Pointer to the callback function (NULL_PTR: no callback).
+ */
+void RTC_SetSecondCallBack(Ptr_VoidFuncVoid_t LocalPtr);
+
+/**
+ * @brief Must be called right before entering Power-save (or Extended Standby) sleep mode.
+ *
+ * The TIMER2 interrupt logic needs one crystal cycle (30.5us) after a wake-up to be reset:
+ * a TIMER2 register is written and its update is waited for, so the next overflow wakes the CPU up.
+ */
+void RTC_PrepareSleep(void);
+
+#endif /* RTC_INTERFACE_H_ */
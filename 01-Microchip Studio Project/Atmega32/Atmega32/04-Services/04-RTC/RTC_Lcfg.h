@@ -0,0 +1,39 @@
+/**
+ * @file RTC_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the real-time clock service.
+ *         - the frequency of the watch crystal on TOSC1/TOSC2
+ *         - the TIMER2 settings (asynchronous, normal mode, overflow interrupt every second)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef RTC_LCFG_H_
+#define RTC_LCFG_H_
+
+/**
+ * @brief The frequency of the crystal connected to TOSC1/TOSC2 (PC6/PC7) in Hz.
+ */
+#define RTC_CRYSTAL_HZ            32768UL
+
+/**
+ * @brief The period of the clock tick in microseconds (the time of day has a resolution of one second).
+ */
+#define RTC_TICK_US               1000000UL
+
+/**
+ * @brief TIMER2 settings computed from RTC_CRYSTAL_HZ at compile time (TIMERS_Calc.h).
+ *
+ * tick = 256 * prescaler / RTC_CRYSTAL_HZ
+ *      = 256 * 128 / 32768Hz = 1s
+ *
+ * The tick must be a whole overflow (RTC_TIMER2_RELOAD==0): TCNT2 is never written in the ISR,
+ * a write in asynchronous mode takes two crystal cycles. The build fails (RTC_Prog.c) otherwise.
+ */
+#define RTC_TIMER2_DIV            TIMER2_CALC_DIV(RTC_CRYSTAL_HZ,RTC_TICK_US)
+#define RTC_TIMER2_PRESCALER      TIMER2_CALC_PRE_CLK(RTC_TIMER2_DIV)
+#define RTC_TIMER2_RELOAD         TIMER2_CALC_RELOAD(RTC_CRYSTAL_HZ,RTC_TICK_US)
+
+#endif /* RTC_LCFG_H_ */
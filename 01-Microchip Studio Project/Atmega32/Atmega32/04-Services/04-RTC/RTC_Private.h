@@ -0,0 +1,40 @@
+/**
+ * @file RTC_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private static global variables and functions of the real-time clock service.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef RTC_PRIVATE_H_
+#define RTC_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Static Global Vaiables                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static volatile u32 RTC_u32SecondOfDay=0;          /**< incremented by the TIMER2 overflow ISR */
+static Ptr_VoidFuncVoid_t RTC_Second_Fptr=NULL_PTR; /**< called every second by the ISR */
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+#if (TIMER2_OVF_ISR_OWNER==TIMER_ISR_DRIVER)
+/**
+ * @brief The second handler, called from the TIMER2 overflow ISR of the driver.
+ */
+static void RTC_SecondHandler(void);
+#endif
+
+#endif /* RTC_PRIVATE_H_ */
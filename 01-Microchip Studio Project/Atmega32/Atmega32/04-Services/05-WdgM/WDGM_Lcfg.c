@@ -0,0 +1,25 @@
+/**
+ * @file WDGM_Lcfg.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the check-in budgets of the supervised entities.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "Std_Types.h"
+
+#include "WDGM_Lcfg.h"
+
+
+/**
+ * @brief The longest time in milliseconds (uptime) between two check-ins of each entity (indexed by WDGM_EntityId_t).
+ *        A few periods of the task: a late job is tolerated, a task that stopped running is not.
+ */
+const u16 WDGM_arrBudgetMs[WDGM_ENTITIES_COUNT]={
+	50,    /* WDGM_SAFETY  : period 5ms   */
+	100,   /* WDGM_CONTROL : period 10ms  */
+	500,   /* WDGM_KEYPAD  : period 50ms  */
+	500    /* WDGM_DISPLAY : period 100ms */
+	};
@@ -0,0 +1,36 @@
+/**
+ * @file WDGM_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the watchdog manager (the loop deadline monitor).
+ *         - the supervised entities (the tasks of main.c)
+ *         - the watchdog timeout
+ *         - the check-in budget of every entity (WDGM_Lcfg.c)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef WDGM_LCFG_H_
+#define WDGM_LCFG_H_
+
+/**
+ * @brief The supervised entities, each one calls WDGM_CheckIn() every time it runs.
+ */
+typedef enum {
+	WDGM_SAFETY,
+	WDGM_CONTROL,
+	WDGM_KEYPAD,
+	WDGM_DISPLAY,
+	WDGM_ENTITIES_COUNT
+	}WDGM_EntityId_t;
+
+/**
+ * @brief The watchdog timeout: the longest time the outputs can stay in a hung state.
+ *
+ * @note It must be longer than the Power-save sleep of the delayed start (1s, main.c):
+ *       the CPU doesn't run WDGM_MainFunction() while it sleeps.
+ */
+#define WDGM_WDT_TIMEOUT          WDT_TIMEOUT_2100MS
+
+#endif /* WDGM_LCFG_H_ */
@@ -0,0 +1,53 @@
+/**
+ * @file WDGM_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private types and static global variables of the watchdog manager.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef WDGM_PRIVATE_H_
+#define WDGM_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define WDGM_NOINIT               __attribute__((section(".noinit")))   /* not cleared by the startup code */
+#define WDGM_NOINIT_MAGIC         0xA55A   /* .noinit is valid (written before by this firmware) */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef struct
+{
+	u16 magic;           /**< WDGM_NOINIT_MAGIC when the record is valid */
+	u8 failedEntity;     /**< the entity missing its budget now, WDGM_NO_ENTITY when all are met */
+	u8 watchdogResets;   /**< the number of watchdog resets since the last power-on */
+}WDGM_NoInitRecord_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Static Global Vaiables                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+extern const u16 WDGM_arrBudgetMs[WDGM_ENTITIES_COUNT];
+
+static WDGM_NoInitRecord_t WDGM_noInitRecord WDGM_NOINIT; /**< survives the watchdog reset */
+static WDGM_ResetInfo_t WDGM_resetInfo;
+
+static u16 WDGM_arrCheckInMs[WDGM_ENTITIES_COUNT];    /**< the uptime (low 16 bits) of the last check-in */
+static u16 WDGM_arrOverruns[WDGM_ENTITIES_COUNT];     /**< the missed budgets */
+static Std_Bool_t WDGM_arrIsLate[WDGM_ENTITIES_COUNT]; /**< the entity is late now (an overrun is counted once) */
+
+#endif /* WDGM_PRIVATE_H_ */
@@ -0,0 +1,64 @@
+/**
+ * @file PROF_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the profiler.
+ *         - enable/disable the instrumentation (the probes compile away when it is disabled)
+ *         - the probes
+ *         - enable/disable the super-loop latency monitor and its number of tags
+ *         - the number of histogram buckets
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef PROF_LCFG_H_
+#define PROF_LCFG_H_
+
+#define PROF_OFF                  0
+#define PROF_ON                   1
+
+/**
+ * @brief Enables the profiler.
+ *
+ * - PROF_OFF : PROF_BEGIN()/PROF_END() expand to nothing, the profiler table is not compiled.
+ * - PROF_ON  : every probe costs two uptime reads (about 10us at 8MHz) and sizeof(PROF_Probe_t) bytes of RAM.
+ */
+#define PROF_ENABLE               PROF_OFF
+
+/**
+ * @brief The probes (one measured section each), a probe must not be nested in itself.
+ */
+typedef enum {
+	PROF_STATE_MACHINE,     /* task_control()                          */
+	PROF_DISPLAY_UPDATE,    /* display_update()                        */
+	PROF_LCD_WRITESTR,      /* LCD_WriteStr() of the status line       */
+	PROF_KEYPAD_GETKEY,     /* KEYPAD_GetKey()                         */
+	PROF_ISR_SECOND,        /* TIMER1 compare match A (cooking second) */
+	PROF_ISR_DOOR,          /* door EXTI callback                      */
+	PROF_ISR_RTC,           /* RTC second callback                     */
+	PROF_PROBES_COUNT
+	}PROF_ProbeId_t;
+
+/**
+ * @brief Enables the super-loop latency monitor (PROF_LOOP_MARK()), independently of PROF_ENABLE.
+ *
+ * - PROF_OFF : PROF_LOOP_MARK() expands to nothing.
+ * - PROF_ON  : every loop iteration costs one uptime read, the monitor costs PROF_LOOP_TAGS*sizeof(PROF_Stats_t) bytes of RAM.
+ */
+#define PROF_LOOP_MONITOR         PROF_ON
+
+/**
+ * @brief The number of tags of the loop monitor, an iteration is recorded under the tag given to PROF_LOOP_MARK()
+ *        (main.c: the states STATE_t).
+ */
+#define PROF_LOOP_TAGS            5
+
+/**
+ * @brief The number of log2 buckets of the histograms: bucket 0 is 0 counts, bucket k is [2^(k-1),2^k) counts,
+ *        the last bucket collects everything longer.
+ *        With 8us counts: bucket 1 is 8us, bucket 8 is [1ms,2ms), bucket 11 is 8ms and longer.
+ */
+#define PROF_BUCKETS              12
+
+#endif /* PROF_LCFG_H_ */
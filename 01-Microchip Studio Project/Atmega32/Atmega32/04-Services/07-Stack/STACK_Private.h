@@ -0,0 +1,68 @@
+/**
+ * @file STACK_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private macros and functions of the stack monitor.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef STACK_PRIVATE_H_
+#define STACK_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#if defined(HOST_BUILD)
+/**
+ * @brief The host build (05-Host) runs on the host stack: an unused area is painted before main() (constructor),
+ *        the monitor always reports it free.
+ */
+#define STACK_HOST_AREA_SIZE      256
+static u8 STACK_au8HostArea[STACK_HOST_AREA_SIZE];
+
+#define STACK_BOTTOM              (&STACK_au8HostArea[0])
+#define STACK_TOP                 (&STACK_au8HostArea[STACK_HOST_AREA_SIZE-1])
+#define STACK_INIT_SECTION        __attribute__((constructor))
+#else
+/**
+ * @brief The linker symbols: the end of the static data (.data, .bss, .noinit) and the top of the stack (RAMEND).
+ */
+extern u8 __heap_start;
+extern u8 __stack;
+
+#define STACK_BOTTOM              (&__heap_start)
+#define STACK_TOP                 (&__stack)
+
+/**
+ * @brief The startup code section of the painting: after the stack pointer and the zero register are set (.init2),
+ *        before .data and .bss are initialized (.init4) and before main().
+ */
+#define STACK_INIT_SECTION        __attribute__((naked,used,section(".init3")))
+#endif /* HOST_BUILD */
+
+#define STACK_SIZE                ((u16)(STACK_TOP-STACK_BOTTOM)+1)
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Paints the free RAM with STACK_PAINT_PATTERN (startup code, it is never called).
+ *
+ * @note It is naked and inlined in the startup code: it must not use the stack (no locals in the frame,
+ *       the optimization must be enabled) and must not return.
+ */
+void STACK_Paint(void) STACK_INIT_SECTION;
+
+#endif /* STACK_PRIVATE_H_ */
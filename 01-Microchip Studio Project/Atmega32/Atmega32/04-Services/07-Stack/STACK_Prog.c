@@ -0,0 +1,84 @@
+/**
+ * @file STACK_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the stack monitor.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see STACK_Interface.h
+ * @see STACK_Lcfg.h
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+
+// own module files
+#include "STACK_Interface.h"
+#include "STACK_Lcfg.h"
+#include "STACK_Private.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Paints the free RAM with STACK_PAINT_PATTERN (startup code, it is never called).
+ *        Nothing is on the stack yet: SP is RAMEND and the painting reaches it.
+ */
+void STACK_Paint(void)
+{
+	u8 *p=STACK_BOTTOM;
+
+	while (p<=STACK_TOP)
+	{
+		*p=STACK_PAINT_PATTERN;
+		p++;
+	}
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns the number of RAM bytes that were never used by the stack since reset.
+ */
+u16 STACK_GetFree(void)
+{
+	const u8 *p=STACK_BOTTOM;
+
+	while ((p<=STACK_TOP) && (*p==STACK_PAINT_PATTERN))
+	{
+		p++;
+	}
+	return (u16)(p-STACK_BOTTOM);
+}
+
+/**
+ * @brief Returns the deepest stack use since reset in bytes (the high-water mark).
+ */
+u16 STACK_HighWater(void)
+{
+	return STACK_SIZE-STACK_GetFree();
+}
+
+/**
+ * @brief Checks the free RAM against the safety margin.
+ */
+Std_Error_t STACK_Check(void)
+{
+	Std_Error_t error=STD_OK;
+
+	if (STACK_GetFree()<STACK_MARGIN_BYTES)
+	{
+		error=STD_NOK;
+	}
+	return error;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file TRACE_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the trace recorder.
+ *         - enable/disable the recorder (the records compile away when it is disabled)
+ *         - the number of records of the ring
+ *         - freeze the trace on a fault
+ *         - the events
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef TRACE_LCFG_H_
+#define TRACE_LCFG_H_
+
+#define TRACE_OFF                 0
+#define TRACE_ON                  1
+
+/**
+ * @brief Enables the trace recorder.
+ *
+ * - TRACE_OFF : TRACE_RECORD()/TRACE_RECORD_ISR()/TRACE_FAULT()/TRACE_TICK() expand to nothing, the log is not compiled.
+ * - TRACE_ON  : a record is estimated at 18 cycles (21 with the interrupts guard of TRACE_RECORD()), counted by hand
+ *               on the expected instructions, not measured: the head, a frozen test, two stores, the masked head.
+ *               The bench checks it against the 20-cycle budget (budgets of bench_thresholds.json).
+ *               The uptime tick is estimated at 20 cycles, 10 more per record to stamp plus 12 when there is one.
+ *               The log is TRACE_SIZE*4+7 bytes of .noinit RAM.
+ */
+#define TRACE_ENABLE              TRACE_ON
+
+/**
+ * @brief The number of records of the ring (power of two, 2 to 32), the oldest one is overwritten.
+ */
+#define TRACE_SIZE                32
+
+/**
+ * @brief Freezes the trace on a fault (TRACE_FAULT(), a watchdog reset): the records before the fault are kept
+ *        until TRACE_Restart() or a power-on reset, the next records are dropped.
+ *
+ * - TRACE_OFF : a fault is recorded like the other events.
+ * - TRACE_ON  : a fault is recorded then the trace is frozen.
+ */
+#define TRACE_FREEZE_ON_FAULT     TRACE_ON
+
+/**
+ * @brief The events, the arg of a record depends on its event (trace_decode.py prints it by the name of the event).
+ */
+typedef enum {
+	TRACE_NONE,             /* an empty record, never recorded                         */
+	TRACE_RESET,            /* arg: the reset flags (WDT_RESET_xxx)                     */
+	TRACE_EVENT,            /* arg: the event of the state machine (TRANSATION_t)       */
+	TRACE_STATE,            /* arg: the new state (STATE_t)                             */
+	TRACE_ONOFF,            /* arg: system_OnOff() (Std_OnOff_t), when the outputs change */
+	TRACE_KEY,              /* arg: the character of the key                            */
+	TRACE_DOOR_ISR,         /* door EXTI callback                                       */
+	TRACE_HEATER_ISR,       /* arg: the heater switched ON (1) or OFF (0) by the power window ISRs */
+	TRACE_STACK_OVERFLOW,   /* arg: the priority of the task (fault)                    */
+	TRACE_INIT_FAILED,      /* arg: the error of the task creation (Std_Error_t, fault) */
+	TRACE_EVENTS_COUNT
+	}TRACE_EventId_t;
+
+#endif /* TRACE_LCFG_H_ */
@@ -0,0 +1,180 @@
+/**
+ * @file TRACE_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the trace recorder (the records are written by the macros).
+ *         Nothing is compiled when TRACE_ENABLE is TRACE_OFF.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see TRACE_Interface.h
+ * @see TRACE_Lcfg.h
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_interrupt.h"
+
+// MCAL
+#include "WDT_Interface.h"
+
+// own module files
+#include "TRACE_Lcfg.h"
+#include "TRACE_Interface.h"
+
+#if (TRACE_ENABLE==TRACE_ON)
+
+#include "TRACE_Private.h"
+
+#if ((TRACE_SIZE<2) || (TRACE_SIZE>32) || ((TRACE_SIZE&(TRACE_SIZE-1))!=0))
+#error "TRACE_SIZE must be a power of two from 2 to 32 (TRACE_Lcfg.h)"
+#endif
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+volatile TRACE_Log_t TRACE_Log TRACE_NOINIT; /**< survives the watchdog reset */
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns whether the log in .noinit RAM was written by this firmware (the magic, the size and the offsets).
+ */
+static Std_Bool_t TRACE_IsValid(void)
+{
+	return ((TRACE_Log.magic==TRACE_MAGIC) && (TRACE_Log.size==TRACE_SIZE) &&
+	        ((TRACE_Log.head&(u8)~(TRACE_FROZEN|TRACE_RING_MASK))==0) && ((TRACE_Log.head%TRACE_RECORD_SIZE)==0) &&
+	        (TRACE_Log.stamped<TRACE_RING_BYTES) && ((TRACE_Log.stamped%TRACE_RECORD_SIZE)==0))? STD_TRUE : STD_FALSE;
+}
+
+/**
+ * @brief Clears the log (the records are TRACE_NONE).
+ */
+static void TRACE_Clear(void)
+{
+	u8 i;
+
+	for (i=0; i<sizeof(TRACE_Log.records); i++)
+	{
+		TRACE_Log.records[i]=0;
+	}
+	TRACE_Log.size=TRACE_SIZE;
+	TRACE_Log.head=0;
+	TRACE_Log.stamped=0;
+	TRACE_Log.delta=0;
+	TRACE_Log.magic=TRACE_MAGIC;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Starts the trace after a reset.
+ */
+void TRACE_Init(u8 resetCause)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm();
+	if ((TRACE_IsValid()==STD_FALSE) || (resetCause&WDT_RESET_POWER_ON))
+	{
+		/* the RAM content is random after a power-on */
+		TRACE_Clear();
+	}
+	TRACE_STAMP();                   /*< the records of the last tick before the reset */
+	TRACE_Log.delta=TRACE_MAX_DELTA; /*< the time of the reset is unknown */
+	SREG=sreg;
+
+	if (resetCause&WDT_RESET_WATCHDOG)
+	{
+		TRACE_FAULT(TRACE_RESET,resetCause);
+	}
+	else
+	{
+		TRACE_RECORD(TRACE_RESET,resetCause);
+	}
+}
+
+/**
+ * @brief Freezes the trace: the current records are kept, the next ones are dropped.
+ */
+void TRACE_Freeze(void)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm();
+	TRACE_STAMP();                   /*< the records of the current tick */
+	TRACE_Log.head|=TRACE_FROZEN;    /*< the head keeps the offset of the oldest record */
+	SREG=sreg;
+}
+
+/**
+ * @brief Clears the trace and records again.
+ */
+void TRACE_Restart(void)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm();
+	TRACE_Clear();
+	SREG=sreg;
+}
+
+/**
+ * @brief Returns whether the trace is frozen.
+ */
+Std_Bool_t TRACE_IsFrozen(void)
+{
+	return ((TRACE_Log.head&TRACE_FROZEN)!=0)? STD_TRUE : STD_FALSE;
+}
+
+/**
+ * @brief Copies the records, the oldest first.
+ */
+Std_Error_t TRACE_GetRecords(TRACE_Record_t records[], u8 *count)
+{
+	Std_Error_t error=STD_OK;
+	u8 offset;
+	u8 i;
+	u8 sreg;
+
+	if ((records==NULL_PTR) || (count==NULL_PTR))
+	{
+		error=STD_NULL_POINTER;
+	}
+	else
+	{
+		*count=0;
+		sreg=SREG;
+		Global_Interrupt_Disable__asm(); /*< the ISRs write records */
+		TRACE_STAMP();
+		offset=(u8)(TRACE_Log.head&TRACE_RING_MASK); /*< the oldest record */
+		for (i=0; i<TRACE_SIZE; i++)
+		{
+			if (TRACE_Log.records[offset+2]!=TRACE_NONE) /*< not written since the clear */
+			{
+				records[*count].delta=(u16)TRACE_Log.records[offset]|((u16)TRACE_Log.records[offset+1]<<8);
+				records[*count].event=TRACE_Log.records[offset+2];
+				records[*count].arg=TRACE_Log.records[offset+3];
+				(*count)++;
+			}
+			offset=(u8)((offset+TRACE_RECORD_SIZE)&TRACE_RING_MASK);
+		}
+		SREG=sreg;
+	}
+	return error;
+}
+
+#endif /* TRACE_ENABLE==TRACE_ON */
@@ -36,6 +36,9 @@
 #include "Std_Types.h"
 #include "Utils_BitMath.h"
 #include "Utils_interrupt.h"
+#include "Std_Lib.h"
+#include "Protothread.h"
+#include "RingBuffer.h"
  
 
 //u16 CC1;
@@ -46,6 +49,14 @@
 #include "MCU_config.h"
 #include "DIO_Interface.h"
 #include "TIMERS_Interfacing.h"
+#include "TIMERS_Lcfg.h"
+#include "TIMERS_Calc.h"
+#include "EXTI_Interface.h"
+#include "EXTI_Lcfg.h"
+#include "SLEEP_Interface.h"
+#include "WDT_Interface.h"
+#include "UART_Lcfg.h"
+#include "UART_Interface.h"
 
 
 /*
@@ -54,6 +65,24 @@
 */
 #include "LCD_Interface.h"
 #include "Keypad_interface.h"
+#include "Turntable_Interface.h"
+
+/*
+* Include Services layer files
+*/
+#include "UPTIME_Lcfg.h"
+#include "UPTIME_Interface.h"
+#include "SCHED_Interface.h"
+#include "OS_Lcfg.h"
+#include "OS_Interface.h"
+#include "RTC_Interface.h"
+#include "WDGM_Lcfg.h"
+#include "WDGM_Interface.h"
+#include "PROF_Lcfg.h"
+#include "PROF_Interface.h"
+#include "STACK_Interface.h"
+#include "TRACE_Lcfg.h"
+#include "TRACE_Interface.h"
 
 /* ===================================================================== */
 /*                           LCD                                         */
@@ -78,11 +107,149 @@ enum {
 #define    LAMP    PC1
 #define    MOTOR   PC2
 
+/* door interlock modes */
+#define    DOOR_INTERLOCK_POLLED  0   /*< door sensor on PA2, polled by task_safety()/task_control() only */
+#define    DOOR_INTERLOCK_INT0    1   /*< door sensor on PD2 (INT0), needs the keypad rows moved off PD2 (Keypad_Lcfg.c) */
+#define    DOOR_INTERLOCK_INT1    2   /*< door sensor on PD3 (INT1), needs the keypad rows moved off PD3 (Keypad_Lcfg.c) */
+#define    DOOR_INTERLOCK_INT2    3   /*< door sensor on PB2 (INT2) */
+
+/**
+ * the door opening (rising edge) switches OFF the heater and the motor in the EXTI ISR
+ * and posts DOOR_OPENED_EVENT to the state machine (except DOOR_INTERLOCK_POLLED).
+ */
+#define    DOOR_INTERLOCK_MODE    DOOR_INTERLOCK_INT2
+
+/**
+ * the bound of the door edge to HEATER low in the interrupt modes, checked on the image with the latency and the
+ * execution time of the EXTI vector (05-tools/01-bench/isr.py), the host build does not time the code:
+ * the ISR path is estimated at DOOR_ISR_PATH_CYCLES (interrupt response, EXTI prologue, callback, Dio_WritePin),
+ * not measured yet, the rest of the bound is for the longest section with the interrupts disabled.
+ */
+#define    DOOR_ISR_PATH_CYCLES     90
+#define    DOOR_HEATER_OFF_MAX_US   100
+
 #define    START_PB       PA0
 #define    STOP_PB        PA1
-#define    DOOR_SENSOR    PA2
 #define    WEIGHT_SENSOR  PA3
 
+#if   (DOOR_INTERLOCK_MODE==DOOR_INTERLOCK_POLLED)
+#define    DOOR_SENSOR    PA2
+#elif (DOOR_INTERLOCK_MODE==DOOR_INTERLOCK_INT0)
+#define    DOOR_SENSOR    PD2
+#define    DOOR_EXTI      EXTI_INT0
+#define    DOOR_VECT      INT0_VECT
+#define    DOOR_ISR_OWNER INT0_ISR_OWNER
+#elif (DOOR_INTERLOCK_MODE==DOOR_INTERLOCK_INT1)
+#define    DOOR_SENSOR    PD3
+#define    DOOR_EXTI      EXTI_INT1
+#define    DOOR_VECT      INT1_VECT
+#define    DOOR_ISR_OWNER INT1_ISR_OWNER
+#elif (DOOR_INTERLOCK_MODE==DOOR_INTERLOCK_INT2)
+#define    DOOR_SENSOR    PB2
+#define    DOOR_EXTI      EXTI_INT2
+#define    DOOR_VECT      INT2_VECT
+#define    DOOR_ISR_OWNER INT2_ISR_OWNER
+#else
+#error "DOOR_INTERLOCK_MODE is not valid"
+#endif
+
+/* the door ISR of main.c (build-time binding, EXTI_Lcfg.h) or the callback of the driver ISR */
+#if (DOOR_INTERLOCK_MODE!=DOOR_INTERLOCK_POLLED) && (DOOR_ISR_OWNER==EXTI_ISR_APP)
+#define    DOOR_ISR_IS_APP  1
+#else
+#define    DOOR_ISR_IS_APP  0
+#endif
+
+#define    SYSTEM_EVENT_QUEUE_SIZE  8 /*< events posted by the ISRs to the state machine (getTransation()) */
+
+/**
+ * TIMER1 in CTC mode (OCR1A TOP): the compare match A every 1s counts down the cooking timer and starts
+ * the heater power window every HEATER_WINDOW_SECONDS, the compare match B switches OFF the heater
+ * when the ON time of the power level is over (time-proportioned power, no work in the tasks).
+ *
+ * The prescaler and TOP are computed from F_CPU at compile time (TIMERS_Calc.h):
+ * 1s = (SYSTEM_TIMER1_TOP+1) * 256 / 8MHz
+ */
+#define    SYSTEM_TIMER1_PERIOD_US  1000000UL
+#define    SYSTEM_TIMER1_DIV        TIMER_CALC_DIV(F_CPU,SYSTEM_TIMER1_PERIOD_US,16)
+#define    SYSTEM_TIMER1_PRESCALER  TIMER_CALC_PRE_CLK(SYSTEM_TIMER1_DIV)
+#define    SYSTEM_TIMER1_TOP        ((u16)TIMER_CALC_TOP(F_CPU,SYSTEM_TIMER1_PERIOD_US,16))
+#define    SYSTEM_TIMER1_COUNTS     ((u32)SYSTEM_TIMER1_TOP+1) /*< TIMER1 counts per second */
+
+#if (SYSTEM_TIMER1_DIV==0)
+#error "1s can't be generated exactly by TIMER1 from F_CPU"
+#endif
+
+#define    HEATER_WINDOW_SECONDS   10
+#define    HEATER_POWER_KEY        '+' /*< cycles the power levels (keypad_charArray[3][3]) */
+#define    CLOCK_SET_KEY           '*' /*< the 4 entered digits set the clock as hh:mm (keypad_charArray[3][0]) */
+#define    DELAYED_START_KEY       '#' /*< cycles the start delays (keypad_charArray[3][2]) */
+#define    DIAGNOSTICS_KEY         'D' /*< shows the next diagnostics page (keypad_charArray[0][3]) */
+#define    LOOP_REPORT_PERCENTILE  99
+
+/**
+ * delayed start: the CPU sleeps in Power-save (TIMER0/TIMER1 stopped, the RTC on TIMER2 keeps the time)
+ * and is woken up once per second by the RTC, it stays awake DELAYED_AWAKE_MS so every task runs once
+ * (the buttons must be held up to 1s to be seen).
+ */
+#define    DELAYED_AWAKE_MS        (TASK_DISPLAY_PERIOD+TASK_KEYPAD_PERIOD)
+
+/* idle modes (system_idle()) */
+#define    IDLE_SPIN               0   /*< no sleep: the dispatcher polls the releases again (the super loop before the sleep) */
+#define    IDLE_SLEEP              1   /*< Idle sleep until the next interrupt, Power-save in DELAYED_STATE */
+
+/**
+ * the idle mode, it can be set from the command line to measure the active cycles of both in simavr
+ * (05-tools/01-bench/isr.py --idle-mode both, the host port doesn't time the spinning code). Not recorded yet: the
+ * "about 5% active in standby" of IDLE_SLEEP is an estimate from instruction counts.
+ */
+#ifndef IDLE_MODE
+#define    IDLE_MODE               IDLE_SLEEP
+#endif
+
+/* the end of the heater ON time of a power level (percent of HEATER_WINDOW_SECONDS), folded at compile time */
+#define    HEATER_ON_COUNTS(percent)    (((u32)(percent)*HEATER_WINDOW_SECONDS*SYSTEM_TIMER1_COUNTS)/100)
+#define    HEATER_POWER_LEVEL(percent)  { (percent) , (u8)(HEATER_ON_COUNTS(percent)/SYSTEM_TIMER1_COUNTS) , \
+                                          (u16)(HEATER_ON_COUNTS(percent)%SYSTEM_TIMER1_COUNTS) }
+
+/* tasks periods and phases in ticks (SCHED_TICK_MS or OS_TICK_MS, both are UPTIME_TICK_MS 1ms) */
+#define    TASK_SAFETY_PERIOD      5
+#define    TASK_SAFETY_PHASE       0
+#define    TASK_CONTROL_PERIOD     10
+#define    TASK_CONTROL_PHASE      1
+#define    TASK_KEYPAD_PERIOD      50
+#define    TASK_KEYPAD_PHASE       3
+#define    TASK_DISPLAY_PERIOD     100
+#define    TASK_DISPLAY_PHASE      7
+#define    TASK_COUNT              4   /*< safety, control, keypad, display (the order of their creation) */
+
+/* preemptive kernel (OS_PREEMPTIVE==OS_ON in OS_Lcfg.h) priorities (0 is the highest) and stack sizes */
+#define    TASK_SAFETY_PRIORITY    0
+#define    TASK_CONTROL_PRIORITY   1
+#define    TASK_DISPLAY_PRIORITY   2
+#define    TASK_KEYPAD_PRIORITY    3
+#define    TASK_SAFETY_STACK       80
+#define    TASK_CONTROL_STACK      128
+#define    TASK_DISPLAY_STACK      128
+#define    TASK_KEYPAD_STACK       96
+
+/**
+ * control, display and keypad share the state machine and the screen data (currentState, isDisplayUpdateNeeded,
+ * the timer digits, displayBlinkPt, the LCD): with the preemptive kernel they lock the scheduler up to the highest
+ * of their priorities, so they don't preempt each other, task_safety and the interrupts still preempt them.
+ * The cooperative tasks run to completion: nothing to lock.
+ */
+#define    TASK_SHARED_CEILING     TASK_CONTROL_PRIORITY
+#if (OS_PREEMPTIVE==OS_ON)
+#define    TASK_SHARED_LOCK()      OS_Lock(TASK_SHARED_CEILING)
+#define    TASK_SHARED_UNLOCK()    OS_Unlock()
+#else
+#define    TASK_SHARED_LOCK()
+#define    TASK_SHARED_UNLOCK()
+#endif
+
+#define    SYSTEM_GET_TICK()       ((u16)UPTIME_GetMs()) /*< milliseconds (wraps around) for the u16 timestamps */
+
 /*TESTING*/
 /*
 #define	   PLUS_PB        PA4
@@ -101,7 +268,8 @@ typedef enum
 	IDLE_OFF_STATE,
 	ON_STATE,
 	PAUSE_STATE,
-	DOOR_OPENED_STATE
+	DOOR_OPENED_STATE,
+	DELAYED_STATE
 	}STATE_t;
 	
 typedef enum 
@@ -114,9 +282,17 @@ typedef enum
 	FOOD_WEIGHT_INVALID_EVENT,
 	TIME_ADJUSTED_EVENT,
 	TIME_NOT_ADJUSTED_EVENT,
+	TURNTABLE_STALLED_EVENT,
 	NO_TRANSATION
 	}TRANSATION_t;
 
+typedef struct
+{
+	u8 percent;    /*< percent of HEATER_WINDOW_SECONDS */
+	u8 offSecond;  /*< the second of the window in which the heater is switched OFF (HEATER_WINDOW_SECONDS: never) */
+	u16 offCount;  /*< the OCR1B count of that second */
+	}HEATER_POWER_t;
+
 /*--------------------------------*/
 /*                                */
 /*          Global Var            */
@@ -127,6 +303,8 @@ STATE_t historyState=IDLE_OFF_STATE;
 
 TRANSATION_t transation;
 
+RINGBUF_DEFINE(systemEventQueue,SYSTEM_EVENT_QUEUE_SIZE); /*< producer: ISRs , consumer: getTransation() */
+
 
 volatile u16 opTime=0; /*< global becuase it used in (getTimeTransation(),getTimeUpdate(),resetTimer(),ISR) & volatile becuase it used in ISR */
 
@@ -138,6 +316,18 @@ u8 volatile secondTens='0';
 u8 volatile minuteUnits='0';
 u8 volatile minuteTens='0';
 
+const HEATER_POWER_t heaterPowerLevels[]={ HEATER_POWER_LEVEL(100) , HEATER_POWER_LEVEL(70) ,
+                                            HEATER_POWER_LEVEL(50)  , HEATER_POWER_LEVEL(30) }; /*< selected by HEATER_POWER_KEY */
+u8 heaterPowerIndex=0;
+u8 volatile heaterWindowSecond=0;  /*< the second of the power window [0,HEATER_WINDOW_SECONDS-1], counted by the COMPA ISR */
+u8 volatile heaterOffSecond=HEATER_WINDOW_SECONDS; /*< the second of the window in which the COMPB ISR switches OFF the heater */
+
+const u16 delayedStartMinutes[]={ 0 , 15 , 30 , 60 , 120 , 240 , 480 }; /*< selected by DELAYED_START_KEY (0: start now) */
+u8 delayedStartIndex=0;
+u16 volatile delayedStartSeconds=0;                  /*< counted down by the RTC ISR in DELAYED_STATE */
+Std_Bool_t volatile isDelayedStartDue=STD_FALSE;     /*< set by the RTC ISR when the delay is over */
+u32 volatile systemWakeMs=0;                         /*< the uptime of the last RTC second (wake-up from Power-save) */
+
 
 /*------------------------------------------------------------------------------*/
 /*                                                                              */
@@ -156,10 +346,14 @@ typedef enum
 	DISPLAY_PUT_FOOD,
 	DISPLAY_RESET,
 	DISPLAY_DONE,
+	DISPLAY_TURNTABLE_STALLED,
+	DISPLAY_WATCHDOG_RESET,
+	DISPLAY_STACK_LOW,
 	DISPLAY_TIMER_NOT_ADJUSTED,
 	DISPLAY_SET_TIMER_PLEASE,
 	DISPLAY_RUNNING,
 	DISPLAY_PAUSED,
+	DISPLAY_DELAYED,
 	DISPLAY_NO_TRANSACTION
 }DISPLAY_t;
 
@@ -172,10 +366,52 @@ typedef enum
 #define DISPLAY_STRING_COL     1
 #define DISPLAY_TIMER_ROW      3
 #define DISPLAY_TIMER_COL      8
+#define DISPLAY_POWER_ROW      3
+#define DISPLAY_POWER_COL      1
+#define DISPLAY_DELAY_ROW      3
+#define DISPLAY_DELAY_COL      15
+#define DISPLAY_CLOCK_ROW      1
+#define DISPLAY_CLOCK_COL      13
 
-#define DISPLAY_DELAY          500
 #define DISPLAY_BLINK_DELAY	   750
+#define DISPLAY_BLINK_TIMES	   2
 #define DISPLAY_EMPTY_LINE     "                    "
+#define DISPLAY_EMPTY_TIMER    "     "
+#define DISPLAY_EMPTY_DELAY    "      "
+#if (PROF_LOOP_MONITOR==PROF_ON)
+#define DISPLAY_DIAG_LOOP      PROF_LOOP_TAGS          /*< pages 0..4: the loop latency of the states */
+#else
+#define DISPLAY_DIAG_LOOP      0
+#endif
+#define DISPLAY_DIAG_STACK     DISPLAY_DIAG_LOOP       /*< the stack high-water mark page */
+#if (PROF_LOOP_MONITOR==PROF_ON)
+#define DISPLAY_DIAG_DUMP      (DISPLAY_DIAG_STACK+1)  /*< the histograms of the states sent over the USART */
+#else
+#define DISPLAY_DIAG_DUMP      DISPLAY_DIAG_STACK      /*< no histogram */
+#endif
+#define DISPLAY_DIAG_NONE      (DISPLAY_DIAG_DUMP+1)   /*< no diagnostics page */
+
+/**
+ * the histogram dump (DISPLAY_DIAG_DUMP): a header line, two lines per state then, with the cooperative scheduler, one
+ * line per task (in the order of their creation), one line per task_display() run (UART_Write() is all-or-nothing,
+ * a line waits while the TX buffer is full):
+ *   LOOP US/COUNT:<us per TIMER0 count> BUCKETS:<PROF_BUCKETS>
+ *   LOOP S<state> N:<iterations> W:<worst us> P99:<p99 us>
+ *   HIST S<state> <bucket 0> ... <bucket PROF_BUCKETS-1>
+ *   TASK T<task> N:<runs> O:<overruns> W:<wcet us> L:<last us>
+ * bucket 0 counts the iterations of 0 counts, bucket b the iterations of [2^(b-1),2^b) counts (the last one: above),
+ * the buckets are halved together when one of them reaches 255 (PROF_Stats_t).
+ * The task statistics are the ones of SCHED_GetTaskStats() (SCHED_TaskStats_t), the kernel doesn't record them.
+ */
+#if (OS_PREEMPTIVE==OS_ON)
+#define DIAG_TASK_LINES        0
+#else
+#define DIAG_TASK_LINES        TASK_COUNT
+#endif
+#define DIAG_LOOP_LINES        (1+(2*PROF_LOOP_TAGS))
+#define DIAG_DUMP_LINES        (DIAG_LOOP_LINES+DIAG_TASK_LINES)
+#define DIAG_DUMP_DONE         0xFF
+#define DIAG_LINE_SIZE         UART_TX_SIZE
 
 /*--------------------------------*/
 /*                                */
@@ -187,10 +423,14 @@ const u8 *displayString[]={
 							">>>>>>Put Food<<<<<<" ,
 							">>>>>>>RESET<<<<<<<<" ,
 							">>>>>>>>DONE<<<<<<<<" ,
+							">>Turntable Stall<<<" ,
+							">>>Watchdog Reset<<<" ,
+							">>>>>Stack Low<<<<<<" ,
 							">Timer Not Adjusted<" ,
 							">>Set Timer Please<<" ,
 							">>>>>>RUNNING<<<<<<<" ,
-							">>>>>>>PAUSED<<<<<<<" 
+							">>>>>>>PAUSED<<<<<<<" ,
+							">>>Delayed Start<<<<" 
 							/*
 							"    Door Opened     " ,
 							"     Put Food       " ,
@@ -202,6 +442,22 @@ const u8 *displayString[]={
 							"      PAUSED        " ,*/
 						  };
 
+Std_Bool_t isLcdReady=STD_FALSE; /*< the LCD is initialized by task_display() (LCD_InitAsync()) */
+Std_Bool_t volatile isClockUpdateNeeded=STD_FALSE; /*< set every second by the RTC ISR */
+u8 diagnosticsPage=DISPLAY_DIAG_NONE; /*< the page shown by diagnosticsDisplay(), selected by DIAGNOSTICS_KEY */
+Std_Bool_t isDiagnosticsNeeded=STD_FALSE;
+u8 diagnosticsDumpLine=DIAG_DUMP_DONE; /*< the next line of the histogram dump (DISPLAY_DIAG_DUMP) */
+Std_Bool_t isStackLowReported=STD_FALSE; /*< the stack margin failure is blinked once */
+#if (OS_PREEMPTIVE!=OS_ON)
+SCHED_TaskId_t taskIds[TASK_COUNT]; /*< the ids of the cooperative tasks (SCHED_GetTaskStats()) */
+#endif
+
+/* blinking message (DISPLAY_DOOR_OPENED .. DISPLAY_TIMER_NOT_ADJUSTED) protothread */
+DISPLAY_t displayBlinkMessage=DISPLAY_NO_TRANSACTION; /*< DISPLAY_NO_TRANSACTION: no blinking */
+PT_t displayBlinkPt=0;
+u16 displayBlinkTimestamp;
+u8 displayBlinkCount;
+
 
 /*------------------------------------------------------------------------------*/
 /*                                                                              */
@@ -215,8 +471,17 @@ const u8 *displayString[]={
 /*                                */
 /*--------------------------------*/
 void displayStatus(DISPLAY_t display);
+PT_Status_t displayBlink(u16 nowMs);
 void display_update(DISPLAY_t display);
 void timeDisplay(void);
+void powerDisplay(void);
+void delayDisplay(u16 minutes);
+void clockDisplay(void);
+void displayWelcome(void);
+void diagnosticsDisplay(u8 page);
+void diagnosticsDump(void);
+u8 diagnosticsAppendNum(u8 line[], u8 len, u32 num);
+u8 diagnosticsAppendStr(u8 line[], u8 len, const char *str);
 
 
 /*--------------------------------*/
@@ -243,9 +508,49 @@ void resetTimer(void);
 /*       SYSTEM PROTOTYPES        */
 /*                                */
 /*--------------------------------*/
-void system_timerOvf(void);
+#if (TIMER1_COMPA_ISR_OWNER==TIMER_ISR_DRIVER)
+void system_timerSecond(void);
+#endif
+#if (TIMER1_COMPB_ISR_OWNER==TIMER_ISR_DRIVER)
+void system_heaterOff(void);
+#endif
+void system_setPower(u8 index);
 void system_OnOff(Std_OnOff_t status);
 void system_init(void);
+void system_stackOverflow(u8 priority);
+void system_failSafe(TRACE_EventId_t fault, u8 arg);
+#if (DOOR_ISR_IS_APP==0)
+void system_doorOpened(void);
+#endif
+Std_Bool_t system_isReadyToStart(void);
+void system_setDelayedStart(u16 seconds);
+void system_rtcSecond(void);
+void system_idle(void);
+#if defined(HOST_BUILD)
+u8 system_getState(void);
+#endif
+
+/*--------------------------------*/
+/*                                */
+/*        TASKS PROTOTYPES        */
+/*                                */
+/*--------------------------------*/
+void task_safety(void);
+void task_control(void);
+void task_keypad(void);
+void task_display(void);
+
+#if (OS_PREEMPTIVE==OS_ON)
+OS_STACK_DEFINE(safetyStack,TASK_SAFETY_STACK);
+OS_STACK_DEFINE(controlStack,TASK_CONTROL_STACK);
+OS_STACK_DEFINE(displayStack,TASK_DISPLAY_STACK);
+OS_STACK_DEFINE(keypadStack,TASK_KEYPAD_STACK);
+
+OS_PERIODIC_TASK(os_task_safety,task_safety,TASK_SAFETY_PERIOD)
+OS_PERIODIC_TASK(os_task_control,task_control,TASK_CONTROL_PERIOD)
+OS_PERIODIC_TASK(os_task_display,task_display,TASK_DISPLAY_PERIOD)
+OS_PERIODIC_TASK(os_task_keypad,task_keypad,TASK_KEYPAD_PERIOD)
+#endif
 
 int main(void)
 {
@@ -256,136 +561,310 @@ int main(void)
 
 	while (1) /*< Super_Loop */
 	{
-		transation=getTransation();
-			
-		switch (currentState)
-		{
-			/***************************************************/
-			/*                IDLE_OFF_STATE                   */
-			/***************************************************/
-			case IDLE_OFF_STATE:
-				keyPad_read();
-				display_update(DISPLAY_SET_TIMER_PLEASE);
+#if (OS_PREEMPTIVE==OS_ON)
+		//idle task: the tasks are preempted/resumed by the kernel, it only runs when no task is ready
+		WDGM_MainFunction(); /*< a starved task stops the watchdog reset */
+		Global_Interrupt_Disable__asm();
+		system_idle(); /*< sleeps until the next interrupt (tick, door, timers, RTC) */
+#else
+		PROF_LOOP_MARK(currentState); /*< the iteration duration: the released tasks or the idle sleep until the next tick */
+		SCHED_Dispatch(); /*< runs the released tasks (safety, control, keypad, display) */
+		WDGM_MainFunction(); /*< resets the watchdog when every task checked in within its budget */
+#endif
+	}//while(1) Super_Loop
+}//main
+
+
+/*--------------------------------*/
+/*                                */
+/*        TASKS FUNCTIONS         */
+/*                                */
+/*--------------------------------*/
+/**
+ * @brief The safety interlock task (highest priority): the heater and the motor are OFF while the door is opened,
+ *        whatever the state machine is doing.
+ */
+void task_safety(void)
+{
+	WDGM_CheckIn(WDGM_SAFETY);
+	if (Dio_ReadPin(DOOR_SENSOR)==DIO_VOLT_HIGH)//opened
+	{
+		Dio_WritePin(HEATER,DIO_VOLT_LOW);
+		Dio_WritePin(MOTOR,DIO_VOLT_LOW);
+	}
+}
+
+/**
+ * @brief The state machine task: reads the buttons and sensors and switches the states.
+ *        The state screens are drawn by task_display().
+ */
+void task_control(void)
+{
+	STATE_t previousState;
+	
+	WDGM_CheckIn(WDGM_CONTROL);
+	TASK_SHARED_LOCK();
+	previousState=currentState;
+	PROF_BEGIN(PROF_STATE_MACHINE);
+	transation=getTransation();
+	if (transation!=NO_TRANSATION)
+	{
+		TRACE_RECORD(TRACE_EVENT,transation);
+	}
+		
+	switch (currentState)
+	{
+		/***************************************************/
+		/*                IDLE_OFF_STATE                   */
+		/***************************************************/
+		case IDLE_OFF_STATE:
+			switch (transation)
+			{
+				case START_EVENT:
+					if (system_isReadyToStart()==STD_FALSE) /*< door opened, no food or timer not adjusted */
+					{
+						//the reason is displayed
+					}
+					else if (delayedStartMinutes[delayedStartIndex]>0) /*< the cooking starts after the selected delay */
+					{
+						system_setDelayedStart(delayedStartMinutes[delayedStartIndex]*60);
+						currentState=DELAYED_STATE;
+						isDisplayUpdateNeeded=STD_TRUE;
+					}
+					else /*< the system ready to run */
+					{
+						currentState=ON_STATE; /*< switch the current state to the state should be executed */
+						isDisplayUpdateNeeded=STD_TRUE; /*< changing this flag to true indicate that the display_update() function must update the LCD*/
+						historyState=IDLE_OFF_STATE;   /*< store the history state is needed for system_OnOff() function*/
+					}
+				break;
+		
+				case CANCEL_EVENT:
+					display_update(DISPLAY_RESET);
+					resetTimer();
+					currentState=IDLE_OFF_STATE; /*< switch the current state to the state should be executed */
+				break;	
 				
-				switch (transation)
-				{
-					case START_EVENT:
-						if (Dio_ReadPin(DOOR_SENSOR)==DIO_VOLT_HIGH) /*< check if door is opened*/
-						{
-							display_update(DISPLAY_DOOR_OPENED);	
-						}
-						else if (getFoodTransation()==FOOD_WEIGHT_INVALID_EVENT) /*< check if no food exist */
-						{
-							display_update(DISPLAY_PUT_FOOD);
-						} 
-						else if (getTimeTransation()==TIME_NOT_ADJUSTED_EVENT) /*< check if Timer not adjusted */
-						{
-							display_update(DISPLAY_TIMER_NOT_ADJUSTED);
-						} 
-						else /*< the system ready to run */
-						{
-							currentState=ON_STATE; /*< switch the current state to the state should be executed */
-							isDisplayUpdateNeeded=STD_TRUE; /*< changing this flag to true indicate that the display_update() function must update the LCD*/
-							historyState=IDLE_OFF_STATE;   /*< store the history state is needed for system_OnOff() function*/
-						}
-					break;
+				default:
+					//do nothing
+				break;	
+			}
+		break;
+		
+		/***************************************************/
+		/*                   ON_STATE                      */
+		/***************************************************/
+		case ON_STATE:
+		   
+		   /* moved in else to avoid print running and run for a while before check and result of check is goto paused state
+			display_update(DISPLAY_RUNNING);
+			system_OnOff(STD_ON);
+		    */
+			if ((transation==DOOR_OPENED_EVENT) || (Dio_ReadPin(DOOR_SENSOR)==DIO_VOLT_HIGH))//opened
+			{
+				system_OnOff(STD_OFF); /*< switch OFF the system to because next state is paused state*/
+				display_update(DISPLAY_DOOR_OPENED);
+				currentState=PAUSE_STATE; /*< switch the current state to the state should be executed */
+				isDisplayUpdateNeeded=STD_TRUE; /*< changing this flag to true indicate that the display_update() function must update the LCD*/
+			}
+			else if (transation==TURNTABLE_STALLED_EVENT)
+			{
+				system_OnOff(STD_OFF); /*< switch OFF the system to because next state is paused state*/
+				display_update(DISPLAY_TURNTABLE_STALLED);
+				currentState=PAUSE_STATE; /*< switch the current state to the state should be executed */
+				isDisplayUpdateNeeded=STD_TRUE; /*< changing this flag to true indicate that the display_update() function must update the LCD*/
+			}
+			else if (getFoodTransation()==FOOD_WEIGHT_INVALID_EVENT)
+			{
+				system_OnOff(STD_OFF); /*< switch OFF the system to because next state is paused state*/
+				display_update(DISPLAY_PUT_FOOD); 
+				currentState=PAUSE_STATE; /*< switch the current state to the state should be executed */
+				isDisplayUpdateNeeded=STD_TRUE; /*< changing this flag to true indicate that the display_update() function must update the LCD*/
+			}
+			else if (getTimeUpdate()==STD_DONE) /*< timer is counting down to zero */
+			{
+				system_OnOff(STD_OFF); /*< switch OFF the system to because next state is paused state*/
+				display_update(DISPLAY_DONE);
+				currentState=IDLE_OFF_STATE; /*< switch the current state to the state should be executed */
+				resetTimer();
+			}
+			else
+			{
+				system_OnOff(STD_ON);
+			}
 			
-					case CANCEL_EVENT:
-						display_update(DISPLAY_RESET);
-						resetTimer();
-						currentState=IDLE_OFF_STATE; /*< switch the current state to the state should be executed */
-					break;	
-					
-					default:
-						//do nothing
-					break;	
-				}
-			break;
 			
-			/***************************************************/
-			/*                   ON_STATE                      */
-			/***************************************************/
-			case ON_STATE:
-			   
-			   /* moved in else to avoid print running and run for a while before check and result of check is goto paused state
-				display_update(DISPLAY_RUNNING);
-				system_OnOff(STD_ON);
-			    */
-				if (Dio_ReadPin(DOOR_SENSOR)==DIO_VOLT_HIGH)//opened
-				{
+			switch (transation)
+			{
+				case START_EVENT:
+					currentState=ON_STATE;
+				break;
+				
+				case CANCEL_EVENT:
 					system_OnOff(STD_OFF); /*< switch OFF the system to because next state is paused state*/
-					display_update(DISPLAY_DOOR_OPENED);
-					currentState=PAUSE_STATE; /*< switch the current state to the state should be executed */
+					currentState=PAUSE_STATE;/*< switch the current state to the state should be executed */
 					isDisplayUpdateNeeded=STD_TRUE; /*< changing this flag to true indicate that the display_update() function must update the LCD*/
-				}
-				else if (getFoodTransation()==FOOD_WEIGHT_INVALID_EVENT)
-				{
-					system_OnOff(STD_OFF); /*< switch OFF the system to because next state is paused state*/
-					display_update(DISPLAY_PUT_FOOD); 
-					currentState=PAUSE_STATE; /*< switch the current state to the state should be executed */
+				break;
+				
+				default:
+					//do nothing
+				break;
+			}				
+		break;
+		
+		case PAUSE_STATE:	
+			switch (transation)
+			{
+				case START_EVENT: 
+					currentState=ON_STATE;
+					historyState=PAUSE_STATE;
 					isDisplayUpdateNeeded=STD_TRUE; /*< changing this flag to true indicate that the display_update() function must update the LCD*/
-				}
-				else if (getTimeUpdate()==STD_DONE) /*< timer is counting down to zero */
-				{
-					system_OnOff(STD_OFF); /*< switch OFF the system to because next state is paused state*/
-					display_update(DISPLAY_DONE);
-					currentState=IDLE_OFF_STATE; /*< switch the current state to the state should be executed */
+				break;
+				
+				case CANCEL_EVENT:
+					display_update(DISPLAY_RESET);
 					resetTimer();
+					currentState=IDLE_OFF_STATE; /*< switch the current state to the state should be executed */
+				break;
+				
+				default:
+					//do nothing
+				break;
+			}
+		break;
+		
+		/***************************************************/
+		/*                 DELAYED_STATE                   */
+		/***************************************************/
+		case DELAYED_STATE:
+			if (transation==CANCEL_EVENT)
+			{
+				system_setDelayedStart(0);
+				display_update(DISPLAY_RESET);
+				resetTimer();
+				currentState=IDLE_OFF_STATE; /*< switch the current state to the state should be executed */
+				isDisplayUpdateNeeded=STD_TRUE;
+			}
+			else if (isDelayedStartDue==STD_TRUE)
+			{
+				isDelayedStartDue=STD_FALSE;
+				if (system_isReadyToStart()==STD_TRUE) /*< checked again: the door or the food may have changed */
+				{
+					currentState=ON_STATE;
+					historyState=IDLE_OFF_STATE; /*< store the history state is needed for system_OnOff() function*/
 				}
 				else
 				{
-					// new commit 
-					display_update(DISPLAY_RUNNING);
-					system_OnOff(STD_ON);
+					currentState=IDLE_OFF_STATE; /*< the reason is displayed, the settings are kept */
 				}
-				
-				
-				switch (transation)
-				{
-					case START_EVENT:
-						currentState=ON_STATE;
-					break;
-					
-					case CANCEL_EVENT:
-						system_OnOff(STD_OFF); /*< switch OFF the system to because next state is paused state*/
-						currentState=PAUSE_STATE;/*< switch the current state to the state should be executed */
-						isDisplayUpdateNeeded=STD_TRUE; /*< changing this flag to true indicate that the display_update() function must update the LCD*/
-					break;
-					
-					default:
-						//do nothing
-					break;
-				}				
+				isDisplayUpdateNeeded=STD_TRUE;
+			}
+		break;
+		
+		default:
+			//do nothing
+		break;
+	}//switch (currentState)
+	if (currentState!=previousState)
+	{
+		TRACE_RECORD(TRACE_STATE,currentState);
+	}
+	PROF_END(PROF_STATE_MACHINE);
+	TASK_SHARED_UNLOCK();
+}
+
+/**
+ * @brief The keypad task: the timer digits can only be entered in IDLE_OFF_STATE.
+ */
+void task_keypad(void)
+{
+	WDGM_CheckIn(WDGM_KEYPAD);
+	TASK_SHARED_LOCK();
+	if (currentState==IDLE_OFF_STATE)
+	{
+		keyPad_read();
+	}
+	TASK_SHARED_UNLOCK();
+}
+
+/**
+ * @brief The display task: initializes the LCD, blinks the messages and draws the screen of the current state when it is needed.
+ *        The LCD waits and the blinking are protothreads, so the task never blocks.
+ */
+void task_display(void)
+{
+	u16 seconds;
+	u8 sreg;
+	
+	WDGM_CheckIn(WDGM_DISPLAY);
+	TASK_SHARED_LOCK();
+	if (isLcdReady==STD_FALSE)
+	{
+		if (LCD_InitAsync(LCD_ID1,SYSTEM_GET_TICK())==PT_ENDED)
+		{
+			isLcdReady=STD_TRUE;
+			displayWelcome();
+		}
+	}
+	else if ((displayBlinkMessage!=DISPLAY_NO_TRANSACTION) && PT_IS_RUNNING(displayBlink(SYSTEM_GET_TICK())))
+	{
+		//the state screen is drawn after the blinking ends
+	}
+	else
+	{
+		PROF_BEGIN(PROF_DISPLAY_UPDATE);
+		switch (currentState)
+		{
+			case IDLE_OFF_STATE:
+				display_update(DISPLAY_SET_TIMER_PLEASE);
+			break;
+			
+			case ON_STATE:
+				display_update(DISPLAY_RUNNING);
 			break;
 			
-			case PAUSE_STATE:	
+			case PAUSE_STATE:
 				display_update(DISPLAY_PAUSED);
-				switch (transation)
-				{
-					case START_EVENT: 
-						currentState=ON_STATE;
-						historyState=PAUSE_STATE;
-						isDisplayUpdateNeeded=STD_TRUE; /*< changing this flag to true indicate that the display_update() function must update the LCD*/
-					break;
-					
-					case CANCEL_EVENT:
-						display_update(DISPLAY_RESET);
-						resetTimer();
-						currentState=IDLE_OFF_STATE; /*< switch the current state to the state should be executed */
-					break;
-					
-					default:
-						//do nothing
-					break;
-				}
+			break;
+			
+			case DELAYED_STATE:
+				display_update(DISPLAY_DELAYED);
 			break;
 			
 			default:
 				//do nothing
 			break;
-		}//switch (currentState)
-	}//while(1) Super_Loop
-}//main
+		}
+		PROF_END(PROF_DISPLAY_UPDATE);
+	}
+	
+	if ((isLcdReady==STD_TRUE) && (isClockUpdateNeeded==STD_TRUE))
+	{
+		isClockUpdateNeeded=STD_FALSE;
+		clockDisplay();
+		if (currentState==DELAYED_STATE)
+		{
+			sreg=SREG;
+			Global_Interrupt_Disable__asm(); /*< u16 read is not atomic on AVR */
+			seconds=delayedStartSeconds;
+			SREG=sreg;
+			delayDisplay((seconds+59)/60); /*< the remaining minutes */
+		}
+		if ((isStackLowReported==STD_FALSE) && (STACK_Check()!=STD_OK)) /*< once per second */
+		{
+			isStackLowReported=STD_TRUE;
+			display_update(DISPLAY_STACK_LOW);
+		}
+	}
+	
+	if ((isLcdReady==STD_TRUE) && (isDiagnosticsNeeded==STD_TRUE))
+	{
+		isDiagnosticsNeeded=STD_FALSE;
+		diagnosticsDisplay(diagnosticsPage);
+	}
+	diagnosticsDump();
+	TASK_SHARED_UNLOCK();
+}
 
 
 
@@ -396,33 +875,19 @@ int main(void)
 /*--------------------------------*/
 void displayStatus(DISPLAY_t display)
 {
-	u8 i;
 	if ( (display>=DISPLAY_DOOR_OPENED)&&(display<=DISPLAY_TIMER_NOT_ADJUSTED))
 	{
 		//"    Door Opened     " , "     Put Food       " , "       RESET        " , "        DONE        " , " Timer Not Adjusted "
-		for (i=0 ; i<2 ;i++ )
-		{
-			//clear
-			LCD_SetCursor(LCD_ID1,DISPLAY_STRING_ROW,DISPLAY_STRING_COL);
-			LCD_WriteStr(LCD_ID1,(u8*)DISPLAY_EMPTY_LINE);
-			
-			_delay_ms(DISPLAY_BLINK_DELAY/2);
-			//display
-			LCD_SetCursor(LCD_ID1,DISPLAY_STRING_ROW,DISPLAY_STRING_COL);
-			LCD_WriteStr(LCD_ID1,(u8*)displayString[display]);
-			
-			_delay_ms(DISPLAY_BLINK_DELAY);
-		}
+		displayBlinkMessage=display; /*< the blinking is done by displayBlink() in task_display() */
+		PT_INIT(&displayBlinkPt);
 	}
-	else if ((display>=DISPLAY_SET_TIMER_PLEASE)&&(display<=DISPLAY_PAUSED))
+	else if ((display>=DISPLAY_SET_TIMER_PLEASE)&&(display<=DISPLAY_DELAYED))
 	{
-		// "   Set Timer Please ", "      RUNNING       ",  "      PAUSED        "
+		// "   Set Timer Please ", "      RUNNING       ",  "      PAUSED        ", "   Delayed Start    "
 		LCD_SetCursor(LCD_ID1,DISPLAY_STRING_ROW,DISPLAY_STRING_COL);
 		LCD_WriteStr(LCD_ID1,(u8*)DISPLAY_EMPTY_LINE);
 		LCD_SetCursor(LCD_ID1,DISPLAY_STRING_ROW,DISPLAY_STRING_COL);
 		LCD_WriteStr(LCD_ID1,(u8*)displayString[display]);
-		
-		_delay_ms(DISPLAY_DELAY);
 	}
 	else if (display==DISPLAY_NO_TRANSACTION)
 	{
@@ -430,6 +895,33 @@ void displayStatus(DISPLAY_t display)
 	}
 	
 }
+/**
+ * @brief Blinks displayBlinkMessage DISPLAY_BLINK_TIMES times (protothread).
+ * 
+ * @param nowMs The current time in milliseconds.
+ * @return PT_WAITING while blinking , PT_ENDED when done.
+ */
+PT_Status_t displayBlink(u16 nowMs)
+{
+	PT_BEGIN(&displayBlinkPt);
+	for (displayBlinkCount=0 ; displayBlinkCount<DISPLAY_BLINK_TIMES ; displayBlinkCount++ )
+	{
+		//clear
+		LCD_SetCursor(LCD_ID1,DISPLAY_STRING_ROW,DISPLAY_STRING_COL);
+		LCD_WriteStr(LCD_ID1,(u8*)DISPLAY_EMPTY_LINE);
+		
+		PT_DELAY(&displayBlinkPt,displayBlinkTimestamp,nowMs,DISPLAY_BLINK_DELAY/2);
+		//display
+		LCD_SetCursor(LCD_ID1,DISPLAY_STRING_ROW,DISPLAY_STRING_COL);
+		PROF_BEGIN(PROF_LCD_WRITESTR);
+		LCD_WriteStr(LCD_ID1,(u8*)displayString[displayBlinkMessage]);
+		PROF_END(PROF_LCD_WRITESTR);
+		
+		PT_DELAY(&displayBlinkPt,displayBlinkTimestamp,nowMs,DISPLAY_BLINK_DELAY);
+	}
+	displayBlinkMessage=DISPLAY_NO_TRANSACTION;
+	PT_END(&displayBlinkPt);
+}
 void display_update(DISPLAY_t display)
 {
 	if ( (display>=DISPLAY_DOOR_OPENED)&&(display<=DISPLAY_TIMER_NOT_ADJUSTED))
@@ -438,9 +930,9 @@ void display_update(DISPLAY_t display)
 		displayStatus(display);
 		isDisplayUpdateNeeded=STD_TRUE;
 	}
-	else if ((display>=DISPLAY_SET_TIMER_PLEASE)&&(display<=DISPLAY_PAUSED))
+	else if ((display>=DISPLAY_SET_TIMER_PLEASE)&&(display<=DISPLAY_DELAYED))
 	{
-		// "   Set Timer Please ", "      RUNNING       ",  "      PAUSED        "
+		// "   Set Timer Please ", "      RUNNING       ",  "      PAUSED        ", "   Delayed Start    "
 		switch (currentState)
 		{
 			case IDLE_OFF_STATE:
@@ -448,7 +940,9 @@ void display_update(DISPLAY_t display)
 			{
 				isDisplayUpdateNeeded=STD_FALSE;
 				displayStatus(display);//DISPLAY_SET_TIMER_PLEASE
+				powerDisplay();
 				timeDisplay();
+				delayDisplay(delayedStartMinutes[delayedStartIndex]);
 			}
 			break;
 			
@@ -480,6 +974,14 @@ void display_update(DISPLAY_t display)
 			}
 			break;
 			
+			case DELAYED_STATE:
+			if (isDisplayUpdateNeeded==STD_TRUE)
+			{
+				isDisplayUpdateNeeded=STD_FALSE;
+				displayStatus(DISPLAY_DELAYED);
+			}
+			break;
+			
 			default:
 				//do nothing
 			break;
@@ -492,7 +994,7 @@ void timeDisplay(void)
 {
 	// clear
 	LCD_SetCursor(LCD_ID1,DISPLAY_TIMER_ROW,DISPLAY_TIMER_COL);
-	LCD_WriteStr(LCD_ID1,(u8*)DISPLAY_EMPTY_LINE);
+	LCD_WriteStr(LCD_ID1,(u8*)DISPLAY_EMPTY_TIMER);
 	
 	//diplay
 	LCD_SetCursor(LCD_ID1,DISPLAY_TIMER_ROW,DISPLAY_TIMER_COL);
@@ -502,6 +1004,220 @@ void timeDisplay(void)
 	LCD_WriteCh(LCD_ID1,secondTens);
 	LCD_WriteCh(LCD_ID1,secondUnits);
 }
+void powerDisplay(void)
+{
+	u8 power=heaterPowerLevels[heaterPowerIndex].percent;
+	
+	// "P:xx% " , "P:100%"
+	LCD_SetCursor(LCD_ID1,DISPLAY_POWER_ROW,DISPLAY_POWER_COL);
+	LCD_WriteStr(LCD_ID1,(u8*)"P:");
+	if (power>=100)
+	{
+		LCD_WriteCh(LCD_ID1,(power/100)+'0');
+	}
+	LCD_WriteCh(LCD_ID1,((power/10)%10)+'0');
+	LCD_WriteCh(LCD_ID1,(power%10)+'0');
+	LCD_WriteCh(LCD_ID1,'%');
+	if (power<100)
+	{
+		LCD_WriteCh(LCD_ID1,' ');
+	}
+}
+/**
+ * @brief Displays the start delay "D:h:mm" (blank when it is 0).
+ */
+void delayDisplay(u16 minutes)
+{
+	LCD_SetCursor(LCD_ID1,DISPLAY_DELAY_ROW,DISPLAY_DELAY_COL);
+	if (minutes==0)
+	{
+		LCD_WriteStr(LCD_ID1,(u8*)DISPLAY_EMPTY_DELAY);
+	}
+	else
+	{
+		LCD_WriteStr(LCD_ID1,(u8*)"D:");
+		LCD_WriteCh(LCD_ID1,(u8)(minutes/60)+'0');
+		LCD_WriteCh(LCD_ID1,':');
+		LCD_WriteCh(LCD_ID1,(u8)((minutes%60)/10)+'0');
+		LCD_WriteCh(LCD_ID1,(u8)((minutes%60)%10)+'0');
+	}
+}
+/**
+ * @brief Displays the time of day "hh:mm:ss" of the RTC.
+ */
+void clockDisplay(void)
+{
+	RTC_Time_t time;
+	
+	RTC_GetTime(&time);
+	LCD_SetCursor(LCD_ID1,DISPLAY_CLOCK_ROW,DISPLAY_CLOCK_COL);
+	LCD_WriteCh(LCD_ID1,(time.hour/10)+'0');
+	LCD_WriteCh(LCD_ID1,(time.hour%10)+'0');
+	LCD_WriteCh(LCD_ID1,':');
+	LCD_WriteCh(LCD_ID1,(time.minute/10)+'0');
+	LCD_WriteCh(LCD_ID1,(time.minute%10)+'0');
+	LCD_WriteCh(LCD_ID1,':');
+	LCD_WriteCh(LCD_ID1,(time.second/10)+'0');
+	LCD_WriteCh(LCD_ID1,(time.second%10)+'0');
+}
+void displayWelcome(void)
+{
+	LCD_SetCursor(LCD_ID1,1,1);
+	LCD_WriteStr(LCD_ID1,(u8*)"  Microwave         "); /*< the clock is at DISPLAY_CLOCK_COL */
+	LCD_SetCursor(LCD_ID1,2,1);
+	LCD_WriteStr(LCD_ID1,(u8*)"  Abdelrahman Ahmed ");
+}
+/**
+ * @brief The diagnostics (service screen) on the status line, in us and bytes:
+ *        - the super-loop latency of a state "S<state> W:<worst> P:<p99>", the iterations are recorded under the
+ *          state at their end (PROF_LOOP_MARK() in main()).
+ *        - the stack "STK:<high-water mark> FR:<never used> OK" (or LOW below STACK_MARGIN_BYTES).
+ *        - the dump "HIST>UART": the histograms of the states are sent over the USART (diagnosticsDump()).
+ *
+ * @param page The page: a state (STATE_t), DISPLAY_DIAG_STACK or DISPLAY_DIAG_DUMP.
+ */
+void diagnosticsDisplay(u8 page)
+{
+#if (PROF_LOOP_MONITOR==PROF_ON)
+	PROF_Stats_t stats;
+#endif
+	
+	LCD_SetCursor(LCD_ID1,DISPLAY_STRING_ROW,DISPLAY_STRING_COL);
+	LCD_WriteStr(LCD_ID1,(u8*)DISPLAY_EMPTY_LINE);
+	LCD_SetCursor(LCD_ID1,DISPLAY_STRING_ROW,DISPLAY_STRING_COL);
+	if (page==DISPLAY_DIAG_STACK)
+	{
+		LCD_WriteStr(LCD_ID1,(u8*)"STK:");
+		LCD_WriteNum(LCD_ID1,STACK_HighWater());
+		LCD_WriteStr(LCD_ID1,(u8*)" FR:");
+		LCD_WriteNum(LCD_ID1,STACK_GetFree());
+		LCD_WriteStr(LCD_ID1,(STACK_Check()==STD_OK)? (u8*)" OK" : (u8*)" LOW");
+	}
+#if (PROF_LOOP_MONITOR==PROF_ON)
+	else if (page==DISPLAY_DIAG_DUMP)
+	{
+		LCD_WriteStr(LCD_ID1,(u8*)"HIST>UART");
+		diagnosticsDumpLine=0; /*< restarted when the dump is already running */
+	}
+	else
+	{
+		PROF_GetLoopStats(page,&stats);
+		LCD_WriteCh(LCD_ID1,'S');
+		LCD_WriteCh(LCD_ID1,page+'0');
+		LCD_WriteStr(LCD_ID1,(u8*)" W:");
+		LCD_WriteNum(LCD_ID1,PROF_COUNTS_TO_US(stats.max));
+		LCD_WriteStr(LCD_ID1,(u8*)" P:");
+		LCD_WriteNum(LCD_ID1,PROF_COUNTS_TO_US(PROF_GetPercentile(&stats,LOOP_REPORT_PERCENTILE)));
+	}
+#endif
+}
+
+/**
+ * @brief Appends the decimal digits of num to the line, returns the new length.
+ */
+u8 diagnosticsAppendNum(u8 line[], u8 len, u32 num)
+{
+	u8 start=len;
+
+	do
+	{
+		line[len]=(u8)(num%10)+'0';
+		len++;
+		num/=10;
+	}while (num!=0);
+	Str_ReverseWithLen(&line[start],len-start);
+	return len;
+}
+/**
+ * @brief Appends the string to the line, returns the new length.
+ */
+u8 diagnosticsAppendStr(u8 line[], u8 len, const char *str)
+{
+	while (*str!='\0')
+	{
+		line[len]=(u8)*str;
+		len++;
+		str++;
+	}
+	return len;
+}
+/**
+ * @brief Sends the next line of the histogram dump (DISPLAY_DIAG_DUMP) when the TX buffer has room for it,
+ *        called by every task_display() run. The statistics are read again for each line.
+ */
+void diagnosticsDump(void)
+{
+#if (PROF_LOOP_MONITOR==PROF_ON)
+	PROF_Stats_t stats;
+#if (OS_PREEMPTIVE!=OS_ON)
+	SCHED_TaskStats_t taskStats;
+	u8 task;
+#endif
+	u8 line[DIAG_LINE_SIZE];
+	u8 len=0;
+	u8 tag;
+	u8 i;
+
+	if (diagnosticsDumpLine<DIAG_DUMP_LINES)
+	{
+		if (diagnosticsDumpLine==0)
+		{
+			len=diagnosticsAppendStr(line,len,"LOOP US/COUNT:");
+			len=diagnosticsAppendNum(line,len,UPTIME_US_PER_COUNT);
+			len=diagnosticsAppendStr(line,len," BUCKETS:");
+			len=diagnosticsAppendNum(line,len,PROF_BUCKETS);
+		}
+#if (OS_PREEMPTIVE!=OS_ON)
+		else if (diagnosticsDumpLine>=DIAG_LOOP_LINES)
+		{
+			task=diagnosticsDumpLine-DIAG_LOOP_LINES;
+			SCHED_GetTaskStats(taskIds[task],&taskStats);
+			len=diagnosticsAppendStr(line,len,"TASK T");
+			len=diagnosticsAppendNum(line,len,task);
+			len=diagnosticsAppendStr(line,len," N:");
+			len=diagnosticsAppendNum(line,len,taskStats.runs);
+			len=diagnosticsAppendStr(line,len," O:");
+			len=diagnosticsAppendNum(line,len,taskStats.overruns);
+			len=diagnosticsAppendStr(line,len," W:");
+			len=diagnosticsAppendNum(line,len,SCHED_COUNTS_TO_US(taskStats.wcet));
+			len=diagnosticsAppendStr(line,len," L:");
+			len=diagnosticsAppendNum(line,len,SCHED_COUNTS_TO_US(taskStats.lastExec));
+		}
+#endif
+		else
+		{
+			tag=(diagnosticsDumpLine-1)/2;
+			PROF_GetLoopStats(tag,&stats);
+			if ((diagnosticsDumpLine%2)==1)
+			{
+				len=diagnosticsAppendStr(line,len,"LOOP S");
+				len=diagnosticsAppendNum(line,len,tag);
+				len=diagnosticsAppendStr(line,len," N:");
+				len=diagnosticsAppendNum(line,len,stats.runs);
+				len=diagnosticsAppendStr(line,len," W:");
+				len=diagnosticsAppendNum(line,len,PROF_COUNTS_TO_US(stats.max));
+				len=diagnosticsAppendStr(line,len," P99:");
+				len=diagnosticsAppendNum(line,len,PROF_COUNTS_TO_US(PROF_GetPercentile(&stats,LOOP_REPORT_PERCENTILE)));
+			}
+			else
+			{
+				len=diagnosticsAppendStr(line,len,"HIST S");
+				len=diagnosticsAppendNum(line,len,tag);
+				for (i=0; i<PROF_BUCKETS; i++)
+				{
+					line[len]=' ';
+					len=diagnosticsAppendNum(line,len+1,stats.histogram[i]);
+				}
+			}
+		}
+		len=diagnosticsAppendStr(line,len,"\r\n");
+		if (UART_Write(line,len)==STD_OK)
+		{
+			diagnosticsDumpLine++;
+		}
+	}
+#endif
+}
 
 
 /*--------------------------------*/
@@ -511,19 +1227,42 @@ void timeDisplay(void)
 /*--------------------------------*/
 void system_OnOff(Std_OnOff_t status)
 {
+	u8 sreg;
+	Std_Bool_t isHeaterOnTime;
 	if (status==STD_ON)
 	{
 		if ( (historyState==PAUSE_STATE) || (historyState==IDLE_OFF_STATE) )
 		{
+			/* a new cook starts a new power window, a resumed cook goes on in the window and the second where it was paused */
+			if (historyState==IDLE_OFF_STATE)
+			{
+				heaterWindowSecond=0;
+				TIMER1_SetCounterValue(0);
+			}
 			historyState=ON_STATE;
+			TRACE_RECORD(TRACE_ONOFF,STD_ON);
 			
-			Dio_WritePin(HEATER,DIO_VOLT_HIGH);
+			/* the door is checked with the interrupts disabled so the door ISR can't switch OFF the heater before it is switched ON here */
+			sreg=SREG;
+			Global_Interrupt_Disable__asm();
+			/* the heater is ON before the end of the ON time of the power level (TIMER1 is stopped, the COMPB ISR can't run) */
+			isHeaterOnTime=((heaterWindowSecond<heaterOffSecond) || ((heaterWindowSecond==heaterOffSecond) &&
+			                (TIMER1_GetCounterValue()<heaterPowerLevels[heaterPowerIndex].offCount)))? STD_TRUE : STD_FALSE;
+			if (Dio_ReadPin(DOOR_SENSOR)==DIO_VOLT_LOW)//closed
+			{
+				if (isHeaterOnTime==STD_TRUE)
+				{
+					Dio_WritePin(HEATER,DIO_VOLT_HIGH);
+				}
+				Dio_WritePin(MOTOR,DIO_VOLT_HIGH);
+			}
+			SREG=sreg;
 			Dio_WritePin(LAMP,DIO_VOLT_HIGH);
-			Dio_WritePin(MOTOR,DIO_VOLT_HIGH);
-			
 			
+			TIMER1_COMPA_INT(STD_ENABLED);
+			TIMER1_COMPB_INT(STD_ENABLED);
 			TIMER_ONOFF(TIMER1,STD_ON);
-			TIMER1_OVF_INT(STD_ENABLED);
+			TURNTABLE_Start(SYSTEM_GET_TICK());
 		}
 	}
 	else if (status==STD_OFF)
@@ -531,34 +1270,260 @@ void system_OnOff(Std_OnOff_t status)
 		Dio_WritePin(HEATER,DIO_VOLT_LOW);
 		Dio_WritePin(LAMP,DIO_VOLT_LOW);
 		Dio_WritePin(MOTOR,DIO_VOLT_LOW);
-		
+		TRACE_RECORD(TRACE_ONOFF,STD_OFF);
 		
 		TIMER_ONOFF(TIMER1,STD_OFF);
-		TIMER1_OVF_INT(STD_DISABLED);
+		TIMER1_COMPA_INT(STD_DISABLED);
+		TIMER1_COMPB_INT(STD_DISABLED);
+		TURNTABLE_Stop();
 	}
 	
 }
-void system_timerOvf(void)
+/**
+ * @brief Selects the heater power level: the ON time of every window is
+ *        heaterPowerLevels[index].percent% of HEATER_WINDOW_SECONDS, it ends in the second heaterOffSecond
+ *        at the OCR1B count of that second.
+ *
+ * @note Called in IDLE_OFF_STATE only (TIMER1 is stopped).
+ */
+void system_setPower(u8 index)
+{
+	heaterPowerIndex=index;
+	heaterOffSecond=heaterPowerLevels[index].offSecond;
+	TIMER1_SetCompare_B_Value(heaterPowerLevels[index].offCount);
+}
+/**
+ * @brief The door opened (rising edge): the EXTI ISR itself (build-time binding, EXTI_Lcfg.h) or the callback of the
+ *        driver ISR (runtime binding).
+ *        The heat source is switched OFF first then the turntable, then the state machine is notified.
+ */
+#if (DOOR_ISR_IS_APP==1)
+ISR(DOOR_VECT)
+#else
+void system_doorOpened(void)
+#endif
+{
+	PROF_BEGIN(PROF_ISR_DOOR);
+	Dio_WritePin(HEATER,DIO_VOLT_LOW);
+	Dio_WritePin(MOTOR,DIO_VOLT_LOW);
+	RingBuf_Push(&systemEventQueue,DOOR_OPENED_EVENT);
+	TRACE_RECORD_ISR(TRACE_DOOR_ISR,0);
+	PROF_END(PROF_ISR_DOOR);
+}
+/**
+ * @brief Checks that the cooking can start, the reason is displayed when it can't.
+ *
+ * @return STD_TRUE when the door is closed, the food exists and the timer is adjusted.
+ */
+Std_Bool_t system_isReadyToStart(void)
+{
+	Std_Bool_t isReady=STD_FALSE;
+	
+	if (Dio_ReadPin(DOOR_SENSOR)==DIO_VOLT_HIGH) /*< check if door is opened*/
+	{
+		display_update(DISPLAY_DOOR_OPENED);
+	}
+	else if (getFoodTransation()==FOOD_WEIGHT_INVALID_EVENT) /*< check if no food exist */
+	{
+		display_update(DISPLAY_PUT_FOOD);
+	}
+	else if (getTimeTransation()==TIME_NOT_ADJUSTED_EVENT) /*< check if Timer not adjusted */
+	{
+		display_update(DISPLAY_TIMER_NOT_ADJUSTED);
+	}
+	else
+	{
+		isReady=STD_TRUE;
+	}
+	return isReady;
+}
+/**
+ * @brief Starts the countdown of the delayed start (0: stops it), counted by the RTC ISR.
+ */
+void system_setDelayedStart(u16 seconds)
+{
+	u8 sreg=SREG;
+	
+	Global_Interrupt_Disable__asm(); /*< u16 write is not atomic on AVR */
+	delayedStartSeconds=seconds;
+	isDelayedStartDue=STD_FALSE;
+	SREG=sreg;
+}
+/**
+ * @brief The RTC callback (TIMER2 overflow ISR, every second): the clock is redrawn and the delayed start is counted down.
+ */
+void system_rtcSecond(void)
+{
+	PROF_BEGIN(PROF_ISR_RTC);
+	isClockUpdateNeeded=STD_TRUE;
+	systemWakeMs=UPTIME_GetMs();
+	if (delayedStartSeconds>0)
+	{
+		delayedStartSeconds--;
+		if (delayedStartSeconds==0)
+		{
+			isDelayedStartDue=STD_TRUE;
+		}
+	}
+	PROF_END(PROF_ISR_RTC);
+}
+/**
+ * @brief The idle function: called with the interrupts disabled when no task is ready (scheduler idle hook or kernel idle task),
+ *        it returns after the next interrupt with the interrupts enabled.
+ *
+ * In DELAYED_STATE the CPU sleeps in Power-save DELAYED_AWAKE_MS after the last RTC second: TIMER0 (uptime, tasks)
+ * stops until the RTC (or the door) wakes it up, the uptime doesn't count the sleep time.
+ * Otherwise it sleeps in Idle: the next tick wakes it up.
+ * IDLE_SPIN only enables the interrupts: the CPU is always active.
+ */
+void system_idle(void)
+{
+#if (IDLE_MODE==IDLE_SPIN)
+	Global_Interrupt_Enable__asm();
+#else
+	if ((currentState==DELAYED_STATE) && (UPTIME_ELAPSED(UPTIME_GetMs(),systemWakeMs)>=DELAYED_AWAKE_MS))
+	{
+		SLEEP_SetMode(SLEEP_POWER_SAVE);
+		RTC_PrepareSleep();
+		SLEEP_Enter();
+		SLEEP_SetMode(SLEEP_IDLE);
+	}
+	else
+	{
+		SLEEP_Enter();
+	}
+#endif
+}
+/**
+ * @brief The 1s cooking timer and the start of the heater power window: the TIMER1 compare match A ISR itself
+ *        (build-time binding, TIMERS_Lcfg.h) or the callback of the driver ISR (runtime binding).
+ *        The door is read before the heater is switched ON again (the door ISR has a higher priority).
+ */
+#if (TIMER1_COMPA_ISR_OWNER==TIMER_ISR_APP)
+ISR(TIMER1_COMPA_VECT)
+#else
+void system_timerSecond(void)
+#endif
 {
-	TIMER1_SetCounterValue((u16)65536-31250);
+	PROF_BEGIN(PROF_ISR_SECOND);
+	heaterWindowSecond++;
+	if (heaterWindowSecond>=HEATER_WINDOW_SECONDS)
+	{
+		heaterWindowSecond=0;
+		if ((heaterOffSecond>0) && (opTime>1) && (Dio_ReadPin(DOOR_SENSOR)==DIO_VOLT_LOW))//closed, not the last second of the cooking
+		{
+			Dio_WritePin(HEATER,DIO_VOLT_HIGH);
+			TRACE_RECORD_ISR(TRACE_HEATER_ISR,1);
+		}
+	}
+	
 	if (opTime>0)
 	{
 		opTime--;
 		isTimerUpdateNeeded=STD_TRUE;
 	}
+	PROF_END(PROF_ISR_SECOND);
+}
+/**
+ * @brief The end of the heater ON time: the TIMER1 compare match B ISR itself (build-time binding, TIMERS_Lcfg.h)
+ *        or the callback of the driver ISR (runtime binding), it fires once per second at OCR1B.
+ */
+#if (TIMER1_COMPB_ISR_OWNER==TIMER_ISR_APP)
+ISR(TIMER1_COMPB_VECT)
+#else
+void system_heaterOff(void)
+#endif
+{
+	if (heaterWindowSecond==heaterOffSecond)
+	{
+		Dio_WritePin(HEATER,DIO_VOLT_LOW);
+		TRACE_RECORD_ISR(TRACE_HEATER_ISR,0);
+	}
 }
 void system_init(void)
 {
+	WDGM_ResetInfo_t resetInfo;
+	Std_Error_t error;
+	
+	Dio_DisableJtag(); /*< the keypad rows PC4/PC5 are TDO/TDI: JTAGEN is programmed on a new part */
 	Dio_Init();
-	LCD_init(LCD_ID1);
+	UPTIME_Init(); /*< the time base of the scheduler and of the timestamps */
+	WDGM_Init(); /*< records the reset cause and starts the watchdog */
+	WDGM_GetResetInfo(&resetInfo);
+#if (TRACE_ENABLE==TRACE_ON)
+	TRACE_Init(resetInfo.cause); /*< keeps the records before a watchdog reset (.noinit) */
+#endif
+#if PROF_IS_USED
+	PROF_Init(); /*< the timestamps of the probes are TIMER0 counts of the uptime service */
+#endif
+	SLEEP_SetMode(SLEEP_IDLE); /*< TIMER0 (tick) and TIMER1 (cooking timer, heater, turntable) keep running */
+	UART_Init(); /*< the diagnostics dump (DISPLAY_DIAG_DUMP), the USART keeps running in Idle */
+	RTC_Init(); /*< the time of day (TIMER2 on the 32768Hz crystal) */
+	RTC_SetSecondCallBack(system_rtcSecond);
 	
-	TIMER1_OVF_SetCallBack(system_timerOvf);
-	TIMER1_Init(TIMER1_NORMAL,TIMER_OCx_MODE_DICONNECTED,TIMER_OCx_MODE_DICONNECTED,TIMER_Pre_CLK_256);
+#if (OS_PREEMPTIVE==OS_ON)
+	OS_Init();
+	OS_StackOverflow_SetCallBack(system_stackOverflow);
+	error=OS_CreateTask(TASK_SAFETY_PRIORITY,os_task_safety,safetyStack,sizeof(safetyStack));
+	if (error==STD_OK)
+	{
+		error=OS_CreateTask(TASK_CONTROL_PRIORITY,os_task_control,controlStack,sizeof(controlStack));
+	}
+	if (error==STD_OK)
+	{
+		error=OS_CreateTask(TASK_DISPLAY_PRIORITY,os_task_display,displayStack,sizeof(displayStack));
+	}
+	if (error==STD_OK)
+	{
+		error=OS_CreateTask(TASK_KEYPAD_PRIORITY,os_task_keypad,keypadStack,sizeof(keypadStack));
+	}
+#else
+	SCHED_Init();
+	error=SCHED_CreateTask(&taskIds[0],task_safety,TASK_SAFETY_PERIOD,TASK_SAFETY_PHASE);
+	if (error==STD_OK)
+	{
+		error=SCHED_CreateTask(&taskIds[1],task_control,TASK_CONTROL_PERIOD,TASK_CONTROL_PHASE);
+	}
+	if (error==STD_OK)
+	{
+		error=SCHED_CreateTask(&taskIds[2],task_keypad,TASK_KEYPAD_PERIOD,TASK_KEYPAD_PHASE);
+	}
+	if (error==STD_OK)
+	{
+		error=SCHED_CreateTask(&taskIds[3],task_display,TASK_DISPLAY_PERIOD,TASK_DISPLAY_PHASE);
+	}
+	SCHED_SetIdleHook(system_idle); /*< sleeps between the releases, woken up by the next tick at the latest */
+#endif
+	if (error!=STD_OK)
+	{
+		system_failSafe(TRACE_INIT_FAILED,(u8)error); /*< a task is missing: the oven would not be safe */
+	}
+	
+#if (DOOR_INTERLOCK_MODE!=DOOR_INTERLOCK_POLLED)
+#if (DOOR_ISR_IS_APP==0)
+	EXTI_SetCallBack(DOOR_EXTI,system_doorOpened);
+#endif
+	EXTI_SetTrigger(DOOR_EXTI,RISING_EDGE); /*< HIGH = opened */
+	EXTI_ClearFlag(DOOR_EXTI);
+	EXTI_EnableInterrupt(DOOR_EXTI);
+#endif
+	
+#if (TIMER1_COMPA_ISR_OWNER==TIMER_ISR_DRIVER)
+	TIMER1_COMPA_SetCallBack(system_timerSecond);
+#endif
+#if (TIMER1_COMPB_ISR_OWNER==TIMER_ISR_DRIVER)
+	TIMER1_COMPB_SetCallBack(system_heaterOff);
+#endif
+	TIMER1_Init(TIMER1_CTC_OCRN_TOP,TIMER_OCx_MODE_DICONNECTED,TIMER_OCx_MODE_DICONNECTED,SYSTEM_TIMER1_PRESCALER);
 	TIMER_ONOFF(TIMER1,STD_OFF);
-	TIMER1_SetCounterValue((u16)65536-31250);
+	TIMER1_SetCompare_A_Value(SYSTEM_TIMER1_TOP);
+	TIMER1_SetCounterValue(0);
+	system_setPower(0);
+	TURNTABLE_Init();
 	
 	Global_Interrupt_Enable__asm();
-	TIMER1_OVF_INT(STD_DISABLED);
+	TIMER1_COMPA_INT(STD_DISABLED);
+	TIMER1_COMPB_INT(STD_DISABLED);
 	
 	currentState=IDLE_OFF_STATE;
 	historyState=IDLE_OFF_STATE;
@@ -567,13 +1532,51 @@ void system_init(void)
 	Dio_WritePin(HEATER,DIO_VOLT_LOW);
 	Dio_WritePin(LAMP,DIO_VOLT_LOW);
 	Dio_WritePin(MOTOR,DIO_VOLT_LOW);
-
-	LCD_voidSetOption(LCD_ID1,LCD_ClearDisplay);
-	LCD_SetCursor(LCD_ID1,1,1);
-	LCD_WriteStr(LCD_ID1,(u8*)"     Microwave      ");
-	LCD_SetCursor(LCD_ID1,2,1);
-	LCD_WriteStr(LCD_ID1,(u8*)"  Abdelrahman Ahmed ");
+	/* the LCD is initialized (LCD_InitAsync()) and the welcome screen is written by task_display() */
+	if (resetInfo.cause&WDT_RESET_WATCHDOG)
+	{
+		display_update(DISPLAY_WATCHDOG_RESET); /*< blinked after the LCD initialization */
+	}
+	
+	/* the tasks start running here (last: they use the states above) */
+#if (OS_PREEMPTIVE==OS_ON)
+	OS_Start();
+#else
+	SCHED_Start();
+#endif
+}
+/**
+ * @brief Called by the kernel (tick ISR) when a task stack overflows.
+ */
+void system_stackOverflow(u8 priority)
+{
+	system_failSafe(TRACE_STACK_OVERFLOW,priority);
+}
+/**
+ * @brief The outputs are switched OFF, the fault is traced and the system stops until the watchdog resets it.
+ */
+void system_failSafe(TRACE_EventId_t fault, u8 arg)
+{
+	(void)fault;
+	(void)arg;
+	Dio_WritePin(HEATER,DIO_VOLT_LOW);
+	Dio_WritePin(LAMP,DIO_VOLT_LOW);
+	Dio_WritePin(MOTOR,DIO_VOLT_LOW);
+	TRACE_FAULT(fault,arg); /*< the records that led to it are kept after the watchdog reset */
+	while (1)
+	{
+		//safe state
+	}
 }
+#if defined(HOST_BUILD)
+/**
+ * @brief Returns the current state (STATE_t) for the host test tools (FUZZ_Lcfg.h).
+ */
+u8 system_getState(void)
+{
+	return (u8)currentState;
+}
+#endif
 
 
 /*--------------------------------*/
@@ -583,16 +1586,36 @@ void system_init(void)
 /*--------------------------------*/
 TRANSATION_t getTransation(void)
 {
+	static DIO_VOLTAGE_LEVEL_t stopLastLevel=DIO_VOLT_HIGH;  /*< level at the previous call (released) */
+	static DIO_VOLTAGE_LEVEL_t startLastLevel=DIO_VOLT_HIGH;
+	DIO_VOLTAGE_LEVEL_t stopLevel=Dio_ReadPin(STOP_PB);
+	DIO_VOLTAGE_LEVEL_t startLevel=Dio_ReadPin(START_PB);
 	TRANSATION_t transation=NO_TRANSATION;
-	 if (Dio_ReadPin(STOP_PB)==DIO_VOLT_LOW)
+	u8 event;
+	
+	/* the events posted by the ISRs first (e.g. DOOR_OPENED_EVENT) */
+	if (RingBuf_Pop(&systemEventQueue,&event)==STD_OK)
+	{
+		transation=(TRANSATION_t)event; /*< the buttons edges are kept for the next call */
+	}
+	else if (TURNTABLE_IsStalled(SYSTEM_GET_TICK())==STD_TRUE)
 	{
-		while(Dio_ReadPin(STOP_PB)==DIO_VOLT_LOW);
-		transation=CANCEL_EVENT;
+		/* polled, not queued (the queue has one producer: the ISRs), TRUE until system_OnOff(STD_OFF) stops the monitor */
+		transation=TURNTABLE_STALLED_EVENT;
 	}
-	else if (Dio_ReadPin(START_PB)==DIO_VOLT_LOW)
+	else
 	{
-		while(Dio_ReadPin(START_PB)==DIO_VOLT_LOW);
-		transation=START_EVENT;
+		/* the event is generated when the button is released (low to high), without busy waiting */
+		if ((stopLastLevel==DIO_VOLT_LOW)&&(stopLevel==DIO_VOLT_HIGH))
+		{
+			transation=CANCEL_EVENT;
+		}
+		else if ((startLastLevel==DIO_VOLT_LOW)&&(startLevel==DIO_VOLT_HIGH))
+		{
+			transation=START_EVENT;
+		}
+		stopLastLevel=stopLevel;
+		startLastLevel=startLevel;
 	}
 	
 	return transation;
@@ -674,14 +1697,74 @@ void resetTimer(void)
 }
 void keyPad_read(void)
 {
-	if(KEYPAD_GetKey(&keypad_read_var)==STD_OK)
+	RTC_Time_t time;
+	
+	Std_Error_t keyStatus;
+	
+	PROF_BEGIN(PROF_KEYPAD_GETKEY);
+	keyStatus=KEYPAD_GetKey(&keypad_read_var);
+	PROF_END(PROF_KEYPAD_GETKEY);
+	if(keyStatus==STD_OK)
 	{
-		isDisplayUpdateNeeded=STD_TRUE;
-		
-		minuteTens=minuteUnits;
-		minuteUnits=secondTens;
-		secondTens=secondUnits;
-		secondUnits=keypad_read_var;
+		TRACE_RECORD(TRACE_KEY,keypad_read_var);
+		if ((keypad_read_var>='0') && (keypad_read_var<='9'))
+		{
+			isDisplayUpdateNeeded=STD_TRUE;
+			
+			minuteTens=minuteUnits;
+			minuteUnits=secondTens;
+			secondTens=secondUnits;
+			secondUnits=keypad_read_var;
+		}
+		else if (keypad_read_var==HEATER_POWER_KEY)
+		{
+			isDisplayUpdateNeeded=STD_TRUE;
+			
+			system_setPower((heaterPowerIndex+1)%(sizeof(heaterPowerLevels)/sizeof(heaterPowerLevels[0])));
+		}
+		else if (keypad_read_var==CLOCK_SET_KEY)
+		{
+			/* the entered digits are hh:mm */
+			time.hour=((minuteTens-'0')*10)+(minuteUnits-'0');
+			time.minute=((secondTens-'0')*10)+(secondUnits-'0');
+			time.second=0;
+			if (RTC_SetTime(&time)==STD_OK)
+			{
+				isClockUpdateNeeded=STD_TRUE;
+				isDisplayUpdateNeeded=STD_TRUE;
+			}
+			else
+			{
+				display_update(DISPLAY_RESET);
+			}
+			resetTimer();
+		}
+		else if (keypad_read_var==DELAYED_START_KEY)
+		{
+			isDisplayUpdateNeeded=STD_TRUE;
+			
+			delayedStartIndex=(delayedStartIndex+1)%(sizeof(delayedStartMinutes)/sizeof(delayedStartMinutes[0]));
+		}
+		else if (keypad_read_var==DIAGNOSTICS_KEY)
+		{
+			diagnosticsPage++; /*< the states, the stack then no page */
+			if (diagnosticsPage>DISPLAY_DIAG_NONE)
+			{
+				diagnosticsPage=0;
+			}
+			if (diagnosticsPage==DISPLAY_DIAG_NONE)
+			{
+				isDisplayUpdateNeeded=STD_TRUE; /*< the status line is drawn again */
+			}
+			else
+			{
+				isDiagnosticsNeeded=STD_TRUE;
+			}
+		}
+		else
+		{
+			//not used key
+		}
 	}
 	else
 	{
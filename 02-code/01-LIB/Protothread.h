@@ -0,0 +1,132 @@
+/**
+ * @file Protothread.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file is a header file that contains the stackless coroutine (protothread) macros.
+ *         A protothread lets a long sequence (init sequence, blinking message, ...) be written linearly
+ *         and return to the scheduler at every wait instead of blocking with _delay_ms().
+ *
+ *         - The state of a protothread is one PT_t (2 bytes): the source line to resume from.
+ *         - No heap and no own stack: the protothread runs on the stack of its caller.
+ *
+ * @note Rules of the protothread function body (between PT_BEGIN() and PT_END()):
+ *         - local variables are NOT kept across a wait/yield, use static or context variables.
+ *         - a switch statement must not contain a wait/yield (the macros are built on switch/case).
+ *         - only one PT_xxx wait/yield macro per source line (__LINE__ is the resume point).
+ *
+ * @par Example:
+ *   @code
+ *    static PT_t blinkPt;
+ *    static u16 blinkTimestamp;
+ *
+ *    PT_Status_t blink(u16 now)
+ *    {
+ *        PT_BEGIN(&blinkPt);
+ *        Dio_WritePin(PC1,DIO_VOLT_HIGH);
+ *        PT_DELAY(&blinkPt,blinkTimestamp,now,500);   // returns PT_WAITING until 500 ticks passed
+ *        Dio_WritePin(PC1,DIO_VOLT_LOW);
+ *        PT_END(&blinkPt);                            // returns PT_ENDED and restarts on the next call
+ *    }
+ *
+ *    // from a scheduled task:
+ *    if (PT_IS_RUNNING(blink(SCHED_GetTick())))
+ *    {
+ *        // still blinking
+ *    }
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef PROTOTHREAD_H_
+#define PROTOTHREAD_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The state of a protothread (the line to resume from, 0 = start).
+ */
+typedef u16 PT_t;
+
+/**
+ * @brief The value returned by a protothread function.
+ */
+typedef enum
+{
+	PT_WAITING,  /**< blocked in PT_WAIT_UNTIL() / PT_WAIT_WHILE() / PT_DELAY() */
+	PT_YIELDED,  /**< returned by PT_YIELD() */
+	PT_EXITED,   /**< returned by PT_EXIT() */
+	PT_ENDED     /**< reached PT_END() */
+}PT_Status_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief Marks the fall through into the case label of a wait as intended (-Wimplicit-fallthrough, GCC 7 and later).
+ */
+#if defined(__GNUC__) && (__GNUC__>=7)
+#define PT_FALLTHROUGH              __attribute__((fallthrough))
+#else
+#define PT_FALLTHROUGH
+#endif
+
+/**
+ * @brief Restarts a protothread from its beginning.
+ */
+#define PT_INIT(pt)                 ( *(pt)=0 )
+
+/**
+ * @brief Starts the body of the protothread (resumes at the last wait/yield).
+ */
+#define PT_BEGIN(pt)                switch (*(pt)) { case 0:
+
+/**
+ * @brief Ends the body of the protothread, the next call starts it again from PT_BEGIN().
+ */
+#define PT_END(pt)                  } PT_INIT(pt); return PT_ENDED
+
+/**
+ * @brief Returns PT_WAITING until the condition is true.
+ */
+#define PT_WAIT_UNTIL(pt,condition) do{ *(pt)=__LINE__; PT_FALLTHROUGH; case __LINE__: if (!(condition)) { return PT_WAITING; } }while(0)
+
+/**
+ * @brief Returns PT_WAITING while the condition is true.
+ */
+#define PT_WAIT_WHILE(pt,condition) PT_WAIT_UNTIL(pt,!(condition))
+
+/**
+ * @brief Returns PT_YIELDED once, the next call continues after it.
+ */
+#define PT_YIELD(pt)                do{ *(pt)=__LINE__; return PT_YIELDED; case __LINE__: ; }while(0)
+
+/**
+ * @brief Stops the protothread and returns PT_EXITED, the next call starts it again from PT_BEGIN().
+ */
+#define PT_EXIT(pt)                 do{ PT_INIT(pt); return PT_EXITED; }while(0)
+
+/**
+ * @brief Returns PT_WAITING until more than duration time units passed.
+ *
+ * @param timestamp u16 variable (static or context) that keeps the start time across the calls.
+ * @param now Expression that returns the current time (u16, wraps around), evaluated on every call.
+ * @param duration The time to wait in the units of now (< 65535).
+ *
+ * @note With a tick time source the wait is at least (duration) whole ticks.
+ */
+#define PT_DELAY(pt,timestamp,now,duration) \
+	do{ (timestamp)=(now); PT_WAIT_UNTIL(pt,(u16)((now)-(timestamp))>(u16)(duration)); }while(0)
+
+/**
+ * @brief Evaluates to true while the returned status means the protothread did not finish.
+ */
+#define PT_IS_RUNNING(status)       ( (status)<PT_EXITED )
+
+#endif /* PROTOTHREAD_H_ */
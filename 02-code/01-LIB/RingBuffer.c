@@ -0,0 +1,263 @@
+/**
+ * @file RingBuffer.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file is a source file that contains the single-producer/single-consumer (SPSC) ring buffer.
+ *         The producer only writes head and the consumer only writes tail, the data is always written/read
+ *         before the index is published (memory_barrier()) so the other side never sees a byte before it is valid.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see RingBuffer.h
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+#include "RingBuffer.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes a ring buffer on a user supplied storage.
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param storage Pointer to the storage array.
+ * @param size Size of the storage, must be a power of two in the range [2,RINGBUF_MAX_SIZE].
+ * @return STD_OK , STD_NULL_POINTER or STD_INVALID_ARG (size is not a valid power of two).
+ */
+Std_Error_t RingBuf_Init(RingBuf_t *rb, u8 storage[], u8 size)
+{
+	Std_Error_t error=STD_OK;
+	if ((rb==NULL_PTR) || (storage==NULL_PTR))
+	{
+		error=STD_NULL_POINTER;
+	}
+	else if (!RINGBUF_IS_VALID_SIZE(size))
+	{
+		error=STD_INVALID_ARG;
+	}
+	else
+	{
+		rb->buffer=storage;
+		rb->mask=size-1;
+		rb->head=0;
+		rb->tail=0;
+	}
+	return error;
+}
+
+/**
+ * @brief Pushes one byte (producer side).
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param data The byte to push.
+ * @return STD_OK or STD_BUFFER_FULL.
+ */
+Std_Error_t RingBuf_Push(RingBuf_t *rb, u8 data)
+{
+	Std_Error_t error=STD_BUFFER_FULL;
+	u8 head=rb->head; /*< own index, read once */
+
+	if ((u8)(head-rb->tail) <= rb->mask) /*< count < size */
+	{
+		rb->buffer[head & rb->mask]=data;
+		memory_barrier(); /*< data must be stored before it is published */
+		rb->head=head+1;
+		error=STD_OK;
+	}
+	return error;
+}
+
+/**
+ * @brief Pops one byte (consumer side).
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param data Pointer to store the popped byte.
+ * @return STD_OK or STD_BUFFER_EMPTY.
+ */
+Std_Error_t RingBuf_Pop(RingBuf_t *rb, u8 *data)
+{
+	Std_Error_t error=STD_BUFFER_EMPTY;
+	u8 tail=rb->tail; /*< own index, read once */
+
+	if (rb->head != tail)
+	{
+		memory_barrier(); /*< data must not be read before head */
+		*data=rb->buffer[tail & rb->mask];
+		memory_barrier(); /*< data must be read before the slot is released */
+		rb->tail=tail+1;
+		error=STD_OK;
+	}
+	return error;
+}
+
+/**
+ * @brief Reads a byte without removing it (consumer side).
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param offset Offset from the oldest byte (0 is the next byte RingBuf_Pop() returns).
+ * @param data Pointer to store the byte.
+ * @return STD_OK or STD_BUFFER_EMPTY (less than offset+1 bytes are stored).
+ */
+Std_Error_t RingBuf_Peek(const RingBuf_t *rb, u8 offset, u8 *data)
+{
+	Std_Error_t error=STD_BUFFER_EMPTY;
+	u8 tail=rb->tail;
+
+	if ((u8)(rb->head-tail) > offset)
+	{
+		memory_barrier();
+		*data=rb->buffer[(u8)(tail+offset) & rb->mask];
+		error=STD_OK;
+	}
+	return error;
+}
+
+/**
+ * @brief Pushes len bytes at once (producer side).
+ *
+ * All bytes are published to the consumer together, nothing is pushed if they don't fit.
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param data The bytes to push.
+ * @param len Number of bytes.
+ * @return STD_OK or STD_BUFFER_FULL.
+ */
+Std_Error_t RingBuf_PushBulk(RingBuf_t *rb, const u8 data[], u8 len)
+{
+	Std_Error_t error=STD_BUFFER_FULL;
+	u8 head=rb->head;
+	u8 i;
+
+	if ((u8)(rb->mask+1-(u8)(head-rb->tail)) >= len) /*< free >= len */
+	{
+		for (i=0; i<len; i++)
+		{
+			rb->buffer[(u8)(head+i) & rb->mask]=data[i];
+		}
+		memory_barrier(); /*< the whole record must be stored before it is published */
+		rb->head=head+len;
+		error=STD_OK;
+	}
+	return error;
+}
+
+/**
+ * @brief Pops len bytes at once (consumer side).
+ *
+ * Nothing is popped if less than len bytes are stored.
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param data Array to store the popped bytes.
+ * @param len Number of bytes.
+ * @return STD_OK or STD_BUFFER_EMPTY.
+ */
+Std_Error_t RingBuf_PopBulk(RingBuf_t *rb, u8 data[], u8 len)
+{
+	Std_Error_t error=STD_BUFFER_EMPTY;
+	u8 tail=rb->tail;
+	u8 i;
+
+	if ((u8)(rb->head-tail) >= len)
+	{
+		memory_barrier();
+		for (i=0; i<len; i++)
+		{
+			data[i]=rb->buffer[(u8)(tail+i) & rb->mask];
+		}
+		memory_barrier(); /*< the whole record must be read before the slots are released */
+		rb->tail=tail+len;
+		error=STD_OK;
+	}
+	return error;
+}
+
+/**
+ * @brief Returns the contiguous free bytes at the head (producer side, zero-copy).
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param region Pointer to store the address of the region.
+ * @return The length of the region (0: the buffer is full).
+ */
+u8 RingBuf_GetWriteRegion(const RingBuf_t *rb, u8 **region)
+{
+	u8 head=rb->head;
+	u8 index=head & rb->mask;
+	u8 freeCount=(u8)(rb->mask+1-(u8)(head-rb->tail));
+	u8 len=(u8)(rb->mask+1-index); /*< to the end of the storage */
+
+	*region=&rb->buffer[index];
+	return (freeCount<len)? freeCount : len;
+}
+
+/**
+ * @brief Publishes len bytes written in the region of RingBuf_GetWriteRegion() (producer side).
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param len Number of bytes, at most the length of the region.
+ */
+void RingBuf_CommitWrite(RingBuf_t *rb, u8 len)
+{
+	memory_barrier(); /*< the bytes must be stored before they are published */
+	rb->head=rb->head+len;
+}
+
+/**
+ * @brief Returns the contiguous stored bytes at the tail (consumer side, zero-copy).
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param region Pointer to store the address of the region.
+ * @return The length of the region (0: the buffer is empty).
+ */
+u8 RingBuf_GetReadRegion(const RingBuf_t *rb, const u8 **region)
+{
+	u8 tail=rb->tail;
+	u8 index=tail & rb->mask;
+	u8 count=(u8)(rb->head-tail);
+	u8 len=(u8)(rb->mask+1-index); /*< to the end of the storage */
+
+	memory_barrier(); /*< the bytes must not be read before head */
+	*region=&rb->buffer[index];
+	return (count<len)? count : len;
+}
+
+/**
+ * @brief Releases len bytes read in the region of RingBuf_GetReadRegion() (consumer side).
+ *
+ * @param rb Pointer to the ring buffer.
+ * @param len Number of bytes, at most the length of the region.
+ */
+void RingBuf_Release(RingBuf_t *rb, u8 len)
+{
+	memory_barrier(); /*< the bytes must be read before the slots are released */
+	rb->tail=rb->tail+len;
+}
+
+/**
+ * @brief Returns the number of stored bytes.
+ */
+u8 RingBuf_Count(const RingBuf_t *rb)
+{
+	return (u8)(rb->head-rb->tail);
+}
+
+/**
+ * @brief Returns the number of free bytes.
+ */
+u8 RingBuf_Free(const RingBuf_t *rb)
+{
+	return (u8)(rb->mask+1-(u8)(rb->head-rb->tail));
+}
+
+/**
+ * @brief Drops all stored bytes (consumer side).
+ */
+void RingBuf_Flush(RingBuf_t *rb)
+{
+	rb->tail=rb->head;
+}
@@ -12,6 +12,14 @@
 #define STD_TYPES_H_
 
 
+#if defined(HOST_BUILD)
+/* host build (05-Host): int and long are wider than on AVR, the widths are taken from the host */
+#include <stdint.h>
+typedef int8_t        sint8_t;     /**< Signed 8-bit integer */
+typedef int16_t       sint16_t;    /**< Signed 16-bit integer */
+typedef int32_t       sint32_t;    /**< Signed 32-bit integer */
+typedef int64_t       sint64_t;    /**< Signed 64-bit integer */
+#else
 typedef unsigned char uint8_t;   /**< Unsigned 8-bit integer */
 typedef signed char   sint8_t;     /**< Signed 8-bit integer */
 
@@ -23,6 +31,7 @@ typedef signed long   sint32_t;    /**< Signed 32-bit integer */
 
 typedef unsigned long long uint64_t;  /**< Unsigned 64-bit integer */
 typedef signed long long sint64_t;    /**< Signed 64-bit integer */
+#endif /* HOST_BUILD */
 
 
 typedef uint8_t  u8;  /**< Unsigned 8-bit integer */
@@ -36,14 +36,27 @@
 #define       BADISR_vect         __vector_default
 
 /* ================================== assembly ================================== */
+#if defined(HOST_BUILD)
+/* host build (05-Host): the I bit of the simulated SREG, the pending interrupts are serviced by sei() */
+#include "HOST_Interface.h"
+#define sei()   HOST_Sei()
+#define cli()   HOST_Cli()
+#define memory_barrier()  __asm__ __volatile__ ("" ::: "memory")
+#define Global_Interrupt_Enable__asm()    HOST_Sei()
+#define Global_Interrupt_Disable__asm()   HOST_Cli()
+#else
 #define sei()   __asm__ __volatile__ ("sei"  ::)
 #define cli()   __asm__ __volatile__ ("cli"  ::)
 #define reti()  __asm__ __volatile__ ("reti" ::)
 #define ret()   __asm__ __volatile__ ("ret"  ::)
 
+/* compiler memory barrier: memory accesses are not moved across it (no instruction is emitted) */
+#define memory_barrier()  __asm__ __volatile__ ("" ::: "memory")
+
 /* ================================== Global interrupt enable/disable ================================== */
 #define Global_Interrupt_Enable__asm()    __asm__ __volatile__ ("sei" ::)
 #define Global_Interrupt_Disable__asm()   __asm__ __volatile__ ("cli" ::)
+#endif /* HOST_BUILD */
 
 /* ================================== attributes ================================== */
 /** \def ISR_BLOCK
@@ -99,8 +112,14 @@ ISR(INT0_VECT,ISR_NOBLOCK)
 								//ISR_CODE
 							}
 */
+#if defined(HOST_BUILD)
+/* host build: a plain function called by the interrupt dispatcher of the host port (HOST_Prog.c) */
+#  define ISR(vector,...)            \
+void vector (void)
+#else
 #  define ISR(vector,...)            \
 void vector (void) __attribute__ ((signal))__VA_ARGS__ ; \
 void vector (void)
+#endif /* HOST_BUILD */
 
 #endif /* UTILS_INTERRUPT_H_ */
\ No newline at end of file
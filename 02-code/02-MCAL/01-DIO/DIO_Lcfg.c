@@ -33,37 +33,37 @@ const DIO_PIN_DIRECTION_t arrOfPinsStatus[DIO_TOTAL_PINS]={
 	DIO_PIN_DIRECTION_INPUT_PULLUP,          /* PA1 (ADC1) */
 	DIO_PIN_DIRECTION_INPUT_PULLUP,          /* PA2 (ADC2) */
 	DIO_PIN_DIRECTION_INPUT_PULLUP,          /* PA3 (ADC3) */
-	DIO_PIN_DIRECTION_INPUT_PULLUP,          /* PA4 (ADC4) */
+	DIO_PIN_DIRECTION_INPUT_PULLUP,          /* PA4 (ADC4) keypad col 3 */
 	DIO_PIN_DIRECTION_INPUT_PULLUP,          /* PA5 (ADC5) */
 	DIO_PIN_DIRECTION_OUTPUT,          /* PA6 (ADC6) */
 	DIO_PIN_DIRECTION_OUTPUT,          /* PA7 (ADC7) */	
 	
 	DIO_PIN_DIRECTION_OUTPUT,          /* PB0  (XCK/T0)    */	
 	DIO_PIN_DIRECTION_OUTPUT,          /* PB1  (T1) 	   */
-	DIO_PIN_DIRECTION_OUTPUT,          /* PB2  (INT2/AIN0) */  
+	DIO_PIN_DIRECTION_INPUT_PULLUP,    /* PB2  (INT2/AIN0) */  
 	DIO_PIN_DIRECTION_OUTPUT,          /* PB3  (OC0/AIN1)  */	
-	DIO_PIN_DIRECTION_INPUT_PULLUP,    /* PB4  (SS)        */	
-	DIO_PIN_DIRECTION_OUTPUT,          /* PB5  (MOSI)      */	
-	DIO_PIN_DIRECTION_OUTPUT,          /* PB6  (MISO)      */	
-	DIO_PIN_DIRECTION_OUTPUT,          /* PB7  (SCK)       */	
+	DIO_PIN_DIRECTION_OUTPUT,          /* PB4  (SS)   LCD D4 */	
+	DIO_PIN_DIRECTION_OUTPUT,          /* PB5  (MOSI) LCD D5 */	
+	DIO_PIN_DIRECTION_OUTPUT,          /* PB6  (MISO) LCD D6 */	
+	DIO_PIN_DIRECTION_OUTPUT,          /* PB7  (SCK)  LCD D7 */	
 	
 	DIO_PIN_DIRECTION_OUTPUT,          /* PC0 (SCL)	 */	 
 	DIO_PIN_DIRECTION_OUTPUT,          /* PC1 (SDA)	 */	
 	DIO_PIN_DIRECTION_OUTPUT,          /* PC2 (TCK)	 */	
 	DIO_PIN_DIRECTION_OUTPUT,          /* PC3 (TMS)	 */	
-	DIO_PIN_DIRECTION_OUTPUT,          /* PC4 (TDO)	 */	
-	DIO_PIN_DIRECTION_OUTPUT,          /* PC5 (TDI)	 */	
-	DIO_PIN_DIRECTION_OUTPUT,          /* PC6 (TOSC1)*/	
-	DIO_PIN_DIRECTION_OUTPUT,          /* PC7 (TOSC2)*/	
+	DIO_PIN_DIRECTION_OUTPUT,          /* PC4 (TDO)	 keypad row 0 */	
+	DIO_PIN_DIRECTION_OUTPUT,          /* PC5 (TDI)	 keypad row 1 */	
+	DIO_PIN_DIRECTION_INPUT_FREE,      /* PC6 (TOSC1) RTC crystal */	
+	DIO_PIN_DIRECTION_INPUT_FREE,      /* PC7 (TOSC2) RTC crystal */	
 	
-	DIO_PIN_DIRECTION_OUTPUT,          /* PD0 (RXD)  */
-	DIO_PIN_DIRECTION_OUTPUT,          /* PD1 (TXD)  */
+	DIO_PIN_DIRECTION_INPUT_PULLUP,    /* PD0 (RXD)  USART, the pull-up keeps the line idle when nothing is connected */
+	DIO_PIN_DIRECTION_OUTPUT,          /* PD1 (TXD)  USART */
 	
 	DIO_PIN_DIRECTION_OUTPUT,    /* PD2 (INT0) */
 	
 	DIO_PIN_DIRECTION_OUTPUT,          /* PD3 (INT1) */
 	DIO_PIN_DIRECTION_INPUT_PULLUP,          /* PD4 (OC1B) */
 	DIO_PIN_DIRECTION_INPUT_PULLUP,          /* PD5 (OC1A) */
-	DIO_PIN_DIRECTION_INPUT_PULLUP,          /* PD6 (ICP)  */
+	DIO_PIN_DIRECTION_INPUT_PULLUP,          /* PD6 (ICP)  turntable encoder */
 	DIO_PIN_DIRECTION_INPUT_PULLUP     /* PD7 (OC2)  */	
 	};
\ No newline at end of file
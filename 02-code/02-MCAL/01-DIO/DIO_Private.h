@@ -11,6 +11,13 @@
 #ifndef DIO_PRIVATE_H_
 #define DIO_PRIVATE_H_
 
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              MACROS                                         */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+#define MCUCSR_JTD              7   /*< JTAG interface disable */
+
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
 /*                              PRIVATE Functions                              */
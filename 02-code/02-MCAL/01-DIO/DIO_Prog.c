@@ -18,6 +18,7 @@
 #include "Std_Types.h"
 #include "MemMap.h"
 #include "Utils_BitMath.h"
+#include "Utils_interrupt.h"
 
 #include "DIO_Interface.h"
 #include "DIO_Private.h"
@@ -90,6 +91,21 @@ void Dio_Init(void)
 	}
 }
 
+/**
+ * @brief Disables the JTAG interface (timed sequence: JTD written twice within 4 cycles).
+ */
+void Dio_DisableJtag(void)
+{
+	u8 sreg=SREG;
+	u8 mcucsr;
+
+	Global_Interrupt_Disable__asm(); /*< an interrupt would break the 4 cycles sequence */
+	mcucsr=MCUCSR|(1<<MCUCSR_JTD);
+	MCUCSR=mcucsr;
+	MCUCSR=mcucsr;
+	SREG=sreg;
+}
+
 /**
  * @brief Reads the voltage level of a specific pin.
  *
@@ -115,12 +131,18 @@ DIO_VOLTAGE_LEVEL_t Dio_ReadPin(const DIO_PIN_t pin)
  * @param pin The pin number to set its voltage level.
  * @param volt The voltage level to be set (HIGH or LOW).
  *
+ * @note The read-modify-write of the port is done with the interrupts disabled, so it is safe
+ *       when an ISR (or a preempting task) writes another pin of the same port.
+ *
  * @return None.
  */
 void Dio_WritePin(const DIO_PIN_t pin, const DIO_VOLTAGE_LEVEL_t volt)
 {
 	volatile u8 *arrOf_PORT[]={&PORTA,&PORTB,&PORTC,&PORTD};
+	u8 sreg=SREG;
+	Global_Interrupt_Disable__asm();
 	write_bit(*arrOf_PORT[pin/8],pin%8,volt); /**< Set the voltage level of the specified pin */
+	SREG=sreg;
 }
 
 /**
@@ -135,7 +157,10 @@ void Dio_WritePin(const DIO_PIN_t pin, const DIO_VOLTAGE_LEVEL_t volt)
 void Dio_TogglePin(const DIO_PIN_t pin)
 {
 	volatile u8 *arrOf_PORT[]={&PORTA,&PORTB,&PORTC,&PORTD};
+	u8 sreg=SREG;
+	Global_Interrupt_Disable__asm(); /*< atomic read-modify-write (see Dio_WritePin()) */
 	toggle_bit(*arrOf_PORT[pin/8],pin%8);
+	SREG=sreg;
 }
 
 
@@ -156,7 +181,10 @@ void Dio_WritePort(const DIO_PORT_t port, const u8 value)
 void Dio_WritePortMaskedValue(const DIO_PORT_t port,const u8 mask ,const u8 value)
 {
 	volatile u8 *arrOf_PORT[]={&PORTA,&PORTB,&PORTC,&PORTD};
+	u8 sreg=SREG;
+	Global_Interrupt_Disable__asm(); /*< atomic read-modify-write (see Dio_WritePin()) */
 	write_masked_value(*arrOf_PORT[port],mask,value);
+	SREG=sreg;
 }
 
 /**
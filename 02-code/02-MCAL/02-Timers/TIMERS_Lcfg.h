@@ -2,8 +2,42 @@
 #ifndef TIMERS_LCFG_H_
 #define TIMERS_LCFG_H_
 
+/**
+ * @brief The owner (binding) of an interrupt vector of the timers.
+ *  - TIMER_ISR_DRIVER : runtime binding, the driver defines the ISR and calls the callback set by TIMERx_xxx_SetCallBack().
+ *                       The indirect call makes the ISR save all the call-clobbered registers:
+ *                       the overhead is estimated at about 86 cycles + the callback, not measured yet
+ *                       (bench.py --heater-isr both).
+ *  - TIMER_ISR_APP    : build-time binding, the driver does not define the ISR, the application defines
+ *                       ISR(TIMERx_xxx_VECT) itself and only the registers it uses are saved
+ *                       (TIMERx_xxx_SetCallBack() has no effect for this vector).
+ */
+#define TIMER_ISR_DRIVER          0
+#define TIMER_ISR_APP             1
 
-
-
+/**
+ * @brief The owner of each vector.
+ *
+ * TIMER0_COMP : the tick of the uptime service (UPTIME_Prog.c) or of the preemptive kernel (OS_Prog.c),
+ *               must be TIMER_ISR_APP when the kernel is enabled (OS_PREEMPTIVE==OS_ON in OS_Lcfg.h).
+ * TIMER1_COMPA: the 1s cooking timer and the start of the heater power window (main.c, CTC mode OCR1A TOP).
+ * TIMER1_COMPB: the end of the heater ON time in the power window (main.c).
+ * TIMER1_CAPT : the turntable encoder pulses (Turntable_Prog.c).
+ * TIMER2_OVF  : the 1s tick of the real-time clock, asynchronous TIMER2 (RTC_Prog.c).
+ *
+ * The heater vectors can be set from the command line to compare the bindings (bench.py/isr.py --heater-isr driver).
+ */
+#define TIMER0_OVF_ISR_OWNER      TIMER_ISR_DRIVER
+#define TIMER0_COMP_ISR_OWNER     TIMER_ISR_APP
+#define TIMER1_OVF_ISR_OWNER      TIMER_ISR_DRIVER
+#ifndef TIMER1_COMPA_ISR_OWNER
+#define TIMER1_COMPA_ISR_OWNER    TIMER_ISR_APP
+#endif
+#ifndef TIMER1_COMPB_ISR_OWNER
+#define TIMER1_COMPB_ISR_OWNER    TIMER_ISR_APP
+#endif
+#define TIMER1_CAPT_ISR_OWNER     TIMER_ISR_APP
+#define TIMER2_OVF_ISR_OWNER      TIMER_ISR_APP
+#define TIMER2_COMP_ISR_OWNER     TIMER_ISR_DRIVER
 
 #endif /* TIMERS_LCFG_H_ */
\ No newline at end of file
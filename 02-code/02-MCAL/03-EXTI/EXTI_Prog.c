@@ -17,6 +17,7 @@
 
 #include "EXTI_Interface.h"
 #include "EXTI_private.h"
+#include "EXTI_Lcfg.h"
 
 /*-----------------------------------------------------------------------------*/
 /*                                                                             */
@@ -89,6 +90,9 @@ void EXTI_SetTrigger(EXTI_Source_t EXTI_INT, EXTI_Trigger_Edge_t Trigger_Edge)
 				case RISING_EDGE:
 					set_bit(MCUCSR, MCUCSR_ISC2);
 					break;
+				default:
+					//INT2 is edge triggered only: no low level or any logical change sense
+					break;
 			}
 			break;
 	}
@@ -212,6 +216,7 @@ void EXTI_SetCallBack(EXTI_Source_t EXTI_INT, void(*LocalPtr)(void) )
 /*                         Interrupt Service Routines                          */
 /*                                                                             */
 /*-----------------------------------------------------------------------------*/
+#if (INT0_ISR_OWNER==EXTI_ISR_DRIVER)
 ISR(INT0_VECT)
 {
 	if (pfCallBackInt0!=NULL_PTR)
@@ -219,6 +224,8 @@ ISR(INT0_VECT)
 		pfCallBackInt0();
 	}
 }
+#endif
+#if (INT1_ISR_OWNER==EXTI_ISR_DRIVER)
 ISR(INT1_VECT)
 {
 	if (pfCallBackInt1!=NULL_PTR)
@@ -226,6 +233,8 @@ ISR(INT1_VECT)
 		pfCallBackInt1();
 	}
 }
+#endif
+#if (INT2_ISR_OWNER==EXTI_ISR_DRIVER)
 ISR(INT2_VECT)
 {
 	if (pfCallBackInt2!=NULL_PTR)
@@ -233,3 +242,4 @@ ISR(INT2_VECT)
 		pfCallBackInt2();
 	}
 }
+#endif
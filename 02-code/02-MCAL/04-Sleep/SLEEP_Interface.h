@@ -0,0 +1,66 @@
+/**
+ * @file SLEEP_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the sleep module of the microcontroller.
+ *         The CPU is stopped until an enabled interrupt wakes it up:
+ *          - SLEEP_IDLE       : the CPU clock is stopped, the timers, EXTI, USART, ADC keep running (any interrupt wakes up).
+ *          - SLEEP_POWER_SAVE : only the asynchronous TIMER2, EXTI and TWI address match wake up (TIMER0/TIMER1 stop).
+ *          - SLEEP_POWER_DOWN : only EXTI (INT2 edge, INT0/INT1 level), TWI and the watchdog wake up.
+ *
+ * @par Example (no lost wake-up: the condition is checked with the interrupts disabled):
+ *   @code
+ *    SLEEP_SetMode(SLEEP_IDLE);
+ *    Global_Interrupt_Disable__asm();
+ *    if (isWorkPending==STD_FALSE)
+ *    {
+ *        SLEEP_Enter();   // enables the interrupts and sleeps in one step, returns after the wake-up ISR
+ *    }
+ *    Global_Interrupt_Enable__asm();
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SLEEP_INTERFACE_H_
+#define SLEEP_INTERFACE_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef enum {
+	// SM2 SM1 SM0
+	SLEEP_IDLE               =0,  // 0   0   0
+	SLEEP_ADC_NOISE_REDUCTION=1,  // 0   0   1
+	SLEEP_POWER_DOWN         =2,  // 0   1   0
+	SLEEP_POWER_SAVE         =3,  // 0   1   1
+	SLEEP_STANDBY            =6,  // 1   1   0  (external crystal only)
+	SLEEP_EXTENDED_STANDBY   =7   // 1   1   1  (external crystal only)
+	}SLEEP_Mode_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Selects the sleep mode used by SLEEP_Enter() (the EXTI sense bits of MCUCR are kept).
+ *
+ * @param mode The sleep mode.
+ */
+void SLEEP_SetMode(SLEEP_Mode_t mode);
+
+/**
+ * @brief Enables the global interrupt and sleeps in one step (sei then sleep: no interrupt can run between them),
+ *        returns after the ISR that woke the CPU up.
+ *
+ * @note Must be called with the interrupts disabled, after the sleep condition was checked.
+ *       The global interrupt is enabled when it returns.
+ */
+void SLEEP_Enter(void);
+
+#endif /* SLEEP_INTERFACE_H_ */
@@ -0,0 +1,58 @@
+/**
+ * @file SLEEP_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the sleep module of the microcontroller.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see SLEEP_Interface.h
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_BitMath.h"
+#include "Utils_interrupt.h"
+
+// own module files
+#include "SLEEP_Interface.h"
+#include "SLEEP_Private.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Selects the sleep mode used by SLEEP_Enter() (the EXTI sense bits of MCUCR are kept).
+ */
+void SLEEP_SetMode(SLEEP_Mode_t mode)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm(); /*< MCUCR is shared with the EXTI driver */
+	write_masked_value(MCUCR, SLEEP_MODE_MASK, (u8)(mode<<MCUCR_SM0));
+	SREG=sreg;
+}
+
+/**
+ * @brief Enables the global interrupt and sleeps in one step, returns after the ISR that woke the CPU up.
+ */
+void SLEEP_Enter(void)
+{
+	set_bit(MCUCR, MCUCR_SE);
+#if defined(HOST_BUILD)
+	HOST_Sleep(); /*< the virtual time runs until an interrupt is serviced */
+#else
+	__asm__ __volatile__ (
+		"sei   \n\t"  /*< the instruction after sei runs before any pending interrupt */
+		"sleep \n\t"
+		::: "memory"
+	);
+#endif
+	clear_bit(MCUCR, MCUCR_SE);
+}
@@ -0,0 +1,66 @@
+/**
+ * @file WDT_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the watchdog timer of the microcontroller.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see WDT_Interface.h
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_BitMath.h"
+#include "Utils_interrupt.h"
+
+// own module files
+#include "WDT_Interface.h"
+#include "WDT_Private.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Resets then enables the watchdog with the selected timeout (or changes the timeout).
+ */
+void WDT_Enable(WDT_Timeout_t timeout)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm();
+	WDT_Reset__asm(); /*< the new timeout starts from 0 */
+	WDTCR=(1<<WDTCR_WDE)|((u8)timeout&0b00000111);
+	SREG=sreg;
+}
+
+/**
+ * @brief Disables the watchdog (timed sequence: WDTOE and WDE, then 0 within 4 cycles).
+ */
+void WDT_Disable(void)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm(); /*< an interrupt would break the 4 cycles sequence */
+	WDT_Reset__asm();
+	WDTCR=(1<<WDTCR_WDTOE)|(1<<WDTCR_WDE);
+	WDTCR=0;
+	SREG=sreg;
+}
+
+/**
+ * @brief Returns the reset flags of MCUCSR (WDT_RESET_xxx) and clears them, to be called once at startup.
+ */
+u8 WDT_GetResetCause(void)
+{
+	u8 cause=MCUCSR&WDT_RESET_FLAGS_MASK;
+
+	MCUCSR&=(u8)~WDT_RESET_FLAGS_MASK; /*< cleared by writing 0, so the next reset cause is not mixed with this one */
+	return cause;
+}
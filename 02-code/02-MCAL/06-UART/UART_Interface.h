@@ -0,0 +1,139 @@
+/**
+ * @file UART_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the USART driver (asynchronous, RXD on PD0, TXD on PD1).
+ *         The driver owns the USART interrupts:
+ *         - TX: the tasks write into the TX ring buffer, the data register empty ISR (UDRE) sends it byte by byte and
+ *               disables itself when the buffer is empty.
+ *         - RX: the receive complete ISR (RXC) stores the bytes into the RX ring buffer, the tasks read them.
+ *               A byte with a framing or parity error is dropped, the lost bytes are counted (UART_GetStats()).
+ *
+ *         Both sides have a zero-copy API for the framing: a frame is built in place in the TX buffer
+ *         (UART_TxGetRegion()/UART_TxCommit()) and parsed in place in the RX buffer (UART_RxGetRegion()/UART_RxRelease()).
+ *
+ * @note The ring buffers are single-producer/single-consumer: one task writes (TX) and one task reads (RX).
+ *       The USART is stopped in the Power-down and Power-save sleep modes, the Idle mode keeps it running.
+ *
+ * @par Example:
+ *   @code
+ *    UART_Init();
+ *    (void)UART_Write((const u8*)"OK\r\n",4);
+ *
+ *    u8 *frame;
+ *    if (UART_TxGetRegion(&frame)>=3)                // in place: no copy
+ *    {
+ *        frame[0]=0x7E; frame[1]=state; frame[2]=seconds;
+ *        (void)UART_TxCommit(3);
+ *    }
+ *
+ *    const u8 *rx;
+ *    u8 len=UART_RxGetRegion(&rx);                   // parse rx[0..len-1] in place
+ *    UART_RxRelease(len);
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef UART_INTERFACE_H_
+#define UART_INTERFACE_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The counters of the lost RX bytes (saturated at 65535).
+ */
+typedef struct
+{
+	u16 rxOverruns;       /**< bytes lost in the hardware: the RXC ISR was late (data overrun) */
+	u16 rxOverflows;      /**< bytes lost because the RX ring buffer was full (the tasks were late) */
+	u16 framingErrors;    /**< bytes dropped: no stop bit (wrong baud rate, noise, break) */
+	u16 parityErrors;     /**< bytes dropped: wrong parity (UART_PARITY) */
+}UART_Stats_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes the USART (UART_Lcfg.h): the baud rate, the frame format, the receiver and the transmitter,
+ *        the RX interrupt. The buffers are emptied and the counters cleared.
+ */
+void UART_Init(void);
+
+/**
+ * @brief Writes len bytes to the TX buffer and starts the transmission.
+ *
+ * All the bytes are written or none of them (a frame is never torn).
+ *
+ * @param data The bytes.
+ * @param len Number of bytes.
+ * @return STD_OK , STD_NULL_POINTER or STD_BUFFER_FULL (not enough free bytes, nothing written).
+ */
+Std_Error_t UART_Write(const u8 data[], u8 len);
+
+/**
+ * @brief Reads one received byte.
+ *
+ * @param data Pointer to store the byte.
+ * @return STD_OK , STD_NULL_POINTER or STD_BUFFER_EMPTY.
+ */
+Std_Error_t UART_Read(u8 *data);
+
+/**
+ * @brief Returns the contiguous free bytes of the TX buffer, the frame is written there then sent by UART_TxCommit().
+ *
+ * The region ends at the end of the buffer storage (a longer frame takes two regions, committed one by one).
+ *
+ * @param region Pointer to store the address of the region.
+ * @return The length of the region (0: the buffer is full).
+ */
+u8 UART_TxGetRegion(u8 **region);
+
+/**
+ * @brief Sends len bytes written in the region of UART_TxGetRegion().
+ *
+ * @param len Number of bytes.
+ * @return STD_OK or STD_INVALID_ARG (len is longer than the region, nothing sent).
+ */
+Std_Error_t UART_TxCommit(u8 len);
+
+/**
+ * @brief Returns the contiguous received bytes, they are read in place then released by UART_RxRelease().
+ *
+ * The region ends at the end of the buffer storage, the next bytes are the next region.
+ *
+ * @param region Pointer to store the address of the region.
+ * @return The length of the region (0: nothing received).
+ */
+u8 UART_RxGetRegion(const u8 **region);
+
+/**
+ * @brief Releases len bytes read in the region of UART_RxGetRegion().
+ *
+ * @param len Number of bytes.
+ * @return STD_OK or STD_INVALID_ARG (len is longer than the region, nothing released).
+ */
+Std_Error_t UART_RxRelease(u8 len);
+
+/**
+ * @brief Returns whether everything written was sent (the TX buffer is empty and the last stop bit is out),
+ *        before a sleep mode that stops the USART. TRUE when nothing was written since UART_Init().
+ */
+Std_Bool_t UART_IsTxIdle(void);
+
+/**
+ * @brief Copies the counters of the lost RX bytes.
+ *
+ * @param stats Pointer to store the counters.
+ * @return STD_OK or STD_NULL_POINTER.
+ */
+Std_Error_t UART_GetStats(UART_Stats_t *stats);
+
+#endif /* UART_INTERFACE_H_ */
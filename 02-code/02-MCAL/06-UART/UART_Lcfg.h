@@ -0,0 +1,50 @@
+/**
+ * @file UART_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the USART driver.
+ *         - the baud rate (UBRR and U2X are computed from F_CPU at compile time)
+ *         - the frame format
+ *         - the sizes of the TX and RX ring buffers
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef UART_LCFG_H_
+#define UART_LCFG_H_
+
+/**
+ * @brief The baud rate in bits per second.
+ *
+ * The driver selects the normal or the double speed mode (U2X) with the smaller error,
+ * the build fails (UART_Prog.c) when the error is above UART_MAX_ERROR_PERMILLE.
+ * F_CPU=8MHz: 2400..38400 are within 0.2%, 57600 is 2.1% (U2X) and 115200 is 3.5%: above the default limit.
+ */
+#define UART_BAUD                 9600UL
+
+/**
+ * @brief The largest accepted error of the baud rate, in per mille (each side of the link adds its own).
+ */
+#define UART_MAX_ERROR_PERMILLE   20
+
+#define UART_PARITY_NONE          0
+#define UART_PARITY_EVEN          2
+#define UART_PARITY_ODD           3
+
+/**
+ * @brief The frame format: 8 data bits, the parity and the stop bits (1 or 2).
+ */
+#define UART_PARITY               UART_PARITY_NONE
+#define UART_STOP_BITS            1
+
+/**
+ * @brief The sizes of the ring buffers in bytes (power of two, 2 to RINGBUF_MAX_SIZE).
+ *
+ * TX: the longest message written at once (UART_Write() is all-or-nothing).
+ * RX: the bytes received between two reads, UART_BAUD/10 bytes per second (960 at 9600: 32 bytes are 33ms).
+ */
+#define UART_TX_SIZE              64
+#define UART_RX_SIZE              32
+
+#endif /* UART_LCFG_H_ */
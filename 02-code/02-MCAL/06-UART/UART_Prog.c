@@ -0,0 +1,259 @@
+/**
+ * @file UART_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the interrupt driven USART driver.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see UART_Interface.h
+ * @see UART_Lcfg.h
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_BitMath.h"
+#include "Utils_interrupt.h"
+#include "RingBuffer.h"
+
+// MCAL
+#include "MCU_config.h"
+
+// own module files
+#include "UART_Interface.h"
+#include "UART_Lcfg.h"
+#include "UART_Private.h"
+
+#if (UART_ERROR_PERMILLE(16)>UART_MAX_ERROR_PERMILLE) && (UART_ERROR_PERMILLE(8)>UART_MAX_ERROR_PERMILLE)
+#error "F_CPU can't generate UART_BAUD within UART_MAX_ERROR_PERMILLE (UART_Lcfg.h)"
+#endif
+#if (UART_UBRR(UART_SAMPLES)>4095)
+#error "UART_BAUD is too slow for F_CPU: UBRR has 12 bits (UART_Lcfg.h)"
+#endif
+#if ((UART_PARITY!=UART_PARITY_NONE) && (UART_PARITY!=UART_PARITY_EVEN) && (UART_PARITY!=UART_PARITY_ODD)) || \
+    ((UART_STOP_BITS!=1) && (UART_STOP_BITS!=2))
+#error "wrong UART_PARITY or UART_STOP_BITS (UART_Lcfg.h)"
+#endif
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes the USART: the baud rate, the frame format, the receiver, the transmitter and the RX interrupt.
+ */
+void UART_Init(void)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm();
+	UCSRB=0; /*< stopped while it is configured */
+	UBRRH=(u8)(UART_UBRR_VALUE>>8); /*< URSEL=0: UBRRH */
+	UBRRL=(u8)UART_UBRR_VALUE;
+	UCSRA=(UART_USE_U2X)? (1<<UCSRA_U2X) : 0;
+	UCSRC=(1<<UCSRC_URSEL)|(1<<UCSRC_UCSZ1)|(1<<UCSRC_UCSZ0)|           /*< asynchronous, 8 data bits */
+	      ((u8)UART_PARITY<<UCSRC_UPM0)|((u8)(UART_STOP_BITS-1)<<UCSRC_USBS);
+	RingBuf_Flush(&UART_TxBuffer);
+	RingBuf_Flush(&UART_RxBuffer);
+	UART_Stats.rxOverruns=0;
+	UART_Stats.rxOverflows=0;
+	UART_Stats.framingErrors=0;
+	UART_Stats.parityErrors=0;
+	UART_IsTxUsed=STD_FALSE;
+	UCSRB=(1<<UCSRB_RXEN)|(1<<UCSRB_TXEN)|(1<<UCSRB_RXCIE); /*< UDRIE is enabled by the writes */
+	SREG=sreg;
+}
+
+/**
+ * @brief Writes len bytes to the TX buffer and starts the transmission.
+ */
+Std_Error_t UART_Write(const u8 data[], u8 len)
+{
+	Std_Error_t error;
+
+	if (data==NULL_PTR)
+	{
+		error=STD_NULL_POINTER;
+	}
+	else
+	{
+		error=RingBuf_PushBulk(&UART_TxBuffer,data,len);
+		if (error==STD_OK)
+		{
+			UART_IsTxUsed=STD_TRUE;
+			set_bit(UCSRB,UCSRB_UDRIE); /*< sbi: atomic, the UDRE ISR clears it when the buffer is empty */
+		}
+	}
+	return error;
+}
+
+/**
+ * @brief Reads one received byte.
+ */
+Std_Error_t UART_Read(u8 *data)
+{
+	Std_Error_t error;
+
+	if (data==NULL_PTR)
+	{
+		error=STD_NULL_POINTER;
+	}
+	else
+	{
+		error=RingBuf_Pop(&UART_RxBuffer,data);
+	}
+	return error;
+}
+
+/**
+ * @brief Returns the contiguous free bytes of the TX buffer.
+ */
+u8 UART_TxGetRegion(u8 **region)
+{
+	return RingBuf_GetWriteRegion(&UART_TxBuffer,region);
+}
+
+/**
+ * @brief Sends len bytes written in the region of UART_TxGetRegion().
+ */
+Std_Error_t UART_TxCommit(u8 len)
+{
+	Std_Error_t error=STD_INVALID_ARG;
+	u8 *region;
+
+	if (len<=RingBuf_GetWriteRegion(&UART_TxBuffer,&region)) /*< the region only grows while the ISR sends */
+	{
+		RingBuf_CommitWrite(&UART_TxBuffer,len);
+		UART_IsTxUsed=STD_TRUE;
+		set_bit(UCSRB,UCSRB_UDRIE);
+		error=STD_OK;
+	}
+	return error;
+}
+
+/**
+ * @brief Returns the contiguous received bytes.
+ */
+u8 UART_RxGetRegion(const u8 **region)
+{
+	return RingBuf_GetReadRegion(&UART_RxBuffer,region);
+}
+
+/**
+ * @brief Releases len bytes read in the region of UART_RxGetRegion().
+ */
+Std_Error_t UART_RxRelease(u8 len)
+{
+	Std_Error_t error=STD_INVALID_ARG;
+	const u8 *region;
+
+	if (len<=RingBuf_GetReadRegion(&UART_RxBuffer,&region)) /*< the region only grows while the ISR receives */
+	{
+		RingBuf_Release(&UART_RxBuffer,len);
+		error=STD_OK;
+	}
+	return error;
+}
+
+/**
+ * @brief Returns whether everything written was sent.
+ */
+Std_Bool_t UART_IsTxIdle(void)
+{
+	Std_Bool_t isIdle=STD_FALSE;
+
+	if (UART_IsTxUsed==STD_FALSE)
+	{
+		isIdle=STD_TRUE; /*< nothing written: TXC is never set */
+	}
+	else if ((RingBuf_Count(&UART_TxBuffer)==0) && (get_bit(UCSRB,UCSRB_UDRIE)==0) && (get_bit(UCSRA,UCSRA_TXC)==1))
+	{
+		isIdle=STD_TRUE;
+	}
+	else
+	{
+		//sending
+	}
+	return isIdle;
+}
+
+/**
+ * @brief Copies the counters of the lost RX bytes.
+ */
+Std_Error_t UART_GetStats(UART_Stats_t *stats)
+{
+	Std_Error_t error=STD_OK;
+	u8 sreg;
+
+	if (stats==NULL_PTR)
+	{
+		error=STD_NULL_POINTER;
+	}
+	else
+	{
+		sreg=SREG;
+		Global_Interrupt_Disable__asm(); /*< 16-bit counters written by the RXC ISR */
+		*stats=UART_Stats;
+		SREG=sreg;
+	}
+	return error;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Interrupt Service Routines                          */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+/**
+ * @brief A byte was received: the status is read before UDR (reading UDR clears it).
+ */
+ISR(USART_RXC_VECT)
+{
+	u8 status=UCSRA;
+	u8 data=UDR;
+
+	if (get_bit(status,UCSRA_DOR)==1)
+	{
+		UART_COUNT(UART_Stats.rxOverruns); /*< the bytes before this one were lost, this one is valid */
+	}
+	if (get_bit(status,UCSRA_FE)==1)
+	{
+		UART_COUNT(UART_Stats.framingErrors);
+	}
+	else if (get_bit(status,UCSRA_PE)==1)
+	{
+		UART_COUNT(UART_Stats.parityErrors);
+	}
+	else if (RingBuf_Push(&UART_RxBuffer,data)!=STD_OK)
+	{
+		UART_COUNT(UART_Stats.rxOverflows);
+	}
+	else
+	{
+		//stored
+	}
+}
+
+/**
+ * @brief The data register is empty: sends the next byte, or disables itself when the TX buffer is empty
+ *        (UDRE stays set, the interrupt would fire again at once).
+ */
+ISR(USART_UDRE_VECT)
+{
+	u8 data;
+
+	if (RingBuf_Pop(&UART_TxBuffer,&data)==STD_OK)
+	{
+		UCSRA=(u8)((UCSRA&(1<<UCSRA_U2X))|(1<<UCSRA_TXC)); /*< TXC cleared (written 1): set again after this byte */
+		UDR=data;
+	}
+	else
+	{
+		clear_bit(UCSRB,UCSRB_UDRIE);
+	}
+}
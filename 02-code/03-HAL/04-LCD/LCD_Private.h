@@ -56,56 +56,7 @@ typedef struct
     u8 LCD_pins[8];
 }LCD_CONFIG_t;
 
-/*------------------------------------------------------------------------------*/
-/*                                                                              */
-/*                                  Static Global Varibles                      */
-/*                                                                              */
-/*------------------------------------------------------------------------------*/
-
-/*
-* defualt is: Display off , Cursor off , Blink off 
-*/
-static u8 LCD_u8displayOnOffControlBuffer[copy_LCD_Quantity] ={0}; /**< static array (Act as "R/W" REG) to set the display on/off control of the LCD. */
-
 extern const LCD_CONFIG_t  LCD_arrOfLCD[copy_LCD_Quantity];
 
 
-/*-----------------------------------------------------------------------------*/
-/*                                                                             */
-/*                              PRIVATE Functions                              */
-/*                                                                             */
-/*-----------------------------------------------------------------------------*/
-
-/**
- * @brief Generates a pulse on the enable (EN) pin of the LCD.
- *
- * This function generates a pulse on the enable (EN) pin of the LCD to initiate data transfer or command execution.
- * It sets the EN pin to high voltage for a short duration, then sets it back to low voltage.
- *
- * @param copy_u8_LCD_ID The ID of the LCD module.
- */
-static void LCD_EN_Pulse(u8 copy_u8_LCD_ID);
-
-/**
- * @brief Writes a command to the LCD module.
- *
- * This function writes command to the LCD based on the specified LCD ID and command value.
- * It supports both 8-bit and 4-bit modes of operation.
- *
- * @param copy_u8_LCD_ID The ID of the LCD module.
- * @param cmd The command to be written.
- */
-static void LCD_WriteCMD(u8 copy_u8_LCD_ID, u8 cmd);
-
-/**
- * @brief Writes data to the LCD.
- * 
- * This function writes data to the LCD based on the specified LCD ID and data value.
- * It supports both 8-bit and 4-bit modes of operation.
- * 
- * @param copy_u8_LCD_ID The ID of the LCD.
- * @param data The data to be written to the LCD.
- */
-static void LCD_WriteData(u8 copy_u8_LCD_ID, u8 data);
-
 #endif /* LCD_PRIVATE_H_ */
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include "Std_Types.h"
 #include "Std_Lib.h"
 #include "Utils_BitMath.h"
+#include "Protothread.h"
 
 /*
 * Include MCAL layer files
@@ -30,9 +31,24 @@
 /*
 * Include own files
 */
-#include "LCD_interface.h"
-#include "LCD_lcfg.h"
-#include "LCD_private.h"
+#include "LCD_Interface.h"
+#include "LCD_Lcfg.h"
+#include "LCD_Private.h"
+
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  Static Global Varibles                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+
+/*
+* defualt is: Display off , Cursor off , Blink off 
+*/
+static u8 LCD_u8displayOnOffControlBuffer[copy_LCD_Quantity] ={0}; /**< static array (Act as "R/W" REG) to set the display on/off control of the LCD. */
+
+static PT_t LCD_arrInitPt[copy_LCD_Quantity]={0}; /**< protothread state of LCD_InitAsync() for each LCD. */
+static u16  LCD_arrInitTimestamp[copy_LCD_Quantity]; /**< start time of the current wait of LCD_InitAsync() for each LCD. */
 
 
 /*-----------------------------------------------------------------------------*/
@@ -211,43 +227,67 @@ void LCD_BackSpace(u8 copy_u8_LCD_ID)
  * LCD_Ldfg.c has an array of LCD_CONFIG_t structures that contains the configuration of each LCD.
  * lcd_init() must be called before any other LCD functions.
  * It sets the function set, display off control, clears the display, and sets the entry mode.
- * @see	LCD_lcfg.c
+ * @see	LCD_Lcfg.c
  * @param copy_u8_LCD_ID The ID of the LCD.
  */
 void LCD_init(u8 copy_u8_LCD_ID)
 {
-	_delay_ms(LCD_poweron_time_ms);
+	u16 local_u16NowMs=0;
+	PT_INIT(&LCD_arrInitPt[copy_u8_LCD_ID]);
+	while (LCD_InitAsync(copy_u8_LCD_ID,local_u16NowMs)!=PT_ENDED) /*< same sequence, the waits are done here */
+	{
+		_delay_ms(1);
+		local_u16NowMs++;
+	}
+}
+
+/**
+ * @brief Initializes the LCD without blocking (protothread version of LCD_init()).
+ * 
+ * @param copy_u8_LCD_ID The ID of the LCD.
+ * @param copy_u16_NowMs The current time in milliseconds (wraps around), e.g. SCHED_GetTick().
+ * @return PT_WAITING or PT_ENDED.
+ */
+PT_Status_t LCD_InitAsync(u8 copy_u8_LCD_ID, u16 copy_u16_NowMs)
+{
+	PT_t *pt=&LCD_arrInitPt[copy_u8_LCD_ID];
+	u8 local_u8functionSet;
+	u8 local_u8EntryModeSet;
+	
+	PT_BEGIN(pt);
+	PT_DELAY(pt,LCD_arrInitTimestamp[copy_u8_LCD_ID],copy_u16_NowMs,LCD_poweron_time_ms);
 	if (LCD_arrOfLCD[copy_u8_LCD_ID].LCD_Mode==LCD_4BIT_MODE)
 	{	
 		LCD_WriteCMD(copy_u8_LCD_ID,0x02);
-		_delay_ms(LCD_CMD_Avg_time_ms);
+		PT_DELAY(pt,LCD_arrInitTimestamp[copy_u8_LCD_ID],copy_u16_NowMs,LCD_CMD_Avg_time_ms);
 	}
 	// function set
 	// 0b0 0 1 DL N F X X - DL:Data length() , N:No of lines , F:Font
 	// DL=0 4-bit mode , DL=1 8-bit mode , N=0 1-line mode , N=1 2-line mode , F=0 5x7 dots , F=1 5x10 dots
-	u8 local_u8functionSet =LCD_FunctionSetInstruction| LCD_arrOfLCD[copy_u8_LCD_ID].LCD_Mode | LCD_arrOfLCD[copy_u8_LCD_ID].LCD_LINE | LCD_arrOfLCD[copy_u8_LCD_ID].LCD_DOTS;
+	local_u8functionSet =LCD_FunctionSetInstruction| LCD_arrOfLCD[copy_u8_LCD_ID].LCD_Mode | LCD_arrOfLCD[copy_u8_LCD_ID].LCD_LINE | LCD_arrOfLCD[copy_u8_LCD_ID].LCD_DOTS;
 	LCD_WriteCMD(copy_u8_LCD_ID,local_u8functionSet); /**<Set the function set with the specified options.*/
-	_delay_ms(LCD_CMD_Avg_time_ms);
+	PT_DELAY(pt,LCD_arrInitTimestamp[copy_u8_LCD_ID],copy_u16_NowMs,LCD_CMD_Avg_time_ms);
 
 	// display off control
 	// 0b0 0 0 0 1 D C B - D:Display , C:Cursor , B:Blink
 	// D=0 display off , D=1 display on , C=0 cursor off , C=1 cursor on , B=0 blink off , B=1 blink on
 	LCD_u8displayOnOffControlBuffer[copy_u8_LCD_ID]=LCD_DisplayOnOffControlInstruction|LCD_u8displayOnOffControlBuffer[copy_u8_LCD_ID]|0b00001100;
 	LCD_WriteCMD(copy_u8_LCD_ID,LCD_u8displayOnOffControlBuffer[copy_u8_LCD_ID]); /**<Set the display on/off control with the specified options.*/
-	_delay_ms(LCD_CMD_Avg_time_ms);
+	PT_DELAY(pt,LCD_arrInitTimestamp[copy_u8_LCD_ID],copy_u16_NowMs,LCD_CMD_Avg_time_ms);
 
 	// clear display
 	// 0 0 0 0 0 0 0 1
 	LCD_WriteCMD(copy_u8_LCD_ID,0b00000001); /**<Clear the display.*/
-	_delay_ms(LCD_Clear_Display_time_ms);
+	PT_DELAY(pt,LCD_arrInitTimestamp[copy_u8_LCD_ID],copy_u16_NowMs,LCD_Clear_Display_time_ms);
 
 	// entry mode set
 	// 0 0 0 0 0 0 0 1
 	// 0b0 0 0 0 0 0 0 0 1 - I/D=1 , S=0
 	// I/D=1 increment , I/D=0 decrement , S=1 display shift , S=0 cursor move 
-	u8 local_u8EntryModeSet = LCD_EntryModeSetInstruction | LCD_IncrementedCursorShiftingOff;
+	local_u8EntryModeSet = LCD_EntryModeSetInstruction | LCD_IncrementedCursorShiftingOff;
 	LCD_WriteCMD(copy_u8_LCD_ID,local_u8EntryModeSet); /**<Set the entry mode with the specified options.*/
-	_delay_ms(LCD_CMD_Avg_time_ms);
+	PT_DELAY(pt,LCD_arrInitTimestamp[copy_u8_LCD_ID],copy_u16_NowMs,LCD_CMD_Avg_time_ms);
+	PT_END(pt);
 }
 
 /**
@@ -298,8 +338,8 @@ void LCD_WriteStr(u8 copy_u8_LCD_ID, u8 str[])
 void LCD_WriteNum(u8 copy_u8_LCD_ID, s64 num)
 {
 	u8 str[50]={0};
-	u8 temp,Sign_Flag=0;
-	u16 i,len;
+	u8 Sign_Flag=0;
+	u16 i;
 	if (num==0)
 	{
 		LCD_WriteCh(copy_u8_LCD_ID,'0') ;
@@ -324,10 +364,9 @@ void LCD_WriteNum(u8 copy_u8_LCD_ID, s64 num)
 			i++;
 		}
 		str[i]='\0';
-		len=i;
 		/*Swap*/
 		/*
-		Str_ReverseWithLen(str,len);
+		Str_ReverseWithLen(str,i);
 		LCD_WriteStr(copy_u8_LCD_ID,str);*/
 		for (u8 j=i; j>0 ; j--)
 		{
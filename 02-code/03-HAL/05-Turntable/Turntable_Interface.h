@@ -0,0 +1,75 @@
+/**
+ * @file Turntable_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the turntable rotation monitor.
+ *         The encoder pulses on ICP1 (PD6) are timestamped by the TIMER1 input capture unit,
+ *         the capture ISR computes the period and filters it (fixed point, no polling and no division).
+ *         The RPM (one 32-bit division) and the stall check are computed on request from a task.
+ *
+ *         Cost: capture ISR about 150 cycles (19us at 8MHz) per pulse, an estimate from the instruction count, not
+ *         measured yet (the execution time of TIMER1_CAPT_VECT is reported by 05-tools/01-bench/isr.py).
+ *
+ * @par Example:
+ *   @code
+ *    TURNTABLE_Init();                       // after TIMER1_Init()
+ *    TURNTABLE_Start(SCHED_GetTick());       // motor switched ON
+ *    ...
+ *    if (TURNTABLE_IsStalled(SCHED_GetTick())==STD_TRUE)
+ *    {
+ *        // switch OFF the motor
+ *    }
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef TURNTABLE_INTERFACE_H_
+#define TURNTABLE_INTERFACE_H_
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes the input capture unit (rising edge, noise canceler) and binds the capture ISR.
+ *        The capture interrupt stays disabled until TURNTABLE_Start().
+ *
+ * @note TIMER1 (mode, prescaler, TOP) is initialized by the application (TURNTABLE_TIMER1_COUNTS).
+ */
+void TURNTABLE_Init(void);
+
+/**
+ * @brief Starts the monitoring (motor switched ON): the measurements are reset and the capture interrupt is enabled.
+ *
+ * @param nowMs The current time in milliseconds (the stall timeout starts now).
+ */
+void TURNTABLE_Start(u16 nowMs);
+
+/**
+ * @brief Stops the monitoring (motor switched OFF): the capture interrupt is disabled.
+ */
+void TURNTABLE_Stop(void);
+
+/**
+ * @brief Returns the filtered speed in tenths of RPM.
+ *
+ * @return The speed (e.g. 55 = 5.5 RPM) , 0 before two pulses were captured.
+ */
+u16 TURNTABLE_GetRpmX10(void);
+
+/**
+ * @brief Checks if the turntable is stalled: no pulse for TURNTABLE_STALL_TIMEOUT_MS
+ *        or the speed is below TURNTABLE_MIN_RPM_X10.
+ *
+ * @param nowMs The current time in milliseconds.
+ *
+ * @note Call it periodically, the timeout plus the call period must stay below 1000ms (Turntable_Lcfg.h).
+ * @return STD_TRUE if stalled , STD_FALSE if rotating or not started.
+ */
+Std_Bool_t TURNTABLE_IsStalled(u16 nowMs);
+
+#endif /* TURNTABLE_INTERFACE_H_ */
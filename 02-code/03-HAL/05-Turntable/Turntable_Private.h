@@ -0,0 +1,49 @@
+/**
+ * @file Turntable_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private macros, static global variables and functions of the turntable rotation monitor.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef TURNTABLE_PRIVATE_H_
+#define TURNTABLE_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define TURNTABLE_PERIOD_Q            4   /**< the filtered period is in TIMER1 counts Q28.4 */
+
+/**
+ * @brief rpm*10 = 600 * counts per second / (period * pulses per revolution), with the period in Q28.4.
+ */
+#define TURNTABLE_RPM_X10_NUMERATOR   ((600UL*TURNTABLE_TIMER1_COUNTS<<TURNTABLE_PERIOD_Q)/TURNTABLE_PULSES_PER_REV)
+
+#if (TURNTABLE_STALL_TIMEOUT_MS>=1000)
+#error "TURNTABLE_STALL_TIMEOUT_MS must be < 1000 (the period is measured modulo one TIMER1 cycle)"
+#endif
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Static Global Vaiables                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static volatile u16 TURNTABLE_u16LastCapture;
+static volatile Std_Bool_t TURNTABLE_isLastCaptureValid=STD_FALSE;
+static volatile u32 TURNTABLE_u32PeriodQ4=0;  /**< filtered period, 0: not measured yet */
+static volatile u8 TURNTABLE_u8PulseCount=0;  /**< incremented by the capture ISR (wraps around) */
+
+static Std_Bool_t TURNTABLE_isRunning=STD_FALSE;
+static u8 TURNTABLE_u8LastPulseCount;         /**< pulse count seen by TURNTABLE_IsStalled() */
+static u16 TURNTABLE_u16LastPulseMs;          /**< time at which TURNTABLE_IsStalled() saw the last pulse */
+
+#endif /* TURNTABLE_PRIVATE_H_ */
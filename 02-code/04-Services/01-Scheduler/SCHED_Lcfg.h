@@ -0,0 +1,36 @@
+/**
+ * @file SCHED_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the cooperative scheduler.
+ *         - the maximum number of tasks
+ *         - the tick (the uptime service tick, UPTIME_Lcfg.h)
+ *         - the CPU load window
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef SCHED_LCFG_H_
+#define SCHED_LCFG_H_
+
+/**
+ * @brief The maximum number of tasks that can be created.
+ *
+ * @note Each task costs sizeof(SCHED_Task_t) bytes of RAM.
+ */
+#define SCHED_MAX_TASKS           4
+
+/**
+ * @brief The tick period in milliseconds (all task periods and phases are in ticks).
+ *        The scheduler runs on the tick of the uptime service (TIMER0), execution times are measured in TIMER0 counts.
+ */
+#define SCHED_TICK_MS             UPTIME_TICK_MS
+
+/**
+ * @brief The window of the CPU load measurement in milliseconds (SCHED_GetCpuLoad()).
+ *        The load is the part of the window spent out of the idle state (running tasks, ISRs and the dispatcher).
+ */
+#define SCHED_LOAD_WINDOW_MS      1000UL
+
+#endif /* SCHED_LCFG_H_ */
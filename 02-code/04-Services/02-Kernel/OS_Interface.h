@@ -0,0 +1,162 @@
+/**
+ * @file OS_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the preemptive kernel.
+ *         A tiny fixed-priority kernel: every task has its own static stack and a unique priority
+ *         (0 is the highest). At every TIMER0 compare match tick (and when a task blocks in OS_Delay()/OS_DelayUntil())
+ *         the context is switched to the highest priority ready task. After OS_Start() the caller (main) continues
+ *         as the idle task, it runs only when no task is ready and must never block.
+ *         The tasks that share data lock the scheduler with a priority ceiling (OS_Lock()/OS_Unlock()).
+ *
+ *         Cost (ATmega32 @ 8MHz, counted from the instruction set timings):
+ *          - context save 79 cycles + context restore 77 cycles.
+ *          - tick interrupt (entry + save + set I + tick/wake/select + restore + reti) about 207 + 15*OS_MAX_TASKS cycles,
+ *            with 4 tasks about 267 cycles = 33us, 3.3% of the CPU at a 1ms tick.
+ *          - to be measured: the OS_TICK_ISR case of the benchmark (bench.py --preemptive, simavr), no baseline
+ *            is recorded yet (bench_thresholds.json).
+ *          - RAM per task: 7 bytes (OS_TCB_t) + stack (at least OS_STACK_MIN_SIZE bytes + the needs of the task).
+ *
+ * @par Example:
+ *   @code
+ *    OS_STACK_DEFINE(safetyStack,96);
+ *    OS_PERIODIC_TASK(os_task_safety,task_safety,5);  // runs task_safety() every 5 ticks
+ *
+ *    OS_Init();
+ *    OS_CreateTask(0,os_task_safety,safetyStack,sizeof(safetyStack));
+ *    Global_Interrupt_Enable__asm();
+ *    OS_Start();
+ *    while(1)
+ *    {
+ *        // idle
+ *    }
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef OS_INTERFACE_H_
+#define OS_INTERFACE_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The size of a saved context: PC(2) + r0 + SREG + r1..r31.
+ */
+#define OS_CONTEXT_SIZE           35
+
+/**
+ * @brief The minimum stack size of a task: a saved context, the canary and the kernel calls done on the task stack.
+ */
+#define OS_STACK_MIN_SIZE         (OS_CONTEXT_SIZE+OS_STACK_CANARY_SIZE+16)
+
+/**
+ * @brief Defines a static task stack.
+ */
+#define OS_STACK_DEFINE(name,size)    static u8 name[size]
+
+/**
+ * @brief Defines a task function that runs (function) every (period) ticks without drifting.
+ */
+#define OS_PERIODIC_TASK(name,function,period) \
+	void name(void)                            \
+	{                                          \
+		u16 lastWake=OS_GetTick();             \
+		while (1)                              \
+		{                                      \
+			function();                        \
+			OS_DelayUntil(&lastWake,(period)); \
+		}                                      \
+	}
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The priority of a task, 0 is the highest.
+ */
+typedef u8 OS_Priority_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes the kernel and TIMER0 as the tick source (the tick interrupt stays disabled).
+ */
+void OS_Init(void);
+
+/**
+ * @brief Creates a task.
+ *
+ * @param priority The priority of the task in [0,OS_MAX_TASKS-1] (0 is the highest), it must be unique.
+ * @param task Pointer to the task function, it must never return.
+ * @param stack The stack of the task (OS_STACK_DEFINE()).
+ * @param stackSize The size of the stack in bytes (>= OS_STACK_MIN_SIZE).
+ * @return STD_OK , STD_NULL_POINTER or STD_INVALID_ARG (priority out of range or used, stack too small).
+ */
+Std_Error_t OS_CreateTask(OS_Priority_t priority, Ptr_VoidFuncVoid_t task, u8 stack[], u16 stackSize);
+
+/**
+ * @brief Starts the tick (enables the TIMER0 compare match interrupt), the caller continues as the idle task.
+ *
+ * @note The global interrupt must be enabled.
+ */
+void OS_Start(void);
+
+/**
+ * @brief Blocks the calling task for (ticks) ticks.
+ *
+ * @note Must not be called from the idle task or an ISR (it returns immediately from the idle task).
+ */
+void OS_Delay(u16 ticks);
+
+/**
+ * @brief Blocks the calling task until (*lastWake + period), then updates *lastWake (periodic tasks without drift).
+ *
+ * If the wake time already passed (overrun) it returns immediately.
+ *
+ * @param lastWake Pointer to the last wake time (initialized with OS_GetTick()).
+ * @param period The period in ticks (1..32767).
+ */
+void OS_DelayUntil(u16 *lastWake, u16 period);
+
+/**
+ * @brief Returns the number of ticks since OS_Start() (wraps around).
+ */
+u16 OS_GetTick(void);
+
+/**
+ * @brief Sets the function called when the canary of a task is overwritten (or its stack pointer is below it).
+ *
+ * The task is suspended and never runs again, the callback is called from the tick ISR with the priority of the task.
+ * It should put the system in a safe state (e.g. heater OFF).
+ *
+ * @param LocalPtr Pointer to the callback function.
+ */
+void OS_StackOverflow_SetCallBack(Ptr_VoidFuncU8_t LocalPtr);
+
+/**
+ * @brief Locks the scheduler: the tasks of priority (ceiling) and lower don't preempt the calling task until OS_Unlock(),
+ *        the tasks of a higher priority and the interrupts still do (no interrupt latency is added).
+ *
+ * @note For the tasks of priority (ceiling) and lower that share data, the lock is not nested and the calling task
+ *       must not block (OS_Delay()/OS_DelayUntil()) before OS_Unlock().
+ * @param ceiling The highest priority of the tasks that share the data.
+ */
+void OS_Lock(OS_Priority_t ceiling);
+
+/**
+ * @brief Unlocks the scheduler, switches to a higher priority task released during the lock.
+ */
+void OS_Unlock(void);
+
+#endif /* OS_INTERFACE_H_ */
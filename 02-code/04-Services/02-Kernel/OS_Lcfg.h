@@ -0,0 +1,65 @@
+/**
+ * @file OS_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the preemptive kernel.
+ *         - enable/disable the kernel (the cooperative scheduler is used when it is disabled)
+ *         - the maximum number of tasks
+ *         - the TIMER0 tick (CTC mode, compare match interrupt)
+ *         - the stack canary
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef OS_LCFG_H_
+#define OS_LCFG_H_
+
+#define OS_OFF                    0
+#define OS_ON                     1
+
+/**
+ * @brief Enables the preemptive kernel.
+ *
+ * - OS_OFF : the kernel is not compiled, main.c runs its tasks on the cooperative scheduler (SCHED).
+ * - OS_ON  : main.c runs its tasks on the kernel, the kernel owns TIMER0_COMP_VECT
+ *            (TIMER0_COMP_ISR_OWNER must be TIMER_ISR_APP in TIMERS_Lcfg.h).
+ * It can be set from the command line (-DOS_PREEMPTIVE=OS_ON, bench.py --preemptive).
+ */
+#ifndef OS_PREEMPTIVE
+#define OS_PREEMPTIVE             OS_OFF
+#endif
+
+/**
+ * @brief The maximum number of tasks (the idle task is not counted), the priority of a task is in [0,OS_MAX_TASKS-1].
+ *
+ * @note Each task costs sizeof(OS_TCB_t) (7 bytes) of RAM plus its stack.
+ */
+#define OS_MAX_TASKS              4
+
+/**
+ * @brief The tick period in milliseconds (OS_Delay() and OS_DelayUntil() are in ticks).
+ *        The kernel tick also drives the uptime service, it must be equal to UPTIME_TICK_MS.
+ */
+#define OS_TICK_MS                1
+
+/**
+ * @brief TIMER0 settings that generate OS_TICK_MS in CTC mode, computed from F_CPU at compile time (TIMERS_Calc.h).
+ *
+ * tick = (OS_TIMER0_COMPARE+1) * prescaler / F_CPU
+ *      = (124+1) * 64 / 8MHz = 1ms
+ *
+ * The build fails (OS_Prog.c) when F_CPU can't generate OS_TICK_MS exactly.
+ */
+#define OS_TIMER0_DIV             TIMER_CALC_DIV(F_CPU,OS_TICK_MS*1000UL,8)
+#define OS_TIMER0_PRESCALER       TIMER_CALC_PRE_CLK(OS_TIMER0_DIV)
+#define OS_TIMER0_COMPARE         ((u8)TIMER_CALC_TOP(F_CPU,OS_TICK_MS*1000UL,8))
+
+/**
+ * @brief The stack canary: OS_STACK_CANARY_SIZE bytes at the bottom (lowest addresses) of every task stack,
+ *        they are checked at every context switch of the task.
+ */
+#define OS_STACK_CANARY           0xA5
+#define OS_STACK_CANARY_SIZE      2
+
+#endif /* OS_LCFG_H_ */
@@ -0,0 +1,345 @@
+/**
+ * @file OS_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the preemptive kernel.
+ *         The TIMER0 compare match ISR is naked: it saves the context of the running task, runs the tick handler
+ *         on the task stack, then restores the context of the selected task.
+ *         Nothing is compiled when OS_PREEMPTIVE is OS_OFF.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see OS_Interface.h
+ * @see OS_Lcfg.h
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_interrupt.h"
+
+// MCAL
+#include "MCU_config.h"
+#include "TIMERS_Interfacing.h"
+#include "TIMERS_Lcfg.h"
+#include "TIMERS_Calc.h"
+
+// Services
+#include "UPTIME_Interface.h"
+
+// own module files
+#include "OS_Lcfg.h"
+
+#if (OS_PREEMPTIVE==OS_ON)
+
+#if (TIMER0_COMP_ISR_OWNER!=TIMER_ISR_APP)
+#error "The preemptive kernel needs TIMER0_COMP_ISR_OWNER=TIMER_ISR_APP in TIMERS_Lcfg.h"
+#endif
+
+#if defined(HOST_BUILD)
+#error "The preemptive kernel switches the AVR context, it can't run in the host build (OS_Lcfg.h)"
+#endif
+
+#if (OS_TIMER0_DIV==0)
+#error "OS_TICK_MS can't be generated exactly by TIMER0 from F_CPU (OS_Lcfg.h)"
+#endif
+
+#include "OS_Interface.h"
+#include "OS_Private.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Builds the initial context of a task on its stack (as if it was interrupted at its first instruction).
+ *
+ * @return The initial stack pointer.
+ */
+static u8 *OS_InitStack(u8 stack[], u16 stackSize, Ptr_VoidFuncVoid_t task)
+{
+	u8 *sp=&stack[stackSize-1];
+	u16 address=(u16)task;
+	u8 i;
+
+	*sp--=(u8)address;        /*< PC low byte (pushed first by the interrupt) */
+	*sp--=(u8)(address>>8);   /*< PC high byte */
+	*sp--=0x00;               /*< r0 */
+	*sp--=OS_SREG_INIT;       /*< SREG */
+	*sp--=0x00;               /*< r1 (zero register) */
+	for (i=2; i<=31; i++)
+	{
+		*sp--=0x00;           /*< r2..r31 */
+	}
+	return sp;                /*< SP points to the next free byte */
+}
+
+/**
+ * @brief Checks the stack of the current task then selects the highest priority ready task as OS_pCurrentTCB,
+ *        the task that holds the lock is selected while no task above the ceiling is ready.
+ */
+static void OS_Schedule(void)
+{
+	u8 i;
+	OS_TCB_t *current=OS_pCurrentTCB;
+
+	if (current->stackBottom!=NULL_PTR)
+	{
+		for (i=0; i<OS_STACK_CANARY_SIZE; i++)
+		{
+			if (current->stackBottom[i]!=OS_STACK_CANARY)
+			{
+				break;
+			}
+		}
+		if ((i<OS_STACK_CANARY_SIZE) || (current->sp<(current->stackBottom+OS_STACK_CANARY_SIZE)))
+		{
+			current->state=OS_TASK_SUSPENDED;
+			if (OS_StackOverflow_Fptr!=NULL_PTR)
+			{
+				OS_StackOverflow_Fptr((u8)(current-OS_arrTCB));
+			}
+		}
+	}
+
+	for (i=0; OS_arrTCB[i].state!=OS_TASK_READY; i++)
+	{
+		//the idle task is always ready
+	}
+	if ((OS_pLockTCB!=NULL_PTR) && (i>=OS_u8LockCeiling) && (OS_pLockTCB->state==OS_TASK_READY))
+	{
+		OS_pCurrentTCB=OS_pLockTCB; /*< resumed after the tasks above the ceiling */
+	}
+	else
+	{
+		OS_pCurrentTCB=&OS_arrTCB[i];
+	}
+}
+
+/**
+ * @brief The tick handler, called from the naked TIMER0 compare match ISR between save and restore context.
+ */
+static void OS_TickHandler(void)
+{
+	u8 i;
+	OS_u16Tick++;
+	UPTIME_Tick();
+	for (i=0; i<OS_MAX_TASKS; i++)
+	{
+		if ((OS_arrTCB[i].state==OS_TASK_BLOCKED) && ((s16)(OS_u16Tick-OS_arrTCB[i].wakeTick)>=0))
+		{
+			OS_arrTCB[i].state=OS_TASK_READY;
+		}
+	}
+	OS_Schedule();
+}
+
+/**
+ * @brief Switches the context from a task (called by OS_Delay()/OS_DelayUntil()/OS_Unlock()).
+ *
+ * The return address pushed by the call takes the place of the PC pushed by an interrupt,
+ * the restored SREG decides the global interrupt state: I=0 for a task that yielded (OS_Delay() restores its own SREG
+ * after the return), I=1 for a task preempted by the tick (OS_SAVED_SREG_SET_I()).
+ */
+static void OS_Yield(void)
+{
+	OS_SAVE_CONTEXT();
+	OS_Schedule();
+	OS_RESTORE_CONTEXT();
+	ret();
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Initializes the kernel and TIMER0 as the tick source (the tick interrupt stays disabled).
+ */
+void OS_Init(void)
+{
+	u8 i;
+	for (i=0; i<=OS_MAX_TASKS; i++)
+	{
+		OS_arrTCB[i].state=OS_TASK_UNUSED;
+		OS_arrTCB[i].stackBottom=NULL_PTR;
+	}
+	OS_u16Tick=0;
+
+	TIMER0_COMP_INT(STD_DISABLED);
+	TIMER0_SetCompareValue(OS_TIMER0_COMPARE);
+	TIMER0_Init(TIMER0_CTC_OCRN_TOP,TIMER_OCx_MODE_DICONNECTED,OS_TIMER0_PRESCALER);
+}
+
+/**
+ * @brief Creates a task.
+ *
+ * @param priority The priority of the task in [0,OS_MAX_TASKS-1] (0 is the highest), it must be unique.
+ * @param task Pointer to the task function, it must never return.
+ * @param stack The stack of the task (OS_STACK_DEFINE()).
+ * @param stackSize The size of the stack in bytes (>= OS_STACK_MIN_SIZE).
+ * @return STD_OK , STD_NULL_POINTER or STD_INVALID_ARG (priority out of range or used, stack too small).
+ */
+Std_Error_t OS_CreateTask(OS_Priority_t priority, Ptr_VoidFuncVoid_t task, u8 stack[], u16 stackSize)
+{
+	Std_Error_t error=STD_OK;
+	u8 i;
+
+	if ((task==NULL_PTR) || (stack==NULL_PTR))
+	{
+		error=STD_NULL_POINTER;
+	}
+	else if ((priority>=OS_MAX_TASKS) || (OS_arrTCB[priority].state!=OS_TASK_UNUSED) || (stackSize<OS_STACK_MIN_SIZE))
+	{
+		error=STD_INVALID_ARG;
+	}
+	else
+	{
+		for (i=0; i<OS_STACK_CANARY_SIZE; i++)
+		{
+			stack[i]=OS_STACK_CANARY;
+		}
+		OS_arrTCB[priority].sp=OS_InitStack(stack,stackSize,task);
+		OS_arrTCB[priority].stackBottom=stack;
+		OS_arrTCB[priority].state=OS_TASK_READY;
+	}
+	return error;
+}
+
+/**
+ * @brief Starts the tick (enables the TIMER0 compare match interrupt), the caller continues as the idle task.
+ *
+ * @note The global interrupt must be enabled.
+ */
+void OS_Start(void)
+{
+	OS_arrTCB[OS_IDLE_TASK].state=OS_TASK_READY; /*< its context is saved at the first tick */
+	OS_pCurrentTCB=&OS_arrTCB[OS_IDLE_TASK];
+	TIMER0_SetCounterValue(0);
+	TIMER0_COMP_INT(STD_ENABLED);
+}
+
+/**
+ * @brief Blocks the calling task for (ticks) ticks.
+ *
+ * @note Must not be called from the idle task or an ISR (it returns immediately from the idle task).
+ */
+void OS_Delay(u16 ticks)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm();
+	if ((OS_pCurrentTCB!=&OS_arrTCB[OS_IDLE_TASK]) && (ticks>0))
+	{
+		OS_pCurrentTCB->wakeTick=OS_u16Tick+ticks;
+		OS_pCurrentTCB->state=OS_TASK_BLOCKED;
+		OS_Yield();
+	}
+	SREG=sreg;
+}
+
+/**
+ * @brief Blocks the calling task until (*lastWake + period), then updates *lastWake (periodic tasks without drift).
+ *
+ * If the wake time already passed (overrun) it returns immediately.
+ *
+ * @param lastWake Pointer to the last wake time (initialized with OS_GetTick()).
+ * @param period The period in ticks (1..32767).
+ */
+void OS_DelayUntil(u16 *lastWake, u16 period)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm();
+	*lastWake+=period;
+	if ((OS_pCurrentTCB!=&OS_arrTCB[OS_IDLE_TASK]) && ((s16)(*lastWake-OS_u16Tick)>0))
+	{
+		OS_pCurrentTCB->wakeTick=*lastWake;
+		OS_pCurrentTCB->state=OS_TASK_BLOCKED;
+		OS_Yield();
+	}
+	SREG=sreg;
+}
+
+/**
+ * @brief Returns the number of ticks since OS_Start() (wraps around).
+ */
+u16 OS_GetTick(void)
+{
+	u16 tick;
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm(); /*< u16 read is not atomic on AVR */
+	tick=OS_u16Tick;
+	SREG=sreg;
+
+	return tick;
+}
+
+/**
+ * @brief Sets the function called when the canary of a task is overwritten (or its stack pointer is below it).
+ *
+ * @param LocalPtr Pointer to the callback function.
+ */
+void OS_StackOverflow_SetCallBack(Ptr_VoidFuncU8_t LocalPtr)
+{
+	OS_StackOverflow_Fptr=LocalPtr;
+}
+
+/**
+ * @brief Locks the scheduler: the tasks of priority (ceiling) and lower don't preempt the calling task until OS_Unlock().
+ *
+ * @param ceiling The highest priority of the tasks that share the data.
+ */
+void OS_Lock(OS_Priority_t ceiling)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm();
+	OS_u8LockCeiling=ceiling;
+	OS_pLockTCB=OS_pCurrentTCB;
+	SREG=sreg;
+}
+
+/**
+ * @brief Unlocks the scheduler, switches to a higher priority task released during the lock.
+ */
+void OS_Unlock(void)
+{
+	u8 sreg=SREG;
+	u8 i;
+
+	Global_Interrupt_Disable__asm();
+	OS_pLockTCB=NULL_PTR;
+	for (i=0; OS_arrTCB[i].state!=OS_TASK_READY; i++)
+	{
+		//the idle task is always ready
+	}
+	if (&OS_arrTCB[i]<OS_pCurrentTCB)
+	{
+		OS_Yield(); /*< the current task stays ready, it is resumed here */
+	}
+	SREG=sreg;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                         Interrupt Service Routines                          */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+ISR(TIMER0_COMP_VECT,ISR_NAKED)
+{
+	OS_SAVE_CONTEXT();
+	OS_SAVED_SREG_SET_I(); /*< the task is resumed with the interrupts enabled, by reti or by OS_Yield() */
+	OS_TickHandler();
+	OS_RESTORE_CONTEXT();
+	reti();
+}
+
+#endif /* OS_PREEMPTIVE==OS_ON */
@@ -0,0 +1,103 @@
+/**
+ * @file UPTIME_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the uptime service.
+ *         A monotonic u32 millisecond counter driven by the TIMER0 compare match tick
+ *         (the uptime service owns the tick, or the preemptive kernel drives it with UPTIME_Tick()).
+ *         It is the time base of the scheduler, the timeouts and the latency measurements.
+ *
+ *         - UPTIME_GetMs()     : milliseconds, wraps after 49.7 days.
+ *         - UPTIME_GetUs()     : microseconds with the resolution of one TIMER0 count, wraps after 71.5 minutes.
+ *         - UPTIME_GetCounts() : TIMER0 counts (ms * UPTIME_TICK_COUNTS + TCNT0), for short measurements.
+ *
+ *         The reads are atomic against the tick ISR: the interrupts are disabled for the copy and a compare match
+ *         that is pending (counter already cleared, ISR not run yet) is counted.
+ *         The times wrap around: compare them with UPTIME_ELAPSED() / UPTIME_IS_AFTER(), never with < or >.
+ *
+ * @par Example:
+ *   @code
+ *    u32 start=UPTIME_GetMs();
+ *    ...
+ *    if (UPTIME_ELAPSED(UPTIME_GetMs(),start)>=500)   // correct across the wrap around
+ *    {
+ *        // timeout
+ *    }
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UPTIME_INTERFACE_H_
+#define UPTIME_INTERFACE_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The time passed from (since) to (now), correct across one wrap around.
+ */
+#define UPTIME_ELAPSED(now,since)       ( (u32)((u32)(now)-(u32)(since)) )
+
+/**
+ * @brief True when the time (a) is after the time (b), correct while they are less than 2^31 apart.
+ */
+#define UPTIME_IS_AFTER(a,b)            ( (s32)((u32)(a)-(u32)(b))>0 )
+
+/**
+ * @brief True when the time (a) is after or equal to the time (b) (e.g. a deadline is reached).
+ */
+#define UPTIME_IS_AFTER_EQ(a,b)         ( (s32)((u32)(a)-(u32)(b))>=0 )
+
+/**
+ * @brief Converts TIMER0 counts to microseconds.
+ */
+#define UPTIME_COUNTS_TO_US(counts)     ( (u32)(counts)*UPTIME_US_PER_COUNT )
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Clears the counter and starts the tick: TIMER0 in CTC mode with the compare match interrupt enabled.
+ *        When the preemptive kernel is enabled only the counter is cleared (the kernel starts TIMER0).
+ *
+ * @note The global interrupt must be enabled for the counter to run.
+ */
+void UPTIME_Init(void);
+
+/**
+ * @brief Advances the counter by one tick, called by the tick ISR of the preemptive kernel.
+ */
+void UPTIME_Tick(void);
+
+/**
+ * @brief Returns the milliseconds since UPTIME_Init() (wraps after 49.7 days).
+ */
+u32 UPTIME_GetMs(void);
+
+/**
+ * @brief Returns the microseconds since UPTIME_Init(), with the resolution of one TIMER0 count (wraps after 71.5 minutes).
+ */
+u32 UPTIME_GetUs(void);
+
+/**
+ * @brief Returns the TIMER0 counts since UPTIME_Init() (ms * UPTIME_TICK_COUNTS / UPTIME_TICK_MS + TCNT0), it wraps around.
+ */
+u32 UPTIME_GetCounts(void);
+
+/**
+ * @brief Checks if (duration) milliseconds passed since (since), correct across the wrap around.
+ *
+ * @param since A time returned by UPTIME_GetMs().
+ * @param duration The duration in milliseconds (< 2^31).
+ * @return STD_TRUE if the duration passed , STD_FALSE otherwise.
+ */
+Std_Bool_t UPTIME_HasElapsed(u32 since, u32 duration);
+
+#endif /* UPTIME_INTERFACE_H_ */
@@ -0,0 +1,45 @@
+/**
+ * @file UPTIME_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private static global variables and functions of the uptime service.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UPTIME_PRIVATE_H_
+#define UPTIME_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Static Global Vaiables                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static volatile u32 UPTIME_u32Ms=0; /**< incremented by the tick ISR */
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+#if (OS_PREEMPTIVE==OS_OFF) && (TIMER0_COMP_ISR_OWNER==TIMER_ISR_DRIVER)
+/**
+ * @brief The tick handler, called from the TIMER0 compare match ISR of the driver.
+ */
+static void UPTIME_TickHandler(void);
+#endif
+
+/**
+ * @brief Copies the counter and TCNT0 with the interrupts disabled,
+ *        a pending compare match (TCNT0 cleared, ISR not run yet) is added to the copy.
+ */
+static void UPTIME_Snapshot(u32 *ms, u8 *counts);
+
+#endif /* UPTIME_PRIVATE_H_ */
@@ -0,0 +1,193 @@
+/**
+ * @file UPTIME_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the uptime service.
+ *         The TIMER0 ISR only adds UPTIME_TICK_MS to the counter, the microseconds and counts
+ *         are computed by the readers from the counter and TCNT0.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see UPTIME_Interface.h
+ * @see UPTIME_Lcfg.h
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_interrupt.h"
+
+// MCAL
+#include "MCU_config.h"
+#include "TIMERS_Interfacing.h"
+#include "TIMERS_Lcfg.h"
+#include "TIMERS_Calc.h"
+#include "OS_Lcfg.h"
+
+// Services
+#include "TRACE_Lcfg.h"
+#include "TRACE_Interface.h"
+
+// own module files
+#include "UPTIME_Interface.h"
+#include "UPTIME_Lcfg.h"
+#include "UPTIME_Private.h"
+
+#if (UPTIME_TIMER0_DIV==0)
+#error "UPTIME_TICK_MS can't be generated exactly by TIMER0 from F_CPU (UPTIME_Lcfg.h)"
+#endif
+
+#if (((UPTIME_TIMER0_DIV*1000000ULL)%F_CPU)!=0)
+#error "one TIMER0 count is not a whole number of microseconds with this F_CPU (UPTIME_Lcfg.h)"
+#endif
+
+#if (OS_PREEMPTIVE==OS_ON) && (OS_TICK_MS!=UPTIME_TICK_MS)
+#error "OS_TICK_MS must be equal to UPTIME_TICK_MS, the kernel drives the uptime tick"
+#endif
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+#if (OS_PREEMPTIVE==OS_OFF)
+/**
+ * @brief The tick handler: the TIMER0 compare match ISR itself (build-time binding, TIMERS_Lcfg.h)
+ *        or the callback of the driver ISR (runtime binding).
+ */
+#if (TIMER0_COMP_ISR_OWNER==TIMER_ISR_APP)
+ISR(TIMER0_COMP_VECT)
+#else
+static void UPTIME_TickHandler(void)
+#endif
+{
+	UPTIME_u32Ms+=UPTIME_TICK_MS;
+	TRACE_TICK(); /*< the delta of the next trace record */
+}
+#endif
+
+/**
+ * @brief Copies the counter and TCNT0 with the interrupts disabled,
+ *        a pending compare match (TCNT0 cleared, ISR not run yet) is added to the copy.
+ *        TCNT0 stays at the compare value for a prescaler period after the match: when the ISR already ran
+ *        the count is the first one of the new tick (0), or the time would go back by a tick at the next count.
+ */
+static void UPTIME_Snapshot(u32 *ms, u8 *counts)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm(); /*< u32 read is not atomic on AVR */
+	*ms=UPTIME_u32Ms;
+	*counts=TIMER0_GetCounterValue();
+	if (TIMER0_GetCompareFlag()==1)
+	{
+		if (*counts<(UPTIME_TICK_COUNTS/2))
+		{
+			*ms+=UPTIME_TICK_MS;
+		}
+	}
+	else if (*counts==UPTIME_TIMER0_COMPARE)
+	{
+		*counts=0;
+	}
+	else
+	{
+		//the counter and the tick agree
+	}
+	SREG=sreg;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Clears the counter and starts the tick: TIMER0 in CTC mode with the compare match interrupt enabled.
+ *        When the preemptive kernel is enabled only the counter is cleared (the kernel starts TIMER0).
+ */
+void UPTIME_Init(void)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm();
+	UPTIME_u32Ms=0;
+	SREG=sreg;
+
+#if (OS_PREEMPTIVE==OS_OFF)
+#if (TIMER0_COMP_ISR_OWNER==TIMER_ISR_DRIVER)
+	TIMER0_COMP_SetCallBack(UPTIME_TickHandler);
+#endif
+	TIMER0_COMP_INT(STD_DISABLED);
+	TIMER0_SetCompareValue(UPTIME_TIMER0_COMPARE);
+	TIMER0_SetCounterValue(0);
+	TIMER0_Init(TIMER0_CTC_OCRN_TOP,TIMER_OCx_MODE_DICONNECTED,UPTIME_TIMER0_PRESCALER);
+	TIMER0_COMP_INT(STD_ENABLED);
+#endif
+}
+
+/**
+ * @brief Advances the counter by one tick, called by the tick ISR of the preemptive kernel.
+ */
+void UPTIME_Tick(void)
+{
+	UPTIME_u32Ms+=UPTIME_TICK_MS;
+	TRACE_TICK(); /*< the delta of the next trace record */
+}
+
+/**
+ * @brief Returns the milliseconds since UPTIME_Init() (wraps after 49.7 days).
+ */
+u32 UPTIME_GetMs(void)
+{
+	u32 ms;
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm(); /*< u32 read is not atomic on AVR */
+	ms=UPTIME_u32Ms;
+	SREG=sreg;
+
+	return ms;
+}
+
+/**
+ * @brief Returns the microseconds since UPTIME_Init(), with the resolution of one TIMER0 count (wraps after 71.5 minutes).
+ */
+u32 UPTIME_GetUs(void)
+{
+	u32 ms;
+	u8 counts;
+
+	UPTIME_Snapshot(&ms,&counts);
+	return (ms*1000UL)+((u16)counts*UPTIME_US_PER_COUNT);
+}
+
+/**
+ * @brief Returns the TIMER0 counts since UPTIME_Init() (ms * UPTIME_TICK_COUNTS / UPTIME_TICK_MS + TCNT0), it wraps around.
+ */
+u32 UPTIME_GetCounts(void)
+{
+	u32 ms;
+	u8 counts;
+
+	UPTIME_Snapshot(&ms,&counts);
+	return ((ms/UPTIME_TICK_MS)*UPTIME_TICK_COUNTS)+counts;
+}
+
+/**
+ * @brief Checks if (duration) milliseconds passed since (since), correct across the wrap around.
+ */
+Std_Bool_t UPTIME_HasElapsed(u32 since, u32 duration)
+{
+	Std_Bool_t isElapsed=STD_FALSE;
+
+	if (UPTIME_ELAPSED(UPTIME_GetMs(),since)>=duration)
+	{
+		isElapsed=STD_TRUE;
+	}
+	return isElapsed;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file RTC_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the real-time clock service.
+ *         The TIMER2 overflow ISR (once per second) advances the seconds since midnight,
+ *         the hours and minutes are computed by the readers.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see RTC_Interface.h
+ * @see RTC_Lcfg.h
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_interrupt.h"
+
+// MCAL
+#include "TIMERS_Interfacing.h"
+#include "TIMERS_Lcfg.h"
+#include "TIMERS_Calc.h"
+
+// own module files
+#include "RTC_Interface.h"
+#include "RTC_Lcfg.h"
+#include "RTC_Private.h"
+
+#if (RTC_TIMER2_DIV==0)
+#error "RTC_TICK_US can't be generated exactly by TIMER2 from RTC_CRYSTAL_HZ (RTC_Lcfg.h)"
+#endif
+
+#if (RTC_TIMER2_RELOAD!=0)
+#error "RTC_TICK_US must be a whole TIMER2 overflow (256 counts) of RTC_CRYSTAL_HZ (RTC_Lcfg.h)"
+#endif
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief The second handler: the TIMER2 overflow ISR itself (build-time binding, TIMERS_Lcfg.h)
+ *        or the callback of the driver ISR (runtime binding).
+ */
+#if (TIMER2_OVF_ISR_OWNER==TIMER_ISR_APP)
+ISR(TIMER2_OVF_VECT)
+#else
+static void RTC_SecondHandler(void)
+#endif
+{
+	u32 second=RTC_u32SecondOfDay+1;
+
+	if (second>=RTC_SECONDS_PER_DAY)
+	{
+		second=0;
+	}
+	RTC_u32SecondOfDay=second;
+
+	if (RTC_Second_Fptr!=NULL_PTR)
+	{
+		RTC_Second_Fptr();
+	}
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Clears the time (00:00:00) and starts TIMER2 in asynchronous mode with the overflow interrupt enabled.
+ */
+void RTC_Init(void)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm();
+	RTC_u32SecondOfDay=0;
+	SREG=sreg;
+
+#if (TIMER2_OVF_ISR_OWNER==TIMER_ISR_DRIVER)
+	TIMER2_OVF_SetCallBack(RTC_SecondHandler);
+#endif
+	TIMER2_AsyncInit(TIMER2_NORMAL,0,RTC_TIMER2_PRESCALER);
+	TIMER2_OVF_INT(STD_ENABLED);
+}
+
+/**
+ * @brief Sets the time of day, the current second restarts.
+ */
+Std_Error_t RTC_SetTime(const RTC_Time_t *time)
+{
+	Std_Error_t error=STD_OK;
+	u8 sreg;
+
+	if (time==NULL_PTR)
+	{
+		error=STD_NULL_POINTER;
+	}
+	else if ((time->hour>=24) || (time->minute>=60) || (time->second>=60))
+	{
+		error=STD_INVALID_ARG;
+	}
+	else
+	{
+		sreg=SREG;
+		Global_Interrupt_Disable__asm();
+		RTC_u32SecondOfDay=((u32)time->hour*3600UL)+((u16)time->minute*60)+time->second;
+		TIMER2_SetCounterValue(0);
+		while (TIMER2_IsUpdateBusy())
+		{
+			//two crystal cycles at most (61us)
+		}
+		SREG=sreg;
+	}
+	return error;
+}
+
+/**
+ * @brief Gets the time of day.
+ */
+Std_Error_t RTC_GetTime(RTC_Time_t *time)
+{
+	Std_Error_t error=STD_OK;
+	u32 second;
+
+	if (time==NULL_PTR)
+	{
+		error=STD_NULL_POINTER;
+	}
+	else
+	{
+		second=RTC_GetSecondOfDay();
+		time->hour=(u8)(second/3600UL);
+		second%=3600UL;
+		time->minute=(u8)((u16)second/60);
+		time->second=(u8)((u16)second%60);
+	}
+	return error;
+}
+
+/**
+ * @brief Returns the seconds since midnight [0,RTC_SECONDS_PER_DAY-1].
+ */
+u32 RTC_GetSecondOfDay(void)
+{
+	u32 second;
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm(); /*< u32 read is not atomic on AVR */
+	second=RTC_u32SecondOfDay;
+	SREG=sreg;
+
+	return second;
+}
+
+/**
+ * @brief Sets the function called every second by the TIMER2 overflow ISR (after the time is updated).
+ */
+void RTC_SetSecondCallBack(Ptr_VoidFuncVoid_t LocalPtr)
+{
+	u8 sreg=SREG;
+
+	Global_Interrupt_Disable__asm(); /*< a function pointer write is not atomic on AVR */
+	RTC_Second_Fptr=LocalPtr;
+	SREG=sreg;
+}
+
+/**
+ * @brief Must be called right before entering Power-save (or Extended Standby) sleep mode.
+ */
+void RTC_PrepareSleep(void)
+{
+	TIMER2_SetCompareValue(TIMER2_GetCompareValue());
+	while (TIMER2_IsUpdateBusy())
+	{
+		//one crystal cycle at least, two at most (61us)
+	}
+}
@@ -0,0 +1,98 @@
+/**
+ * @file WDGM_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the watchdog manager (the loop deadline monitor).
+ *         Every supervised entity checks in each time it runs (WDGM_CheckIn()), WDGM_MainFunction() is called
+ *         from the super loop (or the idle task) and resets the watchdog only when every entity checked in
+ *         within its budget (WDGM_Lcfg.c):
+ *          - a hang in a busy wait or an ISR storm : WDGM_MainFunction() stops running, the watchdog resets the MCU.
+ *          - a starved or stopped entity           : its overrun counter is incremented and the watchdog is not reset
+ *                                                    until it checks in again.
+ *
+ *         The entity that missed its budget is kept in .noinit RAM (not cleared at startup),
+ *         after the reset WDGM_GetResetInfo() tells the reset cause and the failed entity.
+ *
+ * @par Example:
+ *   @code
+ *    void task_control(void)
+ *    {
+ *        WDGM_CheckIn(WDGM_CONTROL);
+ *        ...
+ *    }
+ *    while (1)
+ *    {
+ *        SCHED_Dispatch();
+ *        WDGM_MainFunction();
+ *    }
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef WDGM_INTERFACE_H_
+#define WDGM_INTERFACE_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define WDGM_NO_ENTITY            0xFF   /* no entity missed its budget (the loop hung, or not a watchdog reset) */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef struct
+{
+	u8 cause;           /**< the reset flags of the last reset (WDT_RESET_xxx) */
+	u8 failedEntity;    /**< the entity that missed its budget before a watchdog reset, WDGM_NO_ENTITY otherwise */
+	u8 watchdogResets;  /**< the number of watchdog resets since the last power-on (saturates at 255) */
+}WDGM_ResetInfo_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Records the reset cause, then starts the supervision and the watchdog (WDGM_WDT_TIMEOUT).
+ *        Every entity is considered checked in at this time.
+ *
+ * @note The uptime service must be initialized before, it should be called early at startup.
+ */
+void WDGM_Init(void);
+
+/**
+ * @brief The check-in of an entity, called every time it runs.
+ *
+ * @param entity The entity.
+ */
+void WDGM_CheckIn(WDGM_EntityId_t entity);
+
+/**
+ * @brief Checks the budgets of the entities and resets the watchdog when they are all met,
+ *        must be called from the super loop (or the idle task of the kernel).
+ */
+void WDGM_MainFunction(void);
+
+/**
+ * @brief Returns the number of times the entity missed its check-in budget (since startup).
+ *
+ * @param entity The entity.
+ */
+u16 WDGM_GetOverruns(WDGM_EntityId_t entity);
+
+/**
+ * @brief Gets the cause of the last reset (recorded by WDGM_Init()).
+ *
+ * @param info Pointer to store the reset information.
+ * @return STD_OK or STD_NULL_POINTER.
+ */
+Std_Error_t WDGM_GetResetInfo(WDGM_ResetInfo_t *info);
+
+#endif /* WDGM_INTERFACE_H_ */
@@ -0,0 +1,170 @@
+/**
+ * @file WDGM_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the watchdog manager (the loop deadline monitor).
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see WDGM_Interface.h
+ * @see WDGM_Lcfg.h
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_interrupt.h"
+
+// MCAL
+#include "WDT_Interface.h"
+
+// Services
+#include "UPTIME_Interface.h"
+
+// own module files
+#include "WDGM_Lcfg.h"
+#include "WDGM_Interface.h"
+#include "WDGM_Private.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Records the reset cause, then starts the supervision and the watchdog (WDGM_WDT_TIMEOUT).
+ */
+void WDGM_Init(void)
+{
+	u8 i;
+	u16 now=(u16)UPTIME_GetMs();
+
+	WDGM_resetInfo.cause=WDT_GetResetCause();
+	if ((WDGM_noInitRecord.magic!=WDGM_NOINIT_MAGIC) || (WDGM_resetInfo.cause&WDT_RESET_POWER_ON))
+	{
+		/* the RAM content is random after a power-on */
+		WDGM_noInitRecord.magic=WDGM_NOINIT_MAGIC;
+		WDGM_noInitRecord.failedEntity=WDGM_NO_ENTITY;
+		WDGM_noInitRecord.watchdogResets=0;
+	}
+
+	if (WDGM_resetInfo.cause&WDT_RESET_WATCHDOG)
+	{
+		if (WDGM_noInitRecord.watchdogResets<0xFF)
+		{
+			WDGM_noInitRecord.watchdogResets++;
+		}
+		WDGM_resetInfo.failedEntity=WDGM_noInitRecord.failedEntity;
+	}
+	else
+	{
+		WDGM_resetInfo.failedEntity=WDGM_NO_ENTITY;
+	}
+	WDGM_resetInfo.watchdogResets=WDGM_noInitRecord.watchdogResets;
+	WDGM_noInitRecord.failedEntity=WDGM_NO_ENTITY;
+
+	for (i=0; i<WDGM_ENTITIES_COUNT; i++)
+	{
+		WDGM_arrCheckInMs[i]=now;
+		WDGM_arrOverruns[i]=0;
+		WDGM_arrIsLate[i]=STD_FALSE;
+	}
+
+	WDT_Enable(WDGM_WDT_TIMEOUT);
+}
+
+/**
+ * @brief The check-in of an entity, called every time it runs.
+ */
+void WDGM_CheckIn(WDGM_EntityId_t entity)
+{
+	u16 now=(u16)UPTIME_GetMs();
+	u8 sreg;
+
+	if (entity<WDGM_ENTITIES_COUNT)
+	{
+		sreg=SREG;
+		Global_Interrupt_Disable__asm(); /*< u16 write is not atomic on AVR (the kernel idle task may read it) */
+		WDGM_arrCheckInMs[entity]=now;
+		SREG=sreg;
+	}
+}
+
+/**
+ * @brief Checks the budgets of the entities and resets the watchdog when they are all met.
+ */
+void WDGM_MainFunction(void)
+{
+	u8 i;
+	u16 checkIn;
+	u16 now=(u16)UPTIME_GetMs();
+	u8 sreg;
+	u8 failedEntity=WDGM_NO_ENTITY;
+
+	for (i=0; i<WDGM_ENTITIES_COUNT; i++)
+	{
+		sreg=SREG;
+		Global_Interrupt_Disable__asm(); /*< u16 read is not atomic on AVR */
+		checkIn=WDGM_arrCheckInMs[i];
+		SREG=sreg;
+
+		if ((u16)(now-checkIn)>WDGM_arrBudgetMs[i])
+		{
+			if (WDGM_arrIsLate[i]==STD_FALSE)
+			{
+				WDGM_arrIsLate[i]=STD_TRUE;
+				WDGM_arrOverruns[i]++;
+			}
+			failedEntity=i;
+		}
+		else
+		{
+			WDGM_arrIsLate[i]=STD_FALSE;
+		}
+	}
+
+	WDGM_noInitRecord.failedEntity=failedEntity; /*< kept if the watchdog resets now */
+	if (failedEntity==WDGM_NO_ENTITY)
+	{
+		WDT_Reset__asm();
+	}
+}
+
+/**
+ * @brief Returns the number of times the entity missed its check-in budget (since startup).
+ */
+u16 WDGM_GetOverruns(WDGM_EntityId_t entity)
+{
+	u16 overruns=0;
+	u8 sreg;
+
+	if (entity<WDGM_ENTITIES_COUNT)
+	{
+		sreg=SREG;
+		Global_Interrupt_Disable__asm(); /*< u16 read is not atomic on AVR (written by the kernel idle task) */
+		overruns=WDGM_arrOverruns[entity];
+		SREG=sreg;
+	}
+	return overruns;
+}
+
+/**
+ * @brief Gets the cause of the last reset (recorded by WDGM_Init()).
+ */
+Std_Error_t WDGM_GetResetInfo(WDGM_ResetInfo_t *info)
+{
+	Std_Error_t error=STD_OK;
+
+	if (info==NULL_PTR)
+	{
+		error=STD_NULL_POINTER;
+	}
+	else
+	{
+		*info=WDGM_resetInfo;
+	}
+	return error;
+}
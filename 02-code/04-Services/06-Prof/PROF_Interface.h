@@ -0,0 +1,167 @@
+/**
+ * @file PROF_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the profiler.
+ *         A section is measured between PROF_BEGIN(id) and PROF_END(id) in TIMER0 counts (UPTIME_GetCounts(),
+ *         8us at 8MHz/64), every probe keeps its number of runs, min, max, sum (mean) and a log2 histogram.
+ *
+ *         The probes can be used in the tasks and in the ISRs (one context per probe).
+ *         When PROF_ENABLE is PROF_OFF (PROF_Lcfg.h) the macros expand to nothing.
+ *
+ *         The loop monitor records the duration of every super-loop iteration (between two PROF_LOOP_MARK())
+ *         under a tag (the state at the end of the iteration), the worst case and the percentiles are read with
+ *         PROF_GetLoopStats() and PROF_GetPercentile().
+ *
+ * @par Example:
+ *   @code
+ *    PROF_BEGIN(PROF_DISPLAY_UPDATE);
+ *    display_update(display);
+ *    PROF_END(PROF_DISPLAY_UPDATE);
+ *    ...
+ *    PROF_GetStats(PROF_DISPLAY_UPDATE,&stats);
+ *    worstUs=PROF_COUNTS_TO_US(stats.max);
+ *
+ *    while (1)
+ *    {
+ *        PROF_LOOP_MARK(currentState);
+ *        ...
+ *    }
+ *    PROF_GetLoopStats(ON_STATE,&stats);
+ *    p99Us=PROF_COUNTS_TO_US(PROF_GetPercentile(&stats,99));
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef PROF_INTERFACE_H_
+#define PROF_INTERFACE_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#if (PROF_ENABLE==PROF_ON)
+#define PROF_BEGIN(id)            PROF_Begin(id)
+#define PROF_END(id)              PROF_End(id)
+#else
+#define PROF_BEGIN(id)            ((void)0)
+#define PROF_END(id)              ((void)0)
+#endif
+
+#if (PROF_LOOP_MONITOR==PROF_ON)
+#define PROF_LOOP_MARK(tag)       PROF_LoopMark(tag)
+#else
+#define PROF_LOOP_MARK(tag)       ((void)0)
+#endif
+
+/**
+ * @brief True when the profiler is compiled (the probes or the loop monitor are enabled), usable in #if.
+ */
+#define PROF_IS_USED              ((PROF_ENABLE==PROF_ON) || (PROF_LOOP_MONITOR==PROF_ON))
+
+/**
+ * @brief Converts TIMER0 counts (as reported in PROF_Stats_t) to microseconds (UPTIME_Lcfg.h must be included).
+ */
+#define PROF_COUNTS_TO_US(counts) UPTIME_COUNTS_TO_US(counts)
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef struct
+{
+	u16 runs;                    /**< number of measured sections (saturates at 65535) */
+	u16 min;                     /**< shortest section in TIMER0 counts */
+	u16 max;                     /**< longest section in TIMER0 counts */
+	u32 sum;                     /**< sum of the sections in TIMER0 counts (mean = sum / runs) */
+	u8 histogram[PROF_BUCKETS];  /**< log2 buckets, halved together when one of them reaches 255 (the shape is kept) */
+}PROF_Stats_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+#if PROF_IS_USED
+
+/**
+ * @brief Clears every probe and the loop monitor.
+ *
+ * @note The uptime service must be initialized.
+ */
+void PROF_Init(void);
+
+/**
+ * @brief Returns the log2 bucket of a duration in TIMER0 counts.
+ */
+u8 PROF_GetBucket(u16 counts);
+
+/**
+ * @brief Returns the (percent) percentile of the statistics from their histogram: the upper bound of the bucket
+ *        where the cumulated histogram reaches (percent)% (limited to the maximum).
+ *
+ * @param stats The statistics (PROF_GetStats() or PROF_GetLoopStats()).
+ * @param percent The percentile in [1,100].
+ * @return The percentile in TIMER0 counts, 0 when nothing was recorded.
+ */
+u16 PROF_GetPercentile(const PROF_Stats_t *stats, u8 percent);
+
+#endif /* PROF_IS_USED */
+
+#if (PROF_ENABLE==PROF_ON)
+
+/**
+ * @brief Starts a measurement (use PROF_BEGIN()).
+ */
+void PROF_Begin(PROF_ProbeId_t id);
+
+/**
+ * @brief Ends a measurement and updates the statistics of the probe (use PROF_END()).
+ */
+void PROF_End(PROF_ProbeId_t id);
+
+/**
+ * @brief Gets a copy of the statistics of a probe.
+ *
+ * @param id The probe.
+ * @param stats Pointer to store the statistics.
+ * @return STD_OK , STD_NULL_POINTER or STD_NOT_EXIST.
+ */
+Std_Error_t PROF_GetStats(PROF_ProbeId_t id, PROF_Stats_t *stats);
+
+/**
+ * @brief Clears the statistics of a probe.
+ *
+ * @param id The probe.
+ * @return STD_OK or STD_NOT_EXIST.
+ */
+Std_Error_t PROF_Reset(PROF_ProbeId_t id);
+
+#endif /* PROF_ENABLE==PROF_ON */
+
+#if (PROF_LOOP_MONITOR==PROF_ON)
+
+/**
+ * @brief Marks the end of a loop iteration (use PROF_LOOP_MARK()): the time since the previous mark is recorded
+ *        under (tag), the first mark only starts the measurement.
+ *
+ * @param tag The tag of the iteration in [0,PROF_LOOP_TAGS-1] (ignored otherwise).
+ */
+void PROF_LoopMark(u8 tag);
+
+/**
+ * @brief Gets a copy of the loop iterations statistics of a tag.
+ *
+ * @param tag The tag.
+ * @param stats Pointer to store the statistics.
+ * @return STD_OK , STD_NULL_POINTER or STD_NOT_EXIST.
+ */
+Std_Error_t PROF_GetLoopStats(u8 tag, PROF_Stats_t *stats);
+
+#endif /* PROF_LOOP_MONITOR==PROF_ON */
+
+#endif /* PROF_INTERFACE_H_ */
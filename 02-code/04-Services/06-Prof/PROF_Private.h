@@ -0,0 +1,61 @@
+/**
+ * @file PROF_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private types and static global variables of the profiler.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef PROF_PRIVATE_H_
+#define PROF_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef struct
+{
+	u16 start;           /**< TIMER0 counts at PROF_Begin() (low 16 bits) */
+	PROF_Stats_t stats;  /**< statistics */
+}PROF_Probe_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Static Global Vaiables                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#if (PROF_ENABLE==PROF_ON)
+static PROF_Probe_t PROF_arrProbes[PROF_PROBES_COUNT];
+#endif
+
+#if (PROF_LOOP_MONITOR==PROF_ON)
+static PROF_Stats_t PROF_arrLoop[PROF_LOOP_TAGS];
+static u16 PROF_u16LoopLast;          /*< TIMER0 counts at the previous mark (low 16 bits) */
+static Std_Bool_t PROF_LoopStarted;   /*< STD_FALSE until the first mark */
+#endif
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Clears statistics.
+ */
+static void PROF_ClearStats(PROF_Stats_t *stats);
+
+/**
+ * @brief Records a duration in statistics.
+ */
+static void PROF_Record(PROF_Stats_t *stats, u16 counts);
+
+#endif /* PROF_PRIVATE_H_ */
@@ -0,0 +1,273 @@
+/**
+ * @file PROF_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the profiler.
+ *         Nothing is compiled when PROF_ENABLE and PROF_LOOP_MONITOR are PROF_OFF.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see PROF_Interface.h
+ * @see PROF_Lcfg.h
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_interrupt.h"
+
+// Services
+#include "UPTIME_Interface.h"
+
+// own module files
+#include "PROF_Lcfg.h"
+#include "PROF_Interface.h"
+
+#if PROF_IS_USED
+
+#include "PROF_Private.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Clears statistics.
+ */
+static void PROF_ClearStats(PROF_Stats_t *stats)
+{
+	u8 i;
+
+	stats->runs=0;
+	stats->min=0xFFFF;
+	stats->max=0;
+	stats->sum=0;
+	for (i=0; i<PROF_BUCKETS; i++)
+	{
+		stats->histogram[i]=0;
+	}
+}
+
+/**
+ * @brief Records a duration in statistics.
+ */
+static void PROF_Record(PROF_Stats_t *stats, u16 counts)
+{
+	u8 bucket=PROF_GetBucket(counts);
+	u8 i;
+
+	if (stats->runs<0xFFFF)
+	{
+		stats->runs++;
+		stats->sum+=counts;
+	}
+	if (counts<stats->min)
+	{
+		stats->min=counts;
+	}
+	if (counts>stats->max)
+	{
+		stats->max=counts;
+	}
+	if (stats->histogram[bucket]==0xFF)
+	{
+		for (i=0; i<PROF_BUCKETS; i++)
+		{
+			stats->histogram[i]>>=1; /*< the percentiles only need the shape of the histogram */
+		}
+	}
+	stats->histogram[bucket]++;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Clears every probe and the loop monitor.
+ */
+void PROF_Init(void)
+{
+	u8 i;
+
+#if (PROF_ENABLE==PROF_ON)
+	for (i=0; i<PROF_PROBES_COUNT; i++)
+	{
+		PROF_Reset((PROF_ProbeId_t)i);
+	}
+#endif
+#if (PROF_LOOP_MONITOR==PROF_ON)
+	for (i=0; i<PROF_LOOP_TAGS; i++)
+	{
+		PROF_ClearStats(&PROF_arrLoop[i]);
+	}
+	PROF_LoopStarted=STD_FALSE;
+#endif
+}
+
+/**
+ * @brief Returns the log2 bucket of a duration in TIMER0 counts.
+ */
+u8 PROF_GetBucket(u16 counts)
+{
+	u8 bucket=0;
+
+	while ((counts!=0) && (bucket<(PROF_BUCKETS-1)))
+	{
+		counts>>=1;
+		bucket++;
+	}
+	return bucket;
+}
+
+/**
+ * @brief Returns the (percent) percentile of the statistics from their histogram.
+ */
+u16 PROF_GetPercentile(const PROF_Stats_t *stats, u8 percent)
+{
+	u16 total=0;
+	u16 cumulated=0;
+	u16 target;
+	u16 percentile=0;
+	u8 i;
+
+	if (stats!=NULL_PTR)
+	{
+		for (i=0; i<PROF_BUCKETS; i++)
+		{
+			total+=stats->histogram[i];
+		}
+		target=(u16)((((u32)total*percent)+99)/100); /*< rounded up: at least (percent)% of the samples */
+		for (i=0; (i<PROF_BUCKETS) && (total>0); i++)
+		{
+			cumulated+=stats->histogram[i];
+			if (cumulated>=target)
+			{
+				percentile=(i==(PROF_BUCKETS-1))? stats->max : (u16)((1U<<i)-1); /*< bucket i ends at 2^i-1 counts */
+				break;
+			}
+		}
+		if (percentile>stats->max)
+		{
+			percentile=stats->max;
+		}
+	}
+	return percentile;
+}
+
+#if (PROF_ENABLE==PROF_ON)
+
+/**
+ * @brief Starts a measurement (use PROF_BEGIN()).
+ */
+void PROF_Begin(PROF_ProbeId_t id)
+{
+	PROF_arrProbes[id].start=(u16)UPTIME_GetCounts();
+}
+
+/**
+ * @brief Ends a measurement and updates the statistics of the probe (use PROF_END()).
+ */
+void PROF_End(PROF_ProbeId_t id)
+{
+	PROF_Record(&PROF_arrProbes[id].stats,(u16)UPTIME_GetCounts()-PROF_arrProbes[id].start);
+}
+
+/**
+ * @brief Gets a copy of the statistics of a probe.
+ */
+Std_Error_t PROF_GetStats(PROF_ProbeId_t id, PROF_Stats_t *stats)
+{
+	Std_Error_t error=STD_OK;
+	u8 sreg;
+
+	if (stats==NULL_PTR)
+	{
+		error=STD_NULL_POINTER;
+	}
+	else if (id>=PROF_PROBES_COUNT)
+	{
+		error=STD_NOT_EXIST;
+	}
+	else
+	{
+		sreg=SREG;
+		Global_Interrupt_Disable__asm(); /*< the probe may be updated by an ISR */
+		*stats=PROF_arrProbes[id].stats;
+		SREG=sreg;
+	}
+	return error;
+}
+
+/**
+ * @brief Clears the statistics of a probe.
+ */
+Std_Error_t PROF_Reset(PROF_ProbeId_t id)
+{
+	Std_Error_t error=STD_OK;
+	u8 sreg;
+
+	if (id>=PROF_PROBES_COUNT)
+	{
+		error=STD_NOT_EXIST;
+	}
+	else
+	{
+		sreg=SREG;
+		Global_Interrupt_Disable__asm(); /*< the probe may be updated by an ISR */
+		PROF_ClearStats(&PROF_arrProbes[id].stats);
+		SREG=sreg;
+	}
+	return error;
+}
+
+#endif /* PROF_ENABLE==PROF_ON */
+
+#if (PROF_LOOP_MONITOR==PROF_ON)
+
+/**
+ * @brief Marks the end of a loop iteration (use PROF_LOOP_MARK()).
+ */
+void PROF_LoopMark(u8 tag)
+{
+	u16 now=(u16)UPTIME_GetCounts();
+
+	if ((PROF_LoopStarted==STD_TRUE) && (tag<PROF_LOOP_TAGS))
+	{
+		PROF_Record(&PROF_arrLoop[tag],now-PROF_u16LoopLast);
+	}
+	PROF_u16LoopLast=now;
+	PROF_LoopStarted=STD_TRUE;
+}
+
+/**
+ * @brief Gets a copy of the loop iterations statistics of a tag.
+ */
+Std_Error_t PROF_GetLoopStats(u8 tag, PROF_Stats_t *stats)
+{
+	Std_Error_t error=STD_OK;
+
+	if (stats==NULL_PTR)
+	{
+		error=STD_NULL_POINTER;
+	}
+	else if (tag>=PROF_LOOP_TAGS)
+	{
+		error=STD_NOT_EXIST;
+	}
+	else
+	{
+		*stats=PROF_arrLoop[tag]; /*< the loop monitor is only updated by the super-loop */
+	}
+	return error;
+}
+
+#endif /* PROF_LOOP_MONITOR==PROF_ON */
+
+#endif /* PROF_IS_USED */
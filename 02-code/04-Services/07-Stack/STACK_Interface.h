@@ -0,0 +1,58 @@
+/**
+ * @file STACK_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the stack monitor (stack painting).
+ *         At reset (before main()) the free RAM between the end of the static data (__heap_start) and the top of
+ *         the stack (RAMEND) is filled with STACK_PAINT_PATTERN, the deepest stack use since reset is the part
+ *         that is no longer painted.
+ *
+ *         - Nothing has to be called at the initialization: the painting is linked in the startup code (.init3).
+ *         - The heap (malloc()) must not be used, it starts at __heap_start too.
+ *         - The stacks of the kernel tasks (OS_STACK_DEFINE()) are static data, they are not measured
+ *           (they have their own canary).
+ *
+ * @par Example:
+ *   @code
+ *    if (STACK_Check()!=STD_OK)
+ *    {
+ *        // less than STACK_MARGIN_BYTES were never used
+ *    }
+ *    depth=STACK_HighWater();
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef STACK_INTERFACE_H_
+#define STACK_INTERFACE_H_
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns the number of RAM bytes that were never used by the stack since reset.
+ *
+ * @note It scans the painted RAM from __heap_start: about 4 cycles per free byte.
+ */
+u16 STACK_GetFree(void);
+
+/**
+ * @brief Returns the deepest stack use since reset in bytes (the high-water mark).
+ *
+ * @note It scans the painted RAM (STACK_GetFree()).
+ */
+u16 STACK_HighWater(void);
+
+/**
+ * @brief Checks the free RAM against the safety margin.
+ *
+ * @return STD_OK when at least STACK_MARGIN_BYTES were never used by the stack, STD_NOK otherwise.
+ */
+Std_Error_t STACK_Check(void);
+
+#endif /* STACK_INTERFACE_H_ */
@@ -0,0 +1,28 @@
+/**
+ * @file STACK_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the stack monitor.
+ *         - the paint pattern
+ *         - the safety margin
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef STACK_LCFG_H_
+#define STACK_LCFG_H_
+
+/**
+ * @brief The byte written in the free RAM at reset, a byte that is still equal to it was never used by the stack.
+ */
+#define STACK_PAINT_PATTERN       0xC5
+
+/**
+ * @brief The minimum number of never used bytes between the end of the static data (__heap_start) and the deepest
+ *        stack pointer, STACK_Check() fails below it.
+ *        It covers what the measurement may have missed: a nested ISR on top of the deepest call.
+ */
+#define STACK_MARGIN_BYTES        128
+
+#endif /* STACK_LCFG_H_ */
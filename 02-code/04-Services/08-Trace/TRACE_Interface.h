@@ -0,0 +1,212 @@
+/**
+ * @file TRACE_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the trace recorder: a RAM ring of 4-byte records
+ *         written by the state machine, system_OnOff(), the ISRs and the keypad, read after the fact
+ *         (a RAM dump of TRACE_Log decoded by 05-tools/02-trace/trace_decode.py).
+ *
+ *         A record is { delta (2 bytes, little endian) , event , arg }:
+ *         - delta  : the uptime ticks (UPTIME_TICK_MS) since the previous record, 65535 means 65535 or more
+ *                    (the records of the same tick are in their order)
+ *         - event  : TRACE_EventId_t
+ *         - arg    : one byte, its meaning depends on the event (TRACE_Lcfg.h)
+ *
+ *         The records are written inline (no call): TRACE_RECORD() in the tasks, TRACE_RECORD_ISR() in the ISRs and
+ *         the callbacks of the ISRs (the interrupts are already disabled). A record writes only its event and arg,
+ *         the next uptime tick stamps the deltas of the records written since the previous one (TRACE_TICK()):
+ *         the first one gets the ticks since the previous record, the next ones 0 (the same tick).
+ *         The log is in .noinit RAM: it survives a watchdog or external reset (TRACE_Init() keeps it and records the
+ *         reset), a power-on reset clears it.
+ *         With TRACE_FREEZE_ON_FAULT, TRACE_FAULT() and a watchdog reset freeze it: the records that led to the fault
+ *         are kept until TRACE_Restart(), the next ones are dropped.
+ *
+ * @note The uptime service advances the delta (TRACE_TICK() in its tick), the ticks don't count while the CPU sleeps
+ *       in Power-save (DELAYED_STATE). More than TRACE_SIZE records in one tick overwrite records not stamped yet:
+ *       the oldest records of the ring keep the deltas of their previous lap.
+ *
+ * @par Example:
+ *   @code
+ *    WDGM_GetResetInfo(&resetInfo);
+ *    TRACE_Init(resetInfo.cause);
+ *    ...
+ *    TRACE_RECORD(TRACE_STATE,currentState);          // task
+ *    TRACE_RECORD_ISR(TRACE_DOOR_ISR,0);              // ISR
+ *    TRACE_FAULT(TRACE_STACK_OVERFLOW,priority);       // fault: recorded, then frozen
+ *
+ *    (avr-gdb) dump binary value trace.bin TRACE_Log
+ *    $ python3 05-tools/02-trace/trace_decode.py trace.bin
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef TRACE_INTERFACE_H_
+#define TRACE_INTERFACE_H_
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define TRACE_RECORD_SIZE         4
+#define TRACE_MAGIC               0x5254   /* "TR": the log is valid, the decoder finds it in a RAM dump */
+#define TRACE_MAX_DELTA           0xFFFF
+
+/* the ring wraps with TRACE_RING_MASK (a constant), the bit above the offsets is the frozen flag of the head */
+#define TRACE_RING_BYTES          ((u8)(TRACE_SIZE*TRACE_RECORD_SIZE))
+#define TRACE_RING_MASK           ((u8)(TRACE_RING_BYTES-1))
+#define TRACE_FROZEN              TRACE_RING_BYTES
+
+#if (TRACE_ENABLE==TRACE_ON)
+
+/**
+ * @brief Writes a record with the interrupts disabled (from an ISR or inside a critical section):
+ *        the event and the arg only (the next tick stamps the delta), nothing when the log is frozen.
+ */
+#define TRACE_RECORD_ISR(id,arg)                                                        \
+	do{                                                                                  \
+		u8 trace_head=TRACE_Log.head;                                                    \
+		if ((trace_head&TRACE_FROZEN)==0)                                                \
+		{                                                                                \
+			TRACE_Log.records[trace_head+2]=(u8)(id);                                    \
+			TRACE_Log.records[trace_head+3]=(u8)(arg);                                   \
+			TRACE_Log.head=(u8)((trace_head+TRACE_RECORD_SIZE)&TRACE_RING_MASK);         \
+		}                                                                                \
+	}while(0)
+
+/**
+ * @brief Writes a record from a task (the ISRs write records too).
+ */
+#define TRACE_RECORD(id,arg)                                                            \
+	do{                                                                                  \
+		u8 trace_sreg=SREG;                                                              \
+		Global_Interrupt_Disable__asm();                                                 \
+		TRACE_RECORD_ISR(id,arg);                                                        \
+		SREG=trace_sreg;                                                                 \
+	}while(0)
+
+/**
+ * @brief Records a fault, then freezes the trace (TRACE_FREEZE_ON_FAULT).
+ */
+#if (TRACE_FREEZE_ON_FAULT==TRACE_ON)
+#define TRACE_FAULT(id,arg)       do{ TRACE_RECORD(id,arg); TRACE_Freeze(); }while(0)
+#else
+#define TRACE_FAULT(id,arg)       TRACE_RECORD(id,arg)
+#endif
+
+/**
+ * @brief Stamps the deltas of the records written since the last stamp (interrupts disabled): the first one gets
+ *        the ticks since the previous record, the next ones 0. Used by TRACE_TICK() and TRACE_Prog.c.
+ */
+#define TRACE_STAMP()                                                                   \
+	do{                                                                                  \
+		u8 trace_stamped=TRACE_Log.stamped;                                              \
+		u8 trace_end=(u8)(TRACE_Log.head&TRACE_RING_MASK);                               \
+		if (trace_stamped!=trace_end)                                                    \
+		{                                                                                \
+			u16 trace_delta=TRACE_Log.delta;                                             \
+			do{                                                                          \
+				TRACE_Log.records[trace_stamped]=(u8)trace_delta;                        \
+				TRACE_Log.records[trace_stamped+1]=(u8)(trace_delta>>8);                 \
+				trace_delta=0;                                                           \
+				trace_stamped=(u8)((trace_stamped+TRACE_RECORD_SIZE)&TRACE_RING_MASK);   \
+			}while (trace_stamped!=trace_end);                                           \
+			TRACE_Log.stamped=trace_end;                                                 \
+			TRACE_Log.delta=0;                                                           \
+		}                                                                                \
+	}while(0)
+
+/**
+ * @brief Stamps the records of the last tick and advances the delta of the next record by one tick
+ *        (the uptime tick ISR).
+ */
+#define TRACE_TICK()                                                                    \
+	do{                                                                                  \
+		TRACE_STAMP();                                                                   \
+		if (TRACE_Log.delta!=TRACE_MAX_DELTA)                                            \
+		{                                                                                \
+			TRACE_Log.delta++;                                                           \
+		}                                                                                \
+	}while(0)
+
+#else
+#define TRACE_RECORD_ISR(id,arg)  ((void)0)
+#define TRACE_RECORD(id,arg)      ((void)0)
+#define TRACE_FAULT(id,arg)       ((void)0)
+#define TRACE_TICK()              ((void)0)
+#endif /* TRACE_ENABLE==TRACE_ON */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef struct
+{
+	u16 delta;       /**< uptime ticks since the previous record (saturates at 65535) */
+	u8 event;        /**< TRACE_EventId_t */
+	u8 arg;          /**< depends on the event */
+}TRACE_Record_t;
+
+/**
+ * @brief The log, its layout is read by trace_decode.py (keep them in sync): the same offsets packed or not.
+ */
+typedef struct
+{
+	u16 magic;                                             /**< TRACE_MAGIC when the log is valid */
+	u16 delta;                                             /**< ticks since the last stamped record (saturates) */
+	u8 size;                                               /**< TRACE_SIZE */
+	u8 head;                                               /**< offset of the next record (the oldest one), | TRACE_FROZEN */
+	u8 stamped;                                            /**< offset of the first record not stamped yet */
+	u8 records[TRACE_SIZE*TRACE_RECORD_SIZE];              /**< the ring */
+}TRACE_Log_t;
+
+#if (TRACE_ENABLE==TRACE_ON)
+/* written inline by the macros (TRACE_Prog.c), read with TRACE_GetRecords() or a RAM dump */
+extern volatile TRACE_Log_t TRACE_Log;
+#endif
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+#if (TRACE_ENABLE==TRACE_ON)
+
+/**
+ * @brief Starts the trace after a reset: a power-on reset (or an invalid log) clears it, the other resets keep the
+ *        records, then the reset is recorded (TRACE_RESET). A watchdog reset freezes it (TRACE_FREEZE_ON_FAULT).
+ *
+ * @param resetCause The reset flags (WDT_RESET_xxx, WDGM_GetResetInfo()).
+ */
+void TRACE_Init(u8 resetCause);
+
+/**
+ * @brief Freezes the trace: the current records are kept, the next ones are dropped.
+ */
+void TRACE_Freeze(void);
+
+/**
+ * @brief Clears the trace and records again (after the frozen records were read).
+ */
+void TRACE_Restart(void);
+
+/**
+ * @brief Returns whether the trace is frozen.
+ */
+Std_Bool_t TRACE_IsFrozen(void);
+
+/**
+ * @brief Copies the records, the oldest first (the records of the current tick are stamped first).
+ *
+ * @param records Array of TRACE_SIZE records to store them.
+ * @param count Pointer to store the number of records.
+ * @return STD_OK or STD_NULL_POINTER.
+ */
+Std_Error_t TRACE_GetRecords(TRACE_Record_t records[], u8 *count);
+
+#endif /* TRACE_ENABLE==TRACE_ON */
+
+#endif /* TRACE_INTERFACE_H_ */
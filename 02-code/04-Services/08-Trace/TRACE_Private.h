@@ -0,0 +1,42 @@
+/**
+ * @file TRACE_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private macros and functions of the trace recorder.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef TRACE_PRIVATE_H_
+#define TRACE_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define TRACE_NOINIT              __attribute__((section(".noinit")))   /* not cleared by the startup code */
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns whether the log in .noinit RAM was written by this firmware (the magic, the size and the offsets).
+ */
+static Std_Bool_t TRACE_IsValid(void);
+
+/**
+ * @brief Clears the log (the records are TRACE_NONE).
+ */
+static void TRACE_Clear(void);
+
+#endif /* TRACE_PRIVATE_H_ */
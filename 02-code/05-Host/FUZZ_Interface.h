@@ -0,0 +1,106 @@
+/**
+ * @file FUZZ_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the state machine fuzzer (host build only).
+ *         The firmware runs on the oven plant simulator (PLANT_Interface.h), the fuzzer generates sequences of
+ *         button, door, weight, keypad and jam events with virtual time gaps and checks the invariants at every step:
+ *         - the heater is never ON while the door is opened
+ *         - the cooking timer (TIMER1) only runs in ON_STATE
+ *
+ *         It is coverage-guided and works on snapshots: a snapshot is the whole firmware world (the .data/.bss of the
+ *         program, the firmware stack and its context) at the end of an execution. An execution restores a snapshot
+ *         of the corpus, appends a few events and keeps its own snapshot when it reached a new coverage
+ *         (a new state transition or, with main.c built with -fsanitize-coverage=trace-pc, a new edge of main.c).
+ *         The boot is run once and a sequence is never replayed from the reset.
+ *
+ *         A violation stops the run, its sequence from the reset is a PLANT script: PLANT_Run() replays it
+ *         (deterministic) in a new process.
+ *
+ * @note GNU/Linux: the snapshot copies __data_start.._end and uses the ucontext functions.
+ *       The fuzzer keeps its own data on the heap, FUZZ_Prog.c must not be built with -fsanitize-coverage.
+ *       The static variables of the harness are part of the snapshots too (keep the results on the stack).
+ *
+ * @par Example (fuzz.c, built as the harness of the host port, main.c with -fsanitize-coverage=trace-pc):
+ *   @code
+ *    #include "PLANT_Interface.h"
+ *    #include "FUZZ_Lcfg.h"
+ *    #include "FUZZ_Interface.h"
+ *    int main(void)
+ *    {
+ *        FUZZ_Stats_t stats;
+ *        FUZZ_Failure_t failure;
+ *        if (FUZZ_Run(1000000UL,1,FIRMWARE_main,&stats,&failure)==STD_NOK)
+ *        {
+ *            // failure.violation at failure.timeMs, failure.script[0..failure.count-1] is the PLANT script
+ *        }
+ *        return 0;
+ *    }
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef FUZZ_INTERFACE_H_
+#define FUZZ_INTERFACE_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The invariants.
+ */
+typedef enum
+{
+	FUZZ_NO_VIOLATION,
+	FUZZ_HEATER_DOOR_OPENED,    /*< the heater is ON while the door is opened */
+	FUZZ_TIMER_NOT_ON_STATE     /*< TIMER1 runs out of ON_STATE */
+}FUZZ_Violation_t;
+
+/**
+ * @brief The statistics of a run.
+ */
+typedef struct
+{
+	u32 executions;
+	u16 corpus;                 /*< the snapshots kept */
+	u16 coverage;               /*< the entries of the coverage map reached */
+	u64 virtualMs;              /*< the virtual time run by the executions */
+}FUZZ_Stats_t;
+
+/**
+ * @brief The first violation of a run.
+ */
+typedef struct
+{
+	FUZZ_Violation_t violation;
+	u32 timeMs;                             /*< the virtual time of the violation since the reset */
+	u8 count;                               /*< the events of the sequence */
+	PLANT_Event_t script[FUZZ_MAX_EVENTS];  /*< the sequence from the reset (PLANT_Run()) */
+}FUZZ_Failure_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Boots the firmware on the plant then fuzzes it until (executions) executions are done or an invariant is
+ *        violated. Called once per process (the firmware never returns).
+ *
+ * @param executions The number of executions.
+ * @param seed The seed of the generated events (the same seed gives the same run).
+ * @param firmwareMain The main() of the firmware (main.c built with -Dmain=FIRMWARE_main).
+ * @param stats Pointer to receive the statistics of the run.
+ * @param failure Pointer to receive the violation (when STD_NOK is returned).
+ * @return STD_OK (no violation) , STD_NOK (violation) , STD_NULL_POINTER or STD_OUT_OF_MEMORY (the snapshots).
+ */
+Std_Error_t FUZZ_Run(u32 executions, u32 seed, Ptr_VoidFuncVoid_t firmwareMain, FUZZ_Stats_t *stats, FUZZ_Failure_t *failure);
+
+#endif /* FUZZ_INTERFACE_H_ */
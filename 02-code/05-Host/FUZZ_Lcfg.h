@@ -0,0 +1,58 @@
+/**
+ * @file FUZZ_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the state machine fuzzer (host build only).
+ *         - the state of the firmware (the invariants and the coverage)
+ *         - the boot time before the first snapshot
+ *         - the generated sequences (events per execution, gaps, tail)
+ *         - the reaction time allowed to the firmware before an invariant is violated
+ *         - the sizes of the corpus, the coverage map and the firmware stack
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef FUZZ_LCFG_H_
+#define FUZZ_LCFG_H_
+
+/**
+ * @brief The current state of the firmware (STATE_t of main.c) and the value of ON_STATE.
+ */
+u8 system_getState(void);
+#define FUZZ_GET_STATE()          system_getState()
+#define FUZZ_ON_STATE             1
+
+/**
+ * @brief The virtual time run from the reset before the first snapshot (the root of the corpus):
+ *        the LCD is initialized and the firmware waits in IDLE_OFF_STATE.
+ */
+#define FUZZ_BOOT_MS              1500
+
+/**
+ * @brief An execution restores a snapshot of the corpus and appends 1 to FUZZ_EXTEND_EVENTS events to its sequence,
+ *        the gap before an event is 0 to FUZZ_MAX_GAP_MS (the short gaps are more likely),
+ *        the execution ends FUZZ_TAIL_MS after its last event.
+ *        A sequence has FUZZ_MAX_EVENTS events at most from the reset.
+ */
+#define FUZZ_EXTEND_EVENTS        4
+#define FUZZ_MAX_GAP_MS           1500
+#define FUZZ_TAIL_MS              200
+#define FUZZ_MAX_EVENTS           64
+
+/**
+ * @brief How long an invariant may be broken before it is a violation (ms): the firmware switches the heater OFF
+ *        in the door ISR and the timer with the state in the same task, the sampling is done at the virtual time steps.
+ */
+#define FUZZ_REACTION_MS          1
+
+/**
+ * @brief The number of snapshots kept (the sequences that reached a new coverage),
+ *        the size of the coverage map (state transitions and, with -fsanitize-coverage=trace-pc, the edges of main.c)
+ *        and the size of the stack the firmware runs on.
+ */
+#define FUZZ_CORPUS_SIZE          128
+#define FUZZ_MAP_SIZE             4096
+#define FUZZ_STACK_SIZE           (256UL*1024UL)
+
+#endif /* FUZZ_LCFG_H_ */
@@ -0,0 +1,165 @@
+/**
+ * @file FUZZ_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private macros, types, functions and static global variables of the state machine fuzzer.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef FUZZ_PRIVATE_H_
+#define FUZZ_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* the port and the bit of a DIO_PIN_t (PA0..PD7) */
+#define FUZZ_PORT(pin)            ((HOST_Port_t)((pin)/8))
+#define FUZZ_BIT(pin)             ((pin)%8)
+
+#define FUZZ_CYCLES_PER_MS        (F_CPU/1000UL)
+
+/* TIMER1 runs while its clock select (CS12:CS10 of TCCR1B) is not 0 */
+#define FUZZ_TCCR1B_ADDRESS       0x4E
+#define FUZZ_TCCR1B_CS_MASK       0x07
+
+/* no breach of an invariant */
+#define FUZZ_NO_BREACH            0xFFFFFFFFUL
+
+/* the firmware stack below the yield point kept by a snapshot (the frames of swapcontext()) */
+#define FUZZ_STACK_MARGIN         512UL
+
+/* the program's .data and .bss (GNU ld) */
+extern char __data_start;
+extern char _end;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief A snapshot of the firmware world, a member of the corpus.
+ */
+typedef struct
+{
+	u8 *pData;                 /*< the copy of __data_start.._end */
+	u8 *pStack;                /*< the copy of the used firmware stack */
+	u32 stackSize;
+	ucontext_t context;        /*< the firmware context at the yield point */
+	u32 endMs;                 /*< the virtual time of the snapshot */
+}FUZZ_Snapshot_t;
+
+/**
+ * @brief The data of the fuzzer: on the heap, out of the snapshots.
+ */
+typedef struct
+{
+	ucontext_t fuzzerContext;
+	ucontext_t firmwareContext;            /*< always restored at this address (its pointers point inside it) */
+	u8 *pFirmwareStack;
+	u8 *pDataStart;
+	u32 dataSize;
+	u8 *pYieldSp;                          /*< the firmware stack at the last yield */
+	u32 yieldMs;                           /*< the virtual time of the last yield */
+
+	FUZZ_Snapshot_t corpus[FUZZ_CORPUS_SIZE];
+	u16 corpusCount;
+
+	u8 trace[FUZZ_MAP_SIZE];               /*< the coverage of the current execution */
+	u8 virgin[FUZZ_MAP_SIZE];              /*< the coverage of the run */
+	u16 coverage;
+
+	PLANT_Event_t pending[FUZZ_EXTEND_EVENTS];
+	u8 pendingCount;
+	u8 pendingNext;
+	u32 endMs;                             /*< the end of the current execution */
+
+	u32 rng;
+	Ptr_VoidFuncVoid_t firmwareMain;
+	FUZZ_Violation_t violation;
+	u32 violationMs;
+}FUZZ_State_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief The random generator of the events (xorshift32).
+ */
+static u32 FUZZ_Random(void);
+
+/**
+ * @brief Records an entry of the coverage map.
+ */
+static void FUZZ_Cover(u32 hash);
+
+/**
+ * @brief Checks the invariants at the current virtual time.
+ */
+static void FUZZ_Check(u32 nowMs);
+
+/**
+ * @brief The step callback of the plant (on the firmware stack): the coverage, the invariants, the end of the
+ *        execution (back to the fuzzer) and the generated events.
+ */
+static void FUZZ_Step(void);
+
+/**
+ * @brief The entry of the firmware context: the firmware on the plant, the generated events only.
+ */
+static void FUZZ_Firmware(void);
+
+/**
+ * @brief Copies the firmware world (the program's data, the firmware stack and context) in a snapshot.
+ */
+static Std_Error_t FUZZ_Save(FUZZ_Snapshot_t *snapshot);
+
+/**
+ * @brief Restores the firmware world from a snapshot.
+ */
+static void FUZZ_Restore(const FUZZ_Snapshot_t *snapshot);
+
+/**
+ * @brief Generates the events of an execution after (startMs), on the inputs of the restored world.
+ */
+static void FUZZ_Generate(u32 startMs);
+
+/**
+ * @brief Returns whether the current execution reached a new entry of the coverage map (and records them).
+ */
+static Std_Bool_t FUZZ_IsNewCoverage(void);
+
+/**
+ * @brief The hook of -fsanitize-coverage=trace-pc (called by the compiler, not by the users).
+ */
+void __sanitizer_cov_trace_pc(void);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* the fuzzer (out of the snapshots: its value is the same in all of them) */
+static FUZZ_State_t *FUZZ_pState=NULL_PTR;
+
+/* the world of the firmware (in the snapshots) */
+static PLANT_Event_t FUZZ_arrScript[FUZZ_MAX_EVENTS];   /*< the applied events from the reset */
+static u8 FUZZ_u8ScriptCount=0;
+static u32 FUZZ_u32DoorBreachMs=FUZZ_NO_BREACH;         /*< the heater is ON with the door opened since */
+static u32 FUZZ_u32TimerBreachMs=FUZZ_NO_BREACH;        /*< TIMER1 runs out of ON_STATE since */
+static u8 FUZZ_u8PrevState=0;
+static uintptr_t FUZZ_PrevPc=0;
+
+#endif /* FUZZ_PRIVATE_H_ */
@@ -0,0 +1,458 @@
+/**
+ * @file FUZZ_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the state machine fuzzer: the firmware runs on the oven plant
+ *         on its own stack, the executions restore the snapshots of the corpus and run generated events.
+ *         Nothing is compiled out of the host build.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see FUZZ_Interface.h
+ * @see FUZZ_Lcfg.h
+ * @copyright Copyright (c) 2026
+ *
+ */
+#if defined(HOST_BUILD)
+
+#include <ucontext.h>
+#include <stdlib.h>
+#include <string.h>
+
+// lib
+#include "Std_Types.h"
+#include "Utils_BitMath.h"
+
+// MCAL
+#include "MCU_config.h"
+#include "DIO_Interface.h"
+
+// HAL
+#include "Keypad_Lcfg.h"
+#include "Keypad_private.h"
+
+// host port
+#include "HOST_Interface.h"
+#include "PLANT_Lcfg.h"
+#include "PLANT_Interface.h"
+
+// own module files
+#include "FUZZ_Lcfg.h"
+#include "FUZZ_Interface.h"
+#include "FUZZ_Private.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief The random generator of the events (xorshift32).
+ */
+static u32 FUZZ_Random(void)
+{
+	u32 x=FUZZ_pState->rng;
+
+	x^=x<<13;
+	x^=x>>17;
+	x^=x<<5;
+	FUZZ_pState->rng=x;
+	return x;
+}
+
+/**
+ * @brief Records an entry of the coverage map.
+ */
+static void FUZZ_Cover(u32 hash)
+{
+	u8 *entry;
+
+	hash^=hash>>16;
+	hash*=0x7FEB352DUL;
+	hash^=hash>>15;
+	entry=&FUZZ_pState->trace[hash%FUZZ_MAP_SIZE];
+	if (*entry<0xFF)
+	{
+		(*entry)++;
+	}
+}
+
+/**
+ * @brief Checks the invariants at the current virtual time.
+ */
+static void FUZZ_Check(u32 nowMs)
+{
+	u8 isOpened=get_bit(HOST_GetPins(FUZZ_PORT(PLANT_DOOR_PIN)),FUZZ_BIT(PLANT_DOOR_PIN));
+	u8 isHeating=get_bit(HOST_GetOutputs(FUZZ_PORT(PLANT_HEATER_PIN)),FUZZ_BIT(PLANT_HEATER_PIN));
+	u8 isTiming=((HOST_PeekIo(FUZZ_TCCR1B_ADDRESS)&FUZZ_TCCR1B_CS_MASK)!=0)? 1 : 0;
+
+	/* the heater is never ON while the door is opened */
+	if ((isOpened==1) && (isHeating==1))
+	{
+		if (FUZZ_u32DoorBreachMs==FUZZ_NO_BREACH)
+		{
+			FUZZ_u32DoorBreachMs=nowMs;
+		}
+		else if ((nowMs-FUZZ_u32DoorBreachMs)>=FUZZ_REACTION_MS)
+		{
+			FUZZ_pState->violation=FUZZ_HEATER_DOOR_OPENED;
+			FUZZ_pState->violationMs=nowMs;
+		}
+		else
+		{
+			//still in the reaction time
+		}
+	}
+	else
+	{
+		FUZZ_u32DoorBreachMs=FUZZ_NO_BREACH;
+	}
+
+	/* the cooking timer only runs in ON_STATE */
+	if ((isTiming==1) && (FUZZ_GET_STATE()!=FUZZ_ON_STATE))
+	{
+		if (FUZZ_u32TimerBreachMs==FUZZ_NO_BREACH)
+		{
+			FUZZ_u32TimerBreachMs=nowMs;
+		}
+		else if ((nowMs-FUZZ_u32TimerBreachMs)>=FUZZ_REACTION_MS)
+		{
+			FUZZ_pState->violation=FUZZ_TIMER_NOT_ON_STATE;
+			FUZZ_pState->violationMs=nowMs;
+		}
+		else
+		{
+			//still in the reaction time
+		}
+	}
+	else
+	{
+		FUZZ_u32TimerBreachMs=FUZZ_NO_BREACH;
+	}
+}
+
+/**
+ * @brief The step callback of the plant (on the firmware stack): the coverage, the invariants, the end of the
+ *        execution (back to the fuzzer) and the generated events.
+ */
+static void FUZZ_Step(void)
+{
+	u32 nowMs=(u32)(HOST_GetCycles()/FUZZ_CYCLES_PER_MS);
+	u8 state=FUZZ_GET_STATE();
+	FUZZ_State_t *pState=FUZZ_pState;
+
+	/* the state transitions */
+	if (state!=FUZZ_u8PrevState)
+	{
+		FUZZ_Cover(((u32)FUZZ_u8PrevState<<8)|state);
+		FUZZ_u8PrevState=state;
+	}
+
+	if (pState->violation==FUZZ_NO_VIOLATION)
+	{
+		FUZZ_Check(nowMs);
+	}
+
+	/* the end of the execution: the fuzzer saves or restores the world, the next execution resumes here */
+	if ((pState->violation!=FUZZ_NO_VIOLATION) || (nowMs>=pState->endMs))
+	{
+		pState->pYieldSp=(u8 *)&pState;
+		pState->yieldMs=nowMs;
+		swapcontext(&pState->firmwareContext,&pState->fuzzerContext);
+		pState=FUZZ_pState;
+	}
+
+	/* the events: applied now and recorded at their virtual time (PLANT_Run() applies them at the same step) */
+	while ((pState->pendingNext<pState->pendingCount) && (pState->pending[pState->pendingNext].timeMs<=nowMs))
+	{
+		PLANT_Act(pState->pending[pState->pendingNext].action,pState->pending[pState->pendingNext].value);
+		FUZZ_arrScript[FUZZ_u8ScriptCount].timeMs=nowMs;
+		FUZZ_arrScript[FUZZ_u8ScriptCount].action=pState->pending[pState->pendingNext].action;
+		FUZZ_arrScript[FUZZ_u8ScriptCount].value=pState->pending[pState->pendingNext].value;
+		FUZZ_u8ScriptCount++;
+		pState->pendingNext++;
+	}
+}
+
+/**
+ * @brief The entry of the firmware context: the firmware on the plant, the generated events only.
+ */
+static void FUZZ_Firmware(void)
+{
+	PLANT_SetStepCallBack(FUZZ_Step);
+	(void)PLANT_Run(NULL_PTR,0,0xFFFFFFFFUL,FUZZ_pState->firmwareMain);
+}
+
+/**
+ * @brief Copies the firmware world (the program's data, the firmware stack and context) in a snapshot.
+ */
+static Std_Error_t FUZZ_Save(FUZZ_Snapshot_t *snapshot)
+{
+	Std_Error_t error=STD_OK;
+	FUZZ_State_t *pState=FUZZ_pState;
+	u8 *stackTop=pState->pFirmwareStack+FUZZ_STACK_SIZE;
+	u8 *stackLow=pState->pYieldSp-FUZZ_STACK_MARGIN;
+	u8 *pStack;
+
+	if (stackLow<pState->pFirmwareStack)
+	{
+		stackLow=pState->pFirmwareStack;
+	}
+	if (snapshot->pData==NULL_PTR)
+	{
+		snapshot->pData=malloc(pState->dataSize);
+	}
+	pStack=realloc(snapshot->pStack,(size_t)(stackTop-stackLow));
+	if (pStack!=NULL_PTR)
+	{
+		snapshot->pStack=pStack;
+	}
+
+	if ((snapshot->pData==NULL_PTR) || (pStack==NULL_PTR))
+	{
+		error=STD_OUT_OF_MEMORY;
+	}
+	else
+	{
+		memcpy(snapshot->pData,pState->pDataStart,pState->dataSize);
+		snapshot->stackSize=(u32)(stackTop-stackLow);
+		memcpy(snapshot->pStack,stackLow,snapshot->stackSize);
+		snapshot->context=pState->firmwareContext;
+		snapshot->endMs=pState->yieldMs;
+	}
+	return error;
+}
+
+/**
+ * @brief Restores the firmware world from a snapshot.
+ */
+static void FUZZ_Restore(const FUZZ_Snapshot_t *snapshot)
+{
+	FUZZ_State_t *pState=FUZZ_pState;
+
+	memcpy(pState->pDataStart,snapshot->pData,pState->dataSize);
+	memcpy(pState->pFirmwareStack+FUZZ_STACK_SIZE-snapshot->stackSize,snapshot->pStack,snapshot->stackSize);
+	pState->firmwareContext=snapshot->context;
+}
+
+/**
+ * @brief Generates the events of an execution after (startMs), on the inputs of the restored world.
+ */
+static void FUZZ_Generate(u32 startMs)
+{
+	FUZZ_State_t *pState=FUZZ_pState;
+	u8 count=(u8)(1+(FUZZ_Random()%FUZZ_EXTEND_EVENTS));
+	u8 isOpened=get_bit(HOST_GetPins(FUZZ_PORT(PLANT_DOOR_PIN)),FUZZ_BIT(PLANT_DOOR_PIN));
+	u8 isEmpty=get_bit(HOST_GetPins(FUZZ_PORT(PLANT_WEIGHT_PIN)),FUZZ_BIT(PLANT_WEIGHT_PIN));
+	u32 timeMs=startMs;
+	u8 key;
+	u8 pick;
+	u8 i;
+
+	if (count>(FUZZ_MAX_EVENTS-FUZZ_u8ScriptCount))
+	{
+		count=(u8)(FUZZ_MAX_EVENTS-FUZZ_u8ScriptCount);
+	}
+	for (i=0; i<count; i++)
+	{
+		/* the short gaps are more likely: the debounce, the press time and the ticks are in the first ms */
+		timeMs+=FUZZ_Random()%(1+(FUZZ_Random()%FUZZ_MAX_GAP_MS));
+		pState->pending[i].timeMs=timeMs;
+		pick=(u8)(FUZZ_Random()%100);
+		if (pick<45)
+		{
+			do
+			{
+				key=keypad_charArray[FUZZ_Random()%ROWS][FUZZ_Random()%COLS];
+			} while (key=='\0');
+			pState->pending[i].action=PLANT_KEY;
+			pState->pending[i].value=key;
+		}
+		else if (pick<65)
+		{
+			pState->pending[i].action=PLANT_START;
+			pState->pending[i].value=0;
+		}
+		else if (pick<75)
+		{
+			pState->pending[i].action=PLANT_STOP;
+			pState->pending[i].value=0;
+		}
+		else if (pick<85)
+		{
+			isOpened^=1;
+			pState->pending[i].action=PLANT_DOOR;
+			pState->pending[i].value=isOpened;
+		}
+		else if (pick<95)
+		{
+			pState->pending[i].action=PLANT_FOOD;
+			pState->pending[i].value=isEmpty;     /*< the weight pin is low with food: toggled */
+			isEmpty^=1;
+		}
+		else
+		{
+			pState->pending[i].action=PLANT_JAM;
+			pState->pending[i].value=(u8)(FUZZ_Random()&1);
+		}
+	}
+	pState->pendingCount=count;
+	pState->pendingNext=0;
+	pState->endMs=timeMs+FUZZ_TAIL_MS;
+}
+
+/**
+ * @brief Returns whether the current execution reached a new entry of the coverage map (and records them).
+ */
+static Std_Bool_t FUZZ_IsNewCoverage(void)
+{
+	FUZZ_State_t *pState=FUZZ_pState;
+	Std_Bool_t isNew=STD_FALSE;
+	u16 i;
+
+	for (i=0; i<FUZZ_MAP_SIZE; i++)
+	{
+		if ((pState->trace[i]!=0) && (pState->virgin[i]==0))
+		{
+			pState->virgin[i]=1;
+			pState->coverage++;
+			isNew=STD_TRUE;
+		}
+	}
+	return isNew;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief The hook of -fsanitize-coverage=trace-pc (the edges of the instrumented files).
+ */
+void __sanitizer_cov_trace_pc(void)
+{
+	uintptr_t pc=(uintptr_t)__builtin_return_address(0);
+
+	if (FUZZ_pState!=NULL_PTR)
+	{
+		FUZZ_Cover((u32)(pc^FUZZ_PrevPc));
+		FUZZ_PrevPc=pc>>1;
+	}
+}
+
+/**
+ * @brief Boots the firmware on the plant then fuzzes it until (executions) executions are done or an invariant is violated.
+ */
+Std_Error_t FUZZ_Run(u32 executions, u32 seed, Ptr_VoidFuncVoid_t firmwareMain, FUZZ_Stats_t *stats, FUZZ_Failure_t *failure)
+{
+	Std_Error_t error=STD_OK;
+	FUZZ_State_t *pState=NULL_PTR;
+	FUZZ_Snapshot_t *snapshot;
+	u32 execution;
+	u16 i;
+
+	if ((firmwareMain==NULL_PTR) || (stats==NULL_PTR) || (failure==NULL_PTR))
+	{
+		error=STD_NULL_POINTER;
+	}
+	else
+	{
+		pState=calloc(1,sizeof(FUZZ_State_t));
+		if (pState!=NULL_PTR)
+		{
+			pState->pFirmwareStack=malloc(FUZZ_STACK_SIZE);
+		}
+		if ((pState==NULL_PTR) || (pState->pFirmwareStack==NULL_PTR))
+		{
+			error=STD_OUT_OF_MEMORY;
+		}
+	}
+
+	if (error==STD_OK)
+	{
+		memset(stats,0,sizeof(FUZZ_Stats_t));
+		failure->violation=FUZZ_NO_VIOLATION;
+		failure->count=0;
+
+		/* set before the first snapshot: the same value in all of them */
+		FUZZ_pState=pState;
+		pState->pDataStart=(u8 *)&__data_start;
+		pState->dataSize=(u32)(&_end-&__data_start);
+		pState->rng=(seed!=0)? seed : 1;
+		pState->firmwareMain=firmwareMain;
+
+		/* the boot: the root of the corpus */
+		pState->endMs=FUZZ_BOOT_MS;
+		getcontext(&pState->firmwareContext);
+		pState->firmwareContext.uc_stack.ss_sp=pState->pFirmwareStack;
+		pState->firmwareContext.uc_stack.ss_size=FUZZ_STACK_SIZE;
+		pState->firmwareContext.uc_link=&pState->fuzzerContext;
+		makecontext(&pState->firmwareContext,FUZZ_Firmware,0);
+		swapcontext(&pState->fuzzerContext,&pState->firmwareContext);
+		if (pState->violation==FUZZ_NO_VIOLATION)
+		{
+			(void)FUZZ_IsNewCoverage();
+			error=FUZZ_Save(&pState->corpus[0]);
+			pState->corpusCount=1;
+		}
+
+		for (execution=0; (execution<executions) && (error==STD_OK) && (pState->violation==FUZZ_NO_VIOLATION); execution++)
+		{
+			snapshot=&pState->corpus[FUZZ_Random()%pState->corpusCount];
+			FUZZ_Restore(snapshot);
+			if (FUZZ_u8ScriptCount>=FUZZ_MAX_EVENTS)
+			{
+				snapshot=&pState->corpus[0];
+				FUZZ_Restore(snapshot);
+			}
+			FUZZ_Generate(snapshot->endMs);
+			memset(pState->trace,0,FUZZ_MAP_SIZE);
+			swapcontext(&pState->fuzzerContext,&pState->firmwareContext);
+
+			stats->executions++;
+			stats->virtualMs+=pState->yieldMs-snapshot->endMs;
+			if ((pState->violation==FUZZ_NO_VIOLATION) && (FUZZ_IsNewCoverage()==STD_TRUE))
+			{
+				if (pState->corpusCount<FUZZ_CORPUS_SIZE)
+				{
+					error=FUZZ_Save(&pState->corpus[pState->corpusCount]);
+					pState->corpusCount++;
+				}
+				else
+				{
+					error=FUZZ_Save(&pState->corpus[1+(FUZZ_Random()%(FUZZ_CORPUS_SIZE-1))]);
+				}
+			}
+		}
+
+		/* the world of the violation is the current one */
+		if (pState->violation!=FUZZ_NO_VIOLATION)
+		{
+			failure->violation=pState->violation;
+			failure->timeMs=pState->violationMs;
+			failure->count=FUZZ_u8ScriptCount;
+			memcpy(failure->script,FUZZ_arrScript,sizeof(FUZZ_arrScript));
+			error=STD_NOK;
+		}
+		stats->corpus=pState->corpusCount;
+		stats->coverage=pState->coverage;
+
+		FUZZ_pState=NULL_PTR;
+		for (i=0; i<FUZZ_CORPUS_SIZE; i++)
+		{
+			free(pState->corpus[i].pData);
+			free(pState->corpus[i].pStack);
+		}
+	}
+	if (pState!=NULL_PTR)
+	{
+		free(pState->pFirmwareStack);
+		free(pState);
+	}
+	return error;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,156 @@
+/**
+ * @file HD44780_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the HD44780 display model (host build only).
+ *         The model watches the RS, EN and data pins of its wiring (HD44780_Lcfg.h) on the host port
+ *         (HOST_SetOutputsCallBack()) and behaves as the controller:
+ *         - the 4-bit interface (nibble pairs) and the 8-bit interface, the switch by the function set
+ *         - the instructions, DDRAM (2x40 or 1x80), CGRAM (64 bytes), the address counter and the display shift
+ *         - the timing violations: an operation while the controller is busy or before the power on,
+ *           an enable pulse/cycle too short, RS or data changed while EN is high
+ *         - the bus time of every kind of operation and the redundant writes (a value that is already there)
+ *         - the frames: the screen every HD44780_FRAME_MS when it changed, and the diff of two frames
+ *
+ *         The virtual time only advances in the delays and the sleep (the code is not timed on the host):
+ *         the bus time of an operation is the virtual time from its first pin change to the first pin change of the
+ *         next operation (the waits of the driver are counted), or its execution time when the bus goes idle.
+ *
+ * @par Example (harness.c, after HOST_Init(); PLANT_Run() calls HD44780_Init() itself):
+ *   @code
+ *    #include "HD44780_Lcfg.h"                     // before HD44780_Interface.h (the frame size)
+ *    #include "HD44780_Interface.h"
+ *    const HD44780_Frame_t *frames;
+ *    u16 count;
+ *    HD44780_Init();
+ *    ...                                           // run the firmware
+ *    count=HD44780_GetFrames(&frames);
+ *    printf("%s\n",frames[count-1].text[0]);       // the first row of the last frame
+ *    HD44780_DiffFrames(&frames[0],&frames[1],diffs,8);
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef HD44780_INTERFACE_H_
+#define HD44780_INTERFACE_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The kinds of operations on the bus.
+ */
+typedef enum
+{
+	HD44780_OP_CLEAR,       /*< clear display */
+	HD44780_OP_HOME,        /*< return home */
+	HD44780_OP_ENTRY,       /*< entry mode set */
+	HD44780_OP_DISPLAY,     /*< display on/off control */
+	HD44780_OP_SHIFT,       /*< cursor or display shift */
+	HD44780_OP_FUNCTION,    /*< function set */
+	HD44780_OP_CGRAM,       /*< set CGRAM address */
+	HD44780_OP_DDRAM,       /*< set DDRAM address */
+	HD44780_OP_DATA,        /*< write data to CGRAM or DDRAM */
+	HD44780_OP_NOP,         /*< instruction 0x00 (e.g. the first nibble of the 4-bit switch, latched in 8-bit mode) */
+	HD44780_OPS_COUNT
+}HD44780_Op_t;
+
+/**
+ * @brief The statistics of a kind of operations.
+ */
+typedef struct
+{
+	u32 count;
+	u32 redundant;          /*< operations that changed nothing (same value, same address, same mode) */
+	u64 busCycles;          /*< the total bus time (CPU cycles) */
+	u64 execCycles;         /*< the total execution time the controller needs: busCycles-execCycles is the over-wait */
+	u32 maxBusCycles;
+}HD44780_OpStats_t;
+
+/**
+ * @brief The statistics of the model since HD44780_Init().
+ */
+typedef struct
+{
+	HD44780_OpStats_t ops[HD44780_OPS_COUNT];
+	u32 busyViolations;     /*< a byte (or its first nibble) latched before the end of the previous execution */
+	u32 earlyViolations;    /*< a latch before HD44780_POWER_ON_MS */
+	u32 pulseViolations;    /*< an enable pulse shorter than PWEH or an enable cycle shorter than TCYCE */
+	u32 setupViolations;    /*< RS or data changed while EN is high */
+}HD44780_Stats_t;
+
+/**
+ * @brief A frame: the visible screen.
+ */
+typedef struct
+{
+	u32 timeMs;                                   /*< the virtual time of the sample */
+	Std_Bool_t isOn;                              /*< the display is ON (the text is kept while it is OFF) */
+	u8 text[HD44780_ROWS][HD44780_COLS+1];        /*< the characters of each row, null terminated */
+}HD44780_Frame_t;
+
+/**
+ * @brief A different cell of two frames.
+ */
+typedef struct
+{
+	u8 row;
+	u8 col;
+	u8 before;
+	u8 after;
+}HD44780_Cell_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Resets the model (power on: 8-bit interface, display OFF, DDRAM blank) and starts watching the pins
+ *        (HOST_SetOutputsCallBack()). Call it after HOST_Init(), before the firmware.
+ */
+void HD44780_Init(void);
+
+/**
+ * @brief Returns the current screen.
+ *
+ * @param frame Pointer to receive the screen.
+ * @return STD_OK or STD_NULL_POINTER.
+ */
+Std_Error_t HD44780_GetScreen(HD44780_Frame_t *frame);
+
+/**
+ * @brief Returns the recorded frames (oldest first), the frame in progress is sampled first.
+ *
+ * @param frames Pointer to receive the address of the frames.
+ * @return The number of frames (HD44780_FRAMES_SIZE at most, the later frames are not kept).
+ */
+u16 HD44780_GetFrames(const HD44780_Frame_t **frames);
+
+/**
+ * @brief Returns the statistics (the bus time of the last operation is counted at the next one).
+ *
+ * @param stats Pointer to receive the statistics.
+ * @return STD_OK or STD_NULL_POINTER.
+ */
+Std_Error_t HD44780_GetStats(HD44780_Stats_t *stats);
+
+/**
+ * @brief Compares two frames cell by cell.
+ *
+ * @param before The first frame.
+ * @param after The second frame.
+ * @param diffs Array to receive the different cells (NULL_PTR: only counted).
+ * @param maxDiffs The size of the array.
+ * @return The number of different cells (all of them, even beyond maxDiffs), 0 for a NULL_PTR frame.
+ */
+u16 HD44780_DiffFrames(const HD44780_Frame_t *before, const HD44780_Frame_t *after, HD44780_Cell_t diffs[], u16 maxDiffs);
+
+#endif /* HD44780_INTERFACE_H_ */
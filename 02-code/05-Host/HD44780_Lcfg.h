@@ -0,0 +1,64 @@
+/**
+ * @file HD44780_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the HD44780 display model (host build only).
+ *         - the wiring of the modeled LCD (its pins on the host port) and its size
+ *         - the timings of the controller (datasheet)
+ *         - the frames record
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef HD44780_LCFG_H_
+#define HD44780_LCFG_H_
+
+/**
+ * @brief The wiring of the modeled LCD: the pins it watches, as the board connects them (the model only knows the pins,
+ *        the same wiring as LCD_arrOfLCD[0] in LCD_Lcfg.c).
+ *
+ * BUS_WIDTH : 4 (DATA_PINS are D4..D7, D0..D3 not connected) or 8 (DATA_PINS are D0..D7)
+ * DATA_PINS : the data pins (DIO_Interface.h names), from the lowest data bit
+ */
+#define HD44780_RS_PIN            PB0
+#define HD44780_EN_PIN            PB1
+#define HD44780_BUS_WIDTH         4
+#define HD44780_DATA_PINS         { PB4 , PB5 , PB6 , PB7 }
+
+/**
+ * @brief The size of the modeled display (4x20: the 3rd and 4th rows continue the 1st and 2nd lines).
+ */
+#define HD44780_ROWS              4
+#define HD44780_COLS              20
+
+/**
+ * @brief The timings of the controller (HD44780U datasheet, fosc=270kHz).
+ *
+ * POWER_ON : no instruction before this time after the power on (VCC rises at the reset of the host port)
+ * EXEC     : the execution time of the instructions, LONG: clear display and return home
+ * DATA     : the execution time of a data write (37us + tADD)
+ * PWEH     : the minimum width of the enable pulse
+ * TCYCE    : the minimum enable cycle (rise to rise)
+ */
+#define HD44780_POWER_ON_MS       40
+#define HD44780_EXEC_US           37
+#define HD44780_EXEC_LONG_US      1520
+#define HD44780_DATA_US           41
+#define HD44780_PWEH_NS           450
+#define HD44780_TCYCE_NS          1000
+
+/**
+ * @brief A gap between two operations longer than this is idle time (not the bus time of the previous operation).
+ *        It must be longer than the longest wait of the driver after an operation (LCD_Clear_Display_time_ms).
+ */
+#define HD44780_IDLE_US           5000
+
+/**
+ * @brief The frames: the screen is sampled every HD44780_FRAME_MS (the period of task_display()),
+ *        a sample is recorded when it differs from the previous recorded frame.
+ */
+#define HD44780_FRAME_MS          100
+#define HD44780_FRAMES_SIZE       256
+
+#endif /* HD44780_LCFG_H_ */
@@ -0,0 +1,145 @@
+/**
+ * @file HD44780_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private macros, functions and static global variables of the HD44780 display model.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef HD44780_PRIVATE_H_
+#define HD44780_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define HD44780_DDRAM_SIZE        80
+#define HD44780_LINE_SIZE         40          /*< a line of the 2-line mode */
+#define HD44780_CGRAM_SIZE        64
+#define HD44780_BLANK             ' '
+
+/* the bits of the instructions */
+#define HD44780_ENTRY_ID          1           /*< increment */
+#define HD44780_ENTRY_S           0           /*< display shift */
+#define HD44780_DISPLAY_D         2           /*< display ON */
+#define HD44780_SHIFT_SC          3           /*< display shift (not cursor move) */
+#define HD44780_SHIFT_RL          2           /*< to the right */
+#define HD44780_FUNCTION_DL       4           /*< 8-bit interface */
+#define HD44780_FUNCTION_N        3           /*< 2 lines */
+
+/* the bus: RS in bit 8, D7..D0 in bits 7..0 (D3..D0 read 0 in the 4-bit wiring) */
+#define HD44780_BUS_RS            8
+
+#if (HD44780_BUS_WIDTH!=4) && (HD44780_BUS_WIDTH!=8)
+#error "HD44780_BUS_WIDTH must be 4 or 8 (HD44780_Lcfg.h)"
+#endif
+
+/* the port and the bit of a DIO_PIN_t (PA0..PD7) */
+#define HD44780_PORT(pin)         ((HOST_Port_t)((pin)/8))
+#define HD44780_BIT(pin)          ((pin)%8)
+
+#define HD44780_US_TO_CYCLES(us)  ((u64)(us)*(F_CPU/1000000UL))
+#define HD44780_NS_TO_CYCLES(ns)  ((((u64)(ns)*F_CPU)+999999999ULL)/1000000000ULL)
+#define HD44780_CYCLES_PER_MS     (F_CPU/1000UL)
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns the level of a pin driven by the firmware (0 or 1).
+ */
+static u8 HD44780_ReadPin(u8 pin);
+
+/**
+ * @brief The outputs callback of the host port: decodes the pin changes of the modeled LCD.
+ */
+static void HD44780_Outputs(u8 port);
+
+/**
+ * @brief Counts the bus time of the pending operation, it ends at (now): the start of the next operation.
+ */
+static void HD44780_EndOp(u64 now);
+
+/**
+ * @brief A falling edge of EN: latches a byte (8-bit interface) or a nibble (4-bit interface).
+ */
+static void HD44780_Latch(u16 bus, u64 now);
+
+/**
+ * @brief Executes an instruction or a data write, returns its kind, sets *isRedundant and *execUs.
+ */
+static HD44780_Op_t HD44780_Execute(u8 rs, u8 byte, Std_Bool_t *isRedundant, u16 *execUs);
+
+/**
+ * @brief Moves the address counter by one (I/D) in CGRAM or in the DDRAM lines.
+ */
+static void HD44780_MoveAc(Std_Bool_t isIncrement);
+
+/**
+ * @brief Returns the DDRAM index (0..79) of a DDRAM address.
+ */
+static u8 HD44780_DdramIndex(u8 address);
+
+/**
+ * @brief Fills a frame from the current state.
+ */
+static void HD44780_Fill(HD44780_Frame_t *frame, u32 timeMs);
+
+/**
+ * @brief Records the screen as a frame when a frame boundary passed since the last operation and it changed.
+ */
+static void HD44780_Sample(u64 now);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* the controller */
+static u8 HD44780_au8Ddram[HD44780_DDRAM_SIZE];
+static u8 HD44780_au8Cgram[HD44780_CGRAM_SIZE];
+static u8 HD44780_u8Ac;                          /*< the address counter */
+static Std_Bool_t HD44780_IsCgram;               /*< the address counter points to CGRAM */
+static u8 HD44780_u8Shift;                       /*< the display shift (0..39 or 0..79) */
+static u8 HD44780_u8Entry;
+static u8 HD44780_u8Display;
+static u8 HD44780_u8Function;
+static Std_Bool_t HD44780_IsLowNibble;           /*< 4-bit interface: the next nibble is the low one */
+static u16 HD44780_u16HighNibble;                /*< RS and the high nibble of the byte in progress */
+
+/* the bus */
+static const u8 HD44780_au8DataPins[HD44780_BUS_WIDTH]=HD44780_DATA_PINS;
+static u8 HD44780_u8PortsMask;                   /*< the ports of the pins of the modeled LCD */
+static u8 HD44780_u8LastEn;
+static u16 HD44780_u16LastBus;
+static u64 HD44780_u64EnRise;
+static u64 HD44780_u64PrevEnRise;
+static u64 HD44780_u64BusyUntil;
+
+/* the operation in progress and the last latched one (its bus time ends at the start of the next one) */
+static Std_Bool_t HD44780_IsOpStarted;
+static u64 HD44780_u64OpStart;
+static Std_Bool_t HD44780_IsOpPending;
+static HD44780_Op_t HD44780_PendingOp;
+static u64 HD44780_u64PendingStart;
+static u64 HD44780_u64PendingLatch;
+static u16 HD44780_u16PendingExecUs;
+
+static HD44780_Stats_t HD44780_Stats;
+
+static HD44780_Frame_t HD44780_arrFrames[HD44780_FRAMES_SIZE];
+static u16 HD44780_u16FramesCount;
+static u64 HD44780_u64NextFrame;                 /*< the next sample time (cycles) */
+
+#endif /* HD44780_PRIVATE_H_ */
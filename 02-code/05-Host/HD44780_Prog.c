@@ -0,0 +1,564 @@
+/**
+ * @file HD44780_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the HD44780 display model: the pin changes of the LCD are
+ *         decoded on the virtual time of the host port.
+ *         Nothing is compiled out of the host build.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see HD44780_Interface.h
+ * @see HD44780_Lcfg.h
+ * @copyright Copyright (c) 2026
+ *
+ */
+#if defined(HOST_BUILD)
+
+// lib
+#include "Std_Types.h"
+#include "Utils_BitMath.h"
+#include "Protothread.h"
+
+// MCAL
+#include "MCU_config.h"
+#include "DIO_Interface.h"
+
+// HAL
+
+// host port
+#include "HOST_Interface.h"
+
+// own module files
+#include "HD44780_Lcfg.h"
+#include "HD44780_Interface.h"
+#include "HD44780_Private.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns the level of a pin driven by the firmware (0 or 1).
+ */
+static u8 HD44780_ReadPin(u8 pin)
+{
+	return get_bit(HOST_GetOutputs(HD44780_PORT(pin)),HD44780_BIT(pin));
+}
+
+/**
+ * @brief The outputs callback of the host port: decodes the pin changes of the modeled LCD.
+ */
+static void HD44780_Outputs(u8 port)
+{
+	u64 now=HOST_GetCycles();
+	u8 en;
+	u16 bus;
+	u8 i;
+
+	if (port<HOST_PORTS_COUNT) /*< only the ports of HD44780_u8PortsMask are watched */
+	{
+		en=HD44780_ReadPin(HD44780_EN_PIN);
+		bus=(u16)HD44780_ReadPin(HD44780_RS_PIN)<<HD44780_BUS_RS;
+		for (i=0; i<HD44780_BUS_WIDTH; i++)
+		{
+			bus|=(u16)HD44780_ReadPin(HD44780_au8DataPins[i])<<(i+(8-HD44780_BUS_WIDTH)); /*< 4-bit: D4..D7 */
+		}
+
+		if ((en!=HD44780_u8LastEn) || (bus!=HD44780_u16LastBus))
+		{
+			/* the first pin change after a latch starts a new operation: the previous one ends here */
+			if (HD44780_IsOpStarted==STD_FALSE)
+			{
+				HD44780_IsOpStarted=STD_TRUE;
+				HD44780_u64OpStart=now;
+				if (HD44780_IsOpPending==STD_TRUE)
+				{
+					HD44780_EndOp(now);
+				}
+			}
+			if ((HD44780_u8LastEn==1) && (bus!=HD44780_u16LastBus))
+			{
+				HD44780_Stats.setupViolations++;
+			}
+			if ((HD44780_u8LastEn==0) && (en==1))
+			{
+				if ((HD44780_u64PrevEnRise!=0) && ((now-HD44780_u64PrevEnRise)<HD44780_NS_TO_CYCLES(HD44780_TCYCE_NS)))
+				{
+					HD44780_Stats.pulseViolations++;
+				}
+				HD44780_u64PrevEnRise=now;
+				HD44780_u64EnRise=now;
+			}
+			else if ((HD44780_u8LastEn==1) && (en==0))
+			{
+				if ((now-HD44780_u64EnRise)<HD44780_NS_TO_CYCLES(HD44780_PWEH_NS))
+				{
+					HD44780_Stats.pulseViolations++;
+				}
+				HD44780_Latch(HD44780_u16LastBus,now); /*< the bus as it was while EN was high */
+			}
+			else
+			{
+				//only RS or data changed
+			}
+			HD44780_u8LastEn=en;
+			HD44780_u16LastBus=bus;
+		}
+	}
+}
+
+/**
+ * @brief Counts the bus time of the pending operation, it ends at (now): the start of the next operation.
+ */
+static void HD44780_EndOp(u64 now)
+{
+	HD44780_OpStats_t *stats=&HD44780_Stats.ops[HD44780_PendingOp];
+	u64 execCycles=HD44780_US_TO_CYCLES(HD44780_u16PendingExecUs);
+	u64 busCycles;
+
+	if ((now-HD44780_u64PendingLatch)<=HD44780_US_TO_CYCLES(HD44780_IDLE_US))
+	{
+		busCycles=now-HD44780_u64PendingStart;    /*< back to back: the waits of the driver are bus time */
+	}
+	else
+	{
+		busCycles=(HD44780_u64PendingLatch-HD44780_u64PendingStart)+execCycles; /*< the bus went idle */
+	}
+	stats->busCycles+=busCycles;
+	stats->execCycles+=execCycles;
+	if (busCycles>stats->maxBusCycles)
+	{
+		stats->maxBusCycles=(u32)busCycles;
+	}
+	HD44780_IsOpPending=STD_FALSE;
+}
+
+/**
+ * @brief A falling edge of EN: latches a byte (8-bit interface) or a nibble (4-bit interface).
+ */
+static void HD44780_Latch(u16 bus, u64 now)
+{
+	Std_Bool_t isRedundant=STD_FALSE;
+	Std_Bool_t isByte=STD_TRUE;
+	u16 execUs=0;
+	u8 rs=(u8)get_bit(bus,HD44780_BUS_RS);
+	u8 byte=(u8)bus;
+	HD44780_Op_t op;
+
+	if (now<((u64)HD44780_POWER_ON_MS*HD44780_CYCLES_PER_MS))
+	{
+		HD44780_Stats.earlyViolations++;
+	}
+	if (get_bit(HD44780_u8Function,HD44780_FUNCTION_DL)==0)
+	{
+		if (HD44780_IsLowNibble==STD_FALSE)
+		{
+			HD44780_u16HighNibble=bus&((1U<<HD44780_BUS_RS)|0xF0);
+			HD44780_IsLowNibble=STD_TRUE;
+			isByte=STD_FALSE;
+			if (now<HD44780_u64BusyUntil)
+			{
+				HD44780_Stats.busyViolations++;
+			}
+		}
+		else
+		{
+			HD44780_IsLowNibble=STD_FALSE;
+			rs=(u8)get_bit(HD44780_u16HighNibble,HD44780_BUS_RS);
+			byte=(u8)(HD44780_u16HighNibble|((bus>>4)&0x0F));
+		}
+	}
+	else if (now<HD44780_u64BusyUntil)
+	{
+		HD44780_Stats.busyViolations++;
+	}
+	else
+	{
+		//in time
+	}
+
+	if (isByte==STD_TRUE)
+	{
+		HD44780_Sample(now);
+		op=HD44780_Execute(rs,byte,&isRedundant,&execUs);
+		HD44780_Stats.ops[op].count++;
+		if (isRedundant==STD_TRUE)
+		{
+			HD44780_Stats.ops[op].redundant++;
+		}
+		HD44780_u64BusyUntil=now+HD44780_US_TO_CYCLES(execUs);
+
+		HD44780_IsOpStarted=STD_FALSE;
+		HD44780_IsOpPending=STD_TRUE;
+		HD44780_PendingOp=op;
+		HD44780_u64PendingStart=HD44780_u64OpStart;
+		HD44780_u64PendingLatch=now;
+		HD44780_u16PendingExecUs=execUs;
+	}
+}
+
+/**
+ * @brief Executes an instruction or a data write, returns its kind, sets *isRedundant and *execUs.
+ */
+static HD44780_Op_t HD44780_Execute(u8 rs, u8 byte, Std_Bool_t *isRedundant, u16 *execUs)
+{
+	HD44780_Op_t op;
+	u8 size=(get_bit(HD44780_u8Function,HD44780_FUNCTION_N)==1)? HD44780_LINE_SIZE : HD44780_DDRAM_SIZE;
+	u8 i;
+
+	*execUs=HD44780_EXEC_US;
+	if (rs==1)
+	{
+		op=HD44780_OP_DATA;
+		*execUs=HD44780_DATA_US;
+		if (HD44780_IsCgram==STD_TRUE)
+		{
+			*isRedundant=(HD44780_au8Cgram[HD44780_u8Ac]==byte)? STD_TRUE : STD_FALSE;
+			HD44780_au8Cgram[HD44780_u8Ac]=byte;
+		}
+		else
+		{
+			*isRedundant=(HD44780_au8Ddram[HD44780_DdramIndex(HD44780_u8Ac)]==byte)? STD_TRUE : STD_FALSE;
+			HD44780_au8Ddram[HD44780_DdramIndex(HD44780_u8Ac)]=byte;
+			if (get_bit(HD44780_u8Entry,HD44780_ENTRY_S)==1)
+			{
+				HD44780_u8Shift=(get_bit(HD44780_u8Entry,HD44780_ENTRY_ID)==1)? ((HD44780_u8Shift+1)%size)
+				                                                             : ((HD44780_u8Shift+size-1)%size);
+			}
+		}
+		HD44780_MoveAc((get_bit(HD44780_u8Entry,HD44780_ENTRY_ID)==1)? STD_TRUE : STD_FALSE);
+	}
+	else if (get_bit(byte,7)==1)
+	{
+		op=HD44780_OP_DDRAM;
+		*isRedundant=((HD44780_IsCgram==STD_FALSE) && (HD44780_u8Ac==(byte&0x7F)))? STD_TRUE : STD_FALSE;
+		HD44780_u8Ac=byte&0x7F;
+		HD44780_IsCgram=STD_FALSE;
+	}
+	else if (get_bit(byte,6)==1)
+	{
+		op=HD44780_OP_CGRAM;
+		*isRedundant=((HD44780_IsCgram==STD_TRUE) && (HD44780_u8Ac==(byte&0x3F)))? STD_TRUE : STD_FALSE;
+		HD44780_u8Ac=byte&0x3F;
+		HD44780_IsCgram=STD_TRUE;
+	}
+	else if (get_bit(byte,5)==1)
+	{
+		op=HD44780_OP_FUNCTION;
+		*isRedundant=(HD44780_u8Function==(byte&0x1C))? STD_TRUE : STD_FALSE;
+		HD44780_u8Function=byte&0x1C;
+		HD44780_IsLowNibble=STD_FALSE;
+	}
+	else if (get_bit(byte,4)==1)
+	{
+		op=HD44780_OP_SHIFT;
+		if (get_bit(byte,HD44780_SHIFT_SC)==1)
+		{
+			/* the text moves right: the first visible address decreases */
+			HD44780_u8Shift=(get_bit(byte,HD44780_SHIFT_RL)==1)? ((HD44780_u8Shift+size-1)%size) : ((HD44780_u8Shift+1)%size);
+		}
+		else
+		{
+			HD44780_MoveAc((get_bit(byte,HD44780_SHIFT_RL)==1)? STD_TRUE : STD_FALSE);
+		}
+	}
+	else if (get_bit(byte,3)==1)
+	{
+		op=HD44780_OP_DISPLAY;
+		*isRedundant=(HD44780_u8Display==(byte&0x07))? STD_TRUE : STD_FALSE;
+		HD44780_u8Display=byte&0x07;
+	}
+	else if (get_bit(byte,2)==1)
+	{
+		op=HD44780_OP_ENTRY;
+		*isRedundant=(HD44780_u8Entry==(byte&0x03))? STD_TRUE : STD_FALSE;
+		HD44780_u8Entry=byte&0x03;
+	}
+	else if (get_bit(byte,1)==1)
+	{
+		op=HD44780_OP_HOME;
+		*execUs=HD44780_EXEC_LONG_US;
+		*isRedundant=((HD44780_IsCgram==STD_FALSE) && (HD44780_u8Ac==0) && (HD44780_u8Shift==0))? STD_TRUE : STD_FALSE;
+		HD44780_u8Ac=0;
+		HD44780_u8Shift=0;
+		HD44780_IsCgram=STD_FALSE;
+	}
+	else if (get_bit(byte,0)==1)
+	{
+		op=HD44780_OP_CLEAR;
+		*execUs=HD44780_EXEC_LONG_US;
+		*isRedundant=((HD44780_IsCgram==STD_FALSE) && (HD44780_u8Ac==0) && (HD44780_u8Shift==0))? STD_TRUE : STD_FALSE;
+		for (i=0; i<HD44780_DDRAM_SIZE; i++)
+		{
+			if (HD44780_au8Ddram[i]!=HD44780_BLANK)
+			{
+				*isRedundant=STD_FALSE;
+			}
+			HD44780_au8Ddram[i]=HD44780_BLANK;
+		}
+		HD44780_u8Ac=0;
+		HD44780_u8Shift=0;
+		HD44780_IsCgram=STD_FALSE;
+		set_bit(HD44780_u8Entry,HD44780_ENTRY_ID);
+	}
+	else
+	{
+		op=HD44780_OP_NOP;
+		*execUs=0;
+		*isRedundant=STD_TRUE;
+	}
+	return op;
+}
+
+/**
+ * @brief Moves the address counter by one (I/D) in CGRAM or in the DDRAM lines.
+ */
+static void HD44780_MoveAc(Std_Bool_t isIncrement)
+{
+	if (HD44780_IsCgram==STD_TRUE)
+	{
+		HD44780_u8Ac=(u8)((HD44780_u8Ac+((isIncrement==STD_TRUE)? 1 : (HD44780_CGRAM_SIZE-1)))%HD44780_CGRAM_SIZE);
+	}
+	else if (get_bit(HD44780_u8Function,HD44780_FUNCTION_N)==1)
+	{
+		/* 2 lines: 0x00..0x27 then 0x40..0x67 */
+		if (isIncrement==STD_TRUE)
+		{
+			HD44780_u8Ac=(HD44780_u8Ac==0x27)? 0x40 : ((HD44780_u8Ac==0x67)? 0x00 : (HD44780_u8Ac+1));
+		}
+		else
+		{
+			HD44780_u8Ac=(HD44780_u8Ac==0x40)? 0x27 : ((HD44780_u8Ac==0x00)? 0x67 : (HD44780_u8Ac-1));
+		}
+	}
+	else
+	{
+		HD44780_u8Ac=(u8)((HD44780_u8Ac+((isIncrement==STD_TRUE)? 1 : (HD44780_DDRAM_SIZE-1)))%HD44780_DDRAM_SIZE);
+	}
+}
+
+/**
+ * @brief Returns the DDRAM index (0..79) of a DDRAM address.
+ */
+static u8 HD44780_DdramIndex(u8 address)
+{
+	u8 index;
+
+	if (get_bit(HD44780_u8Function,HD44780_FUNCTION_N)==1)
+	{
+		index=(u8)(((get_bit(address,6)==1)? HD44780_LINE_SIZE : 0)+((address&0x3F)%HD44780_LINE_SIZE));
+	}
+	else
+	{
+		index=(u8)(address%HD44780_DDRAM_SIZE);
+	}
+	return index;
+}
+
+/**
+ * @brief Fills a frame from the current state.
+ */
+static void HD44780_Fill(HD44780_Frame_t *frame, u32 timeMs)
+{
+	u8 row;
+	u8 col;
+	u16 offset;
+
+	frame->timeMs=timeMs;
+	frame->isOn=(get_bit(HD44780_u8Display,HD44780_DISPLAY_D)==1)? STD_TRUE : STD_FALSE;
+	for (row=0; row<HD44780_ROWS; row++)
+	{
+		for (col=0; col<HD44780_COLS; col++)
+		{
+			if (get_bit(HD44780_u8Function,HD44780_FUNCTION_N)==1)
+			{
+				/* 4x20: the rows 3 and 4 are the second halves of the lines 1 and 2 */
+				offset=(u16)((row/2)*HD44780_COLS+col+HD44780_u8Shift);
+				frame->text[row][col]=HD44780_au8Ddram[((row%2)*HD44780_LINE_SIZE)+(offset%HD44780_LINE_SIZE)];
+			}
+			else
+			{
+				offset=(u16)(row*HD44780_COLS+col+HD44780_u8Shift);
+				frame->text[row][col]=HD44780_au8Ddram[offset%HD44780_DDRAM_SIZE];
+			}
+		}
+		frame->text[row][HD44780_COLS]='\0';
+	}
+}
+
+/**
+ * @brief Records the screen as a frame when a frame boundary passed since the last operation and it changed.
+ */
+static void HD44780_Sample(u64 now)
+{
+	const u64 period=(u64)HD44780_FRAME_MS*HD44780_CYCLES_PER_MS;
+	HD44780_Frame_t frame;
+	Std_Bool_t isChanged=STD_TRUE;
+
+	if (now>=HD44780_u64NextFrame)
+	{
+		/* the screen did not change since the last operation: it is the screen at the boundary */
+		HD44780_Fill(&frame,(u32)(HD44780_u64NextFrame/HD44780_CYCLES_PER_MS));
+		if (HD44780_u16FramesCount>0)
+		{
+			isChanged=((frame.isOn!=HD44780_arrFrames[HD44780_u16FramesCount-1].isOn) ||
+			           (HD44780_DiffFrames(&HD44780_arrFrames[HD44780_u16FramesCount-1],&frame,NULL_PTR,0)>0))? STD_TRUE : STD_FALSE;
+		}
+		if ((isChanged==STD_TRUE) && (HD44780_u16FramesCount<HD44780_FRAMES_SIZE))
+		{
+			HD44780_arrFrames[HD44780_u16FramesCount]=frame;
+			HD44780_u16FramesCount++;
+		}
+		HD44780_u64NextFrame=((now/period)+1)*period;
+	}
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Resets the model and starts watching the pins.
+ */
+void HD44780_Init(void)
+{
+	u8 i;
+	u8 op;
+
+	for (i=0; i<HD44780_DDRAM_SIZE; i++)
+	{
+		HD44780_au8Ddram[i]=HD44780_BLANK;
+	}
+	for (i=0; i<HD44780_CGRAM_SIZE; i++)
+	{
+		HD44780_au8Cgram[i]=0;
+	}
+	HD44780_u8Ac=0;
+	HD44780_IsCgram=STD_FALSE;
+	HD44780_u8Shift=0;
+	HD44780_u8Entry=(1<<HD44780_ENTRY_ID);           /*< the reset state of the controller */
+	HD44780_u8Display=0;
+	HD44780_u8Function=(1<<HD44780_FUNCTION_DL);
+	HD44780_IsLowNibble=STD_FALSE;
+
+	HD44780_u8PortsMask=0;
+	set_bit(HD44780_u8PortsMask,HD44780_PORT(HD44780_EN_PIN));
+	set_bit(HD44780_u8PortsMask,HD44780_PORT(HD44780_RS_PIN));
+	for (i=0; i<HD44780_BUS_WIDTH; i++)
+	{
+		set_bit(HD44780_u8PortsMask,HD44780_PORT(HD44780_au8DataPins[i]));
+	}
+	HD44780_u8LastEn=0;
+	HD44780_u16LastBus=0;
+	HD44780_u64EnRise=0;
+	HD44780_u64PrevEnRise=0;
+	HD44780_u64BusyUntil=0;
+	HD44780_IsOpStarted=STD_FALSE;
+	HD44780_IsOpPending=STD_FALSE;
+
+	for (op=0; op<HD44780_OPS_COUNT; op++)
+	{
+		HD44780_Stats.ops[op].count=0;
+		HD44780_Stats.ops[op].redundant=0;
+		HD44780_Stats.ops[op].busCycles=0;
+		HD44780_Stats.ops[op].execCycles=0;
+		HD44780_Stats.ops[op].maxBusCycles=0;
+	}
+	HD44780_Stats.busyViolations=0;
+	HD44780_Stats.earlyViolations=0;
+	HD44780_Stats.pulseViolations=0;
+	HD44780_Stats.setupViolations=0;
+
+	HD44780_u16FramesCount=0;
+	HD44780_u64NextFrame=HOST_GetCycles();
+
+	HOST_SetOutputsCallBack(HD44780_Outputs,HD44780_u8PortsMask);
+}
+
+/**
+ * @brief Returns the current screen.
+ */
+Std_Error_t HD44780_GetScreen(HD44780_Frame_t *frame)
+{
+	Std_Error_t error=STD_OK;
+
+	if (frame==NULL_PTR)
+	{
+		error=STD_NULL_POINTER;
+	}
+	else
+	{
+		HD44780_Fill(frame,(u32)(HOST_GetCycles()/HD44780_CYCLES_PER_MS));
+	}
+	return error;
+}
+
+/**
+ * @brief Returns the recorded frames (oldest first), the frame in progress is sampled first.
+ */
+u16 HD44780_GetFrames(const HD44780_Frame_t **frames)
+{
+	HD44780_Sample(HOST_GetCycles());
+	if (frames!=NULL_PTR)
+	{
+		*frames=HD44780_arrFrames;
+	}
+	return HD44780_u16FramesCount;
+}
+
+/**
+ * @brief Returns the statistics.
+ */
+Std_Error_t HD44780_GetStats(HD44780_Stats_t *stats)
+{
+	Std_Error_t error=STD_OK;
+
+	if (stats==NULL_PTR)
+	{
+		error=STD_NULL_POINTER;
+	}
+	else
+	{
+		*stats=HD44780_Stats;
+	}
+	return error;
+}
+
+/**
+ * @brief Compares two frames cell by cell.
+ */
+u16 HD44780_DiffFrames(const HD44780_Frame_t *before, const HD44780_Frame_t *after, HD44780_Cell_t diffs[], u16 maxDiffs)
+{
+	u16 count=0;
+	u8 row;
+	u8 col;
+
+	if ((before!=NULL_PTR) && (after!=NULL_PTR))
+	{
+		for (row=0; row<HD44780_ROWS; row++)
+		{
+			for (col=0; col<HD44780_COLS; col++)
+			{
+				if (before->text[row][col]!=after->text[row][col])
+				{
+					if ((diffs!=NULL_PTR) && (count<maxDiffs))
+					{
+						diffs[count].row=row;
+						diffs[count].col=col;
+						diffs[count].before=before->text[row][col];
+						diffs[count].after=after->text[row][col];
+					}
+					count++;
+				}
+			}
+		}
+	}
+	return count;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,235 @@
+/**
+ * @file HOST_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the host port: the firmware (main.c, MCAL, HAL, Services)
+ *         built for the PC with the HOST_BUILD flag, for the tests, the fuzzing and the benchmarks (no AVR toolchain,
+ *         no Proteus).
+ *
+ *         - MemMap.h maps the registers to a simulated register file (HOST_Io8()).
+ *         - _delay_ms()/_delay_us() and the sleep advance a virtual time in CPU cycles (F_CPU).
+ *         - TIMER0, TIMER1 and TIMER2 (synchronous or on the 32768Hz crystal) count on the virtual time
+ *           (normal, CTC and fast PWM modes, the OCx outputs are not modeled) and raise their interrupts,
+ *           the virtual time jumps from a timer event to the next one.
+ *         - INT0/INT1/INT2 follow the levels given to HOST_SetPins() (MCUCR/MCUCSR sense control).
+ *         - Any interrupt can be injected (HOST_RaiseInterrupt()), it is serviced as soon as it is enabled and the
+ *           I bit of SREG is set, the lowest vector first, as on the AVR.
+ *
+ *         Not modeled: the preemptive kernel (OS_PREEMPTIVE must be OS_OFF), the watchdog, the clear of an interrupt
+ *         flag by writing 1 (the pending interrupts are kept by the port), the USART/SPI/TWI/ADC peripherals
+ *         (their interrupts can be injected).
+ *
+ * @par Build (host gcc, the same enum and char options as the AVR build): 05-tools/03-host/Makefile
+ *   @code
+ *    make -C 05-tools/03-host          # build/libfirmware.a: main() is renamed FIRMWARE_main
+ *    make -C 05-tools/03-host test     # builds and runs the tests (05-tools/03-host/test_*.c)
+ *   @endcode
+ *   A harness is linked with the library, every module directory of 02-code is an include directory:
+ *   @code
+ *    gcc -DHOST_BUILD -std=gnu99 -funsigned-char -fshort-enums -O2 -I<every module directory> \
+ *        harness.c 05-tools/03-host/build/libfirmware.a -o harness
+ *   @endcode
+ *
+ * @par Example (harness.c):
+ *   @code
+ *    static jmp_buf stop;
+ *    static void harness_step(void)
+ *    {
+ *        if (HOST_GetCycles()>=(5ULL*F_CPU)) // 5 seconds of firmware time
+ *        {
+ *            longjmp(stop,1);
+ *        }
+ *        HOST_SetPins(HOST_PORTA,...);        // buttons, door, ...
+ *    }
+ *    int main(void)
+ *    {
+ *        HOST_Init();
+ *        HOST_SetStepCallBack(harness_step);
+ *        if (setjmp(stop)==0)
+ *        {
+ *            FIRMWARE_main();
+ *        }
+ *        return 0;
+ *    }
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef HOST_INTERFACE_H_
+#define HOST_INTERFACE_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The delays of <util/delay.h>: they advance the virtual time (the timers count and the interrupts run).
+ */
+#define _delay_ms(ms)             HOST_Delay_us((u32)((ms)*1000))
+#define _delay_us(us)             HOST_Delay_us((u32)(us))
+
+/**
+ * @brief The size of the register file: the data space addresses of the I/O registers (0x20..0x5F).
+ */
+#define HOST_IO_SIZE              0x60
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef enum
+{
+	HOST_PORTA,
+	HOST_PORTB,
+	HOST_PORTC,
+	HOST_PORTD,
+	HOST_PORTS_COUNT
+}HOST_Port_t;
+
+/**
+ * @brief The interrupt vectors (the number of __vector_n, the lowest has the highest priority).
+ */
+typedef enum
+{
+	HOST_INT0=1,
+	HOST_INT1,
+	HOST_INT2,
+	HOST_TIMER2_COMP,
+	HOST_TIMER2_OVF,
+	HOST_TIMER1_CAPT,
+	HOST_TIMER1_COMPA,
+	HOST_TIMER1_COMPB,
+	HOST_TIMER1_OVF,
+	HOST_TIMER0_COMP,
+	HOST_TIMER0_OVF,
+	HOST_SPI_STC,
+	HOST_USART_RXC,
+	HOST_USART_UDRE,
+	HOST_USART_TXC,
+	HOST_ADC,
+	HOST_EE_RDY,
+	HOST_ANA_COMP,
+	HOST_TWI,
+	HOST_SPM_RDY,
+	HOST_VECTORS_COUNT
+}HOST_Vector_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Clears the register file, the virtual time, the pending interrupts and the pin levels (call it before the firmware).
+ */
+void HOST_Init(void);
+
+/**
+ * @brief Returns the simulated register at a data space address (used by MemMap.h).
+ *        Reading a PINx register first calls the pins callback then computes the port levels.
+ *
+ * @param address The data space address of the register (0x20..0x5F).
+ */
+volatile u8 *HOST_Io8(u8 address);
+
+/**
+ * @brief Sets the I bit of SREG and services the pending interrupts (sei()).
+ */
+void HOST_Sei(void);
+
+/**
+ * @brief Clears the I bit of SREG (cli()).
+ */
+void HOST_Cli(void);
+
+/**
+ * @brief The sleep instruction: enables the interrupts then advances the virtual time until an interrupt is serviced.
+ *        TIMER0, TIMER1 and the synchronous TIMER2 stop in the sleep modes other than Idle and ADC noise reduction.
+ */
+void HOST_Sleep(void);
+
+/**
+ * @brief Advances the virtual time by (us) microseconds (_delay_us()/_delay_ms()).
+ */
+void HOST_Delay_us(u32 us);
+
+/**
+ * @brief Advances the virtual time by (cycles) CPU cycles: the timers count, the pending interrupts are serviced.
+ *
+ * @note Must not be called from the step callback.
+ */
+void HOST_Advance(u32 cycles);
+
+/**
+ * @brief Returns the virtual time in CPU cycles since HOST_Init().
+ */
+u64 HOST_GetCycles(void);
+
+/**
+ * @brief Sets the external levels of the pins of a port (the inputs read them, the outputs ignore them),
+ *        the edges of INT0 (PD2), INT1 (PD3) and INT2 (PB2) raise their interrupts.
+ *
+ * @param port The port.
+ * @param levels One bit per pin.
+ */
+void HOST_SetPins(HOST_Port_t port, u8 levels);
+
+/**
+ * @brief Returns the levels of the pins of a port: PORTx for the outputs, the external levels for the inputs.
+ */
+u8 HOST_GetPins(HOST_Port_t port);
+
+/**
+ * @brief Returns the levels driven by the outputs of a port (PORTx & DDRx), the inputs read 0.
+ */
+u8 HOST_GetOutputs(HOST_Port_t port);
+
+/**
+ * @brief Returns the value of a register (MemMap.h address) without the side effects of an access
+ *        (the pins callback, the outputs check): the host tools observe the firmware.
+ */
+u8 HOST_PeekIo(u8 address);
+
+/**
+ * @brief Raises an interrupt (injection), it stays pending until it is serviced.
+ */
+void HOST_RaiseInterrupt(HOST_Vector_t vector);
+
+/**
+ * @brief An input capture event of TIMER1: ICR1 takes TCNT1 and TIMER1_CAPT is raised.
+ */
+void HOST_Timer1Capture(void);
+
+/**
+ * @brief Sets the function called after every step of the virtual time (the models of the outside world).
+ *
+ * @param LocalPtr Pointer to the callback function (NULL_PTR: none).
+ */
+void HOST_SetStepCallBack(Ptr_VoidFuncVoid_t LocalPtr);
+
+/**
+ * @brief Sets the function called before a PINx register is read, with the port (HOST_Port_t) as argument:
+ *        it can compute the inputs from the outputs (e.g. a keypad matrix) with HOST_SetPins().
+ *
+ * @param LocalPtr Pointer to the callback function (NULL_PTR: none).
+ */
+void HOST_SetPinsCallBack(Ptr_VoidFuncU8_t LocalPtr);
+
+/**
+ * @brief Sets the function called when the outputs (HOST_GetOutputs()) of a port change, with the port (HOST_Port_t)
+ *        as argument: the models of the devices driven by the firmware (e.g. a display bus).
+ *        The change is seen at the next register access or delay/sleep after the write, at the same virtual time.
+ *
+ * @param LocalPtr Pointer to the callback function (NULL_PTR: none, no cost in the register accesses).
+ * @param portsMask The watched ports: bit n for the port n (HOST_Port_t), every access checks them.
+ */
+void HOST_SetOutputsCallBack(Ptr_VoidFuncU8_t LocalPtr, u8 portsMask);
+
+#endif /* HOST_INTERFACE_H_ */
@@ -0,0 +1,33 @@
+/**
+ * @file HOST_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the host port (host build only).
+ *         - the frequency of the TIMER2 asynchronous crystal
+ *         - the virtual time step of a sleep without running timer
+ *         - the external level of the unconnected input pins
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef HOST_LCFG_H_
+#define HOST_LCFG_H_
+
+/**
+ * @brief The clock of TIMER2 in asynchronous mode (ASSR.AS2), the RTC crystal.
+ */
+#define HOST_TIMER2_CRYSTAL_HZ    32768UL
+
+/**
+ * @brief The virtual time (CPU cycles) a sleep advances at a time while no interrupt wakes the CPU up,
+ *        the step callback runs after every step (it can inject the wake-up event).
+ */
+#define HOST_SLEEP_STEP_CYCLES    (F_CPU/1000UL)
+
+/**
+ * @brief The level of the input pins that are not driven by HOST_SetPins() (the pull-ups of the buttons).
+ */
+#define HOST_PINS_DEFAULT         0xFF
+
+#endif /* HOST_LCFG_H_ */
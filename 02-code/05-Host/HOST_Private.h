@@ -0,0 +1,226 @@
+/**
+ * @file HOST_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private macros, types and static global variables of the host port.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef HOST_PRIVATE_H_
+#define HOST_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define HOST_SREG_I               7
+
+/* the data space addresses of the port registers: PINx, DDRx=PINx+1, PORTx=PINx+2 */
+#define HOST_PIN_ADDRESS(port)    ((u8)(0x39-(3*(port))))
+#define HOST_DDR_ADDRESS(port)    ((u8)(HOST_PIN_ADDRESS(port)+1))
+#define HOST_PORT_ADDRESS(port)   ((u8)(HOST_PIN_ADDRESS(port)+2))
+
+/* the addresses of the interrupt enable registers */
+#define HOST_SPCR_ADDRESS         0x2D
+#define HOST_UCSRB_ADDRESS        0x2A
+#define HOST_ADCSRA_ADDRESS       0x26
+#define HOST_EECR_ADDRESS         0x3C
+#define HOST_ACSR_ADDRESS         0x28
+#define HOST_TWCR_ADDRESS         0x56
+#define HOST_SPMCR_ADDRESS        0x57
+#define HOST_TIMSK_ADDRESS        0x59
+#define HOST_GICR_ADDRESS         0x5B
+
+/* the external interrupt pins and sense control bits */
+#define HOST_INT0_PIN             2   /*< PD2 */
+#define HOST_INT1_PIN             3   /*< PD3 */
+#define HOST_INT2_PIN             2   /*< PB2 */
+#define HOST_MCUCR_ISC00          0
+#define HOST_MCUCR_ISC10          2
+#define HOST_MCUCSR_ISC2          6
+#define HOST_MCUCR_SM0            4
+#define HOST_ASSR_AS2             3
+
+/* the timer control bits */
+#define HOST_TCCRx_CS_MASK        0x07
+#define HOST_TCCRx_WGMx1          3   /*< TCCR0/TCCR2 */
+#define HOST_TCCRx_WGMx0          6   /*< TCCR0/TCCR2 */
+#define HOST_TCCR1B_WGM12         3
+
+#define HOST_TIMERS_COUNT         3
+#define HOST_TIMER_UNITS          2   /*< compare units of TIMER1 (A,B), TIMER0/TIMER2 have one */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The enable bit of an interrupt vector.
+ */
+typedef struct
+{
+	u8 address;  /**< the data space address of the register of the enable bit (0: always enabled) */
+	u8 bit;      /**< the enable bit */
+}HOST_Enable_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                          Static Global Vaiables                              */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static volatile u8 HOST_au8IoFile[HOST_IO_SIZE];      /*< the register file */
+static u8 HOST_au8PinsLevel[HOST_PORTS_COUNT];        /*< the external levels of the pins */
+static u32 HOST_u32Pending;                           /*< one bit per vector */
+static u64 HOST_u64Cycles;                            /*< the virtual time */
+static u64 HOST_au64TimerRest[HOST_TIMERS_COUNT];     /*< timer clock * CPU cycles accumulated towards the next count */
+static Std_Bool_t HOST_IsClkIoStopped=STD_FALSE;      /*< sleep modes other than Idle/ADC noise reduction */
+static Ptr_VoidFuncVoid_t HOST_Step_Fptr=NULL_PTR;
+static Ptr_VoidFuncU8_t HOST_Pins_Fptr=NULL_PTR;
+static Ptr_VoidFuncU8_t HOST_Outputs_Fptr=NULL_PTR;
+static u8 HOST_au8OutputsShadow[HOST_PORTS_COUNT];    /*< the outputs (PORTx & DDRx) seen by the outputs callback */
+static u8 HOST_au8OutputsPorts[HOST_PORTS_COUNT];     /*< the ports watched by the outputs callback */
+static u8 HOST_u8OutputsCount=0;
+static Std_Bool_t HOST_IsOutputsArmed=STD_FALSE;      /*< a PORTx/DDRx register was accessed, its write is not seen yet */
+
+/**
+ * @brief The ISRs of the firmware (ISR() defines __vector_n), weak: a vector without ISR is NULL_PTR.
+ */
+extern void INT0_VECT(void) __attribute__((weak));
+extern void INT1_VECT(void) __attribute__((weak));
+extern void INT2_VECT(void) __attribute__((weak));
+extern void TIMER2_COMP_VECT(void) __attribute__((weak));
+extern void TIMER2_OVF_VECT(void) __attribute__((weak));
+extern void TIMER1_CAPT_VECT(void) __attribute__((weak));
+extern void TIMER1_COMPA_VECT(void) __attribute__((weak));
+extern void TIMER1_COMPB_VECT(void) __attribute__((weak));
+extern void TIMER1_OVF_VECT(void) __attribute__((weak));
+extern void TIMER0_COMP_VECT(void) __attribute__((weak));
+extern void TIMER0_OVF_VECT(void) __attribute__((weak));
+extern void SPI_STC_VECT(void) __attribute__((weak));
+extern void USART_RXC_VECT(void) __attribute__((weak));
+extern void USART_UDRE_VECT(void) __attribute__((weak));
+extern void USART_TXC_VECT(void) __attribute__((weak));
+extern void ADC_VECT(void) __attribute__((weak));
+extern void EE_RDY_VECT(void) __attribute__((weak));
+extern void ANA_COMP_VECT(void) __attribute__((weak));
+extern void TWI_VECT(void) __attribute__((weak));
+extern void SPM_RDY_VECT(void) __attribute__((weak));
+
+static Ptr_VoidFuncVoid_t const HOST_arrVectors[HOST_VECTORS_COUNT]={
+	NULL_PTR         , INT0_VECT        , INT1_VECT        , INT2_VECT       ,
+	TIMER2_COMP_VECT , TIMER2_OVF_VECT  , TIMER1_CAPT_VECT , TIMER1_COMPA_VECT,
+	TIMER1_COMPB_VECT, TIMER1_OVF_VECT  , TIMER0_COMP_VECT , TIMER0_OVF_VECT ,
+	SPI_STC_VECT     , USART_RXC_VECT   , USART_UDRE_VECT  , USART_TXC_VECT  ,
+	ADC_VECT         , EE_RDY_VECT      , ANA_COMP_VECT    , TWI_VECT        ,
+	SPM_RDY_VECT
+};
+
+/**
+ * @brief The enable bit of every vector (ATmega32 datasheet, interrupt vectors).
+ */
+/**
+ * @brief The vectors of the timers: overflow and compare match of each unit.
+ */
+static const u8 HOST_arrTimerOvf[HOST_TIMERS_COUNT]={ HOST_TIMER0_OVF , HOST_TIMER1_OVF , HOST_TIMER2_OVF };
+static const u8 HOST_arrTimerComp[HOST_TIMERS_COUNT][HOST_TIMER_UNITS]={ { HOST_TIMER0_COMP  , 0 },
+                                                                         { HOST_TIMER1_COMPA , HOST_TIMER1_COMPB },
+                                                                         { HOST_TIMER2_COMP  , 0 } };
+
+static const HOST_Enable_t HOST_arrEnable[HOST_VECTORS_COUNT]={
+	{0,0},
+	{HOST_GICR_ADDRESS,6}  , {HOST_GICR_ADDRESS,7}  , {HOST_GICR_ADDRESS,5}  ,   /*< INT0 INT1 INT2 */
+	{HOST_TIMSK_ADDRESS,7} , {HOST_TIMSK_ADDRESS,6} ,                            /*< OCIE2 TOIE2 */
+	{HOST_TIMSK_ADDRESS,5} , {HOST_TIMSK_ADDRESS,4} , {HOST_TIMSK_ADDRESS,3} ,   /*< TICIE1 OCIE1A OCIE1B */
+	{HOST_TIMSK_ADDRESS,2} , {HOST_TIMSK_ADDRESS,1} , {HOST_TIMSK_ADDRESS,0} ,   /*< TOIE1 OCIE0 TOIE0 */
+	{HOST_SPCR_ADDRESS,7}  ,                                                     /*< SPIE */
+	{HOST_UCSRB_ADDRESS,7} , {HOST_UCSRB_ADDRESS,5} , {HOST_UCSRB_ADDRESS,6} ,   /*< RXCIE UDRIE TXCIE */
+	{HOST_ADCSRA_ADDRESS,3}, {HOST_EECR_ADDRESS,3}  , {HOST_ACSR_ADDRESS,3}  ,   /*< ADIE EERIE ACIE */
+	{HOST_TWCR_ADDRESS,0}  , {HOST_SPMCR_ADDRESS,7}                              /*< TWIE SPMIE */
+};
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns the prescaler of a timer (0: stopped or external clock).
+ */
+static u16 HOST_TimerPrescaler(u8 timer);
+
+/**
+ * @brief Returns the clock of a timer in Hz (0: stopped by the sleep mode).
+ */
+static u32 HOST_TimerClock(u8 timer);
+
+/**
+ * @brief Returns the TOP of a timer (the count after TOP is 0) and whether it is in a CTC mode.
+ *        TIMER1: normal 0xFFFF, 8/9/10-bit 0xFF/0x1FF/0x3FF, OCR1A or ICR1, the phase correct modes count as fast PWM.
+ */
+static u16 HOST_TimerTop(u8 timer, Std_Bool_t *isCtc);
+
+/**
+ * @brief Returns the counter of a timer (TCNTx).
+ */
+static u16 HOST_TimerGetCounter(u8 timer);
+
+/**
+ * @brief Returns the compare value (OCRx) of a compare unit of a timer (unit 1 only exists on TIMER1: OCR1B).
+ */
+static u16 HOST_TimerGetCompare(u8 timer, u8 unit);
+
+/**
+ * @brief One count of a timer: TOP to 0 (overflow outside CTC) or +1, then the compare matches.
+ */
+static void HOST_TimerCount(u8 timer);
+
+/**
+ * @brief Returns the number of counts of a timer until its next event (compare match or TOP to 0), at least 1.
+ */
+static u32 HOST_TimerCountsToEvent(u8 timer);
+
+/**
+ * @brief Advances a timer by (counts) counts, at most up to its next event (countsToEvent).
+ */
+static void HOST_TimerAdvance(u8 timer, u32 counts, u32 countsToEvent);
+
+/**
+ * @brief Raises the low level external interrupts (INT0/INT1 with sense control 00).
+ */
+static void HOST_LevelInterrupts(void);
+
+/**
+ * @brief Services the pending enabled interrupts while the I bit of SREG is set.
+ *
+ * @return STD_TRUE when at least one interrupt was serviced.
+ */
+static Std_Bool_t HOST_ServiceInterrupts(void);
+
+/**
+ * @brief Calls the outputs callback for every watched port whose outputs changed since the last check.
+ *        A register is written after HOST_Io8() returns: the change is seen at the next register access.
+ *
+ * @return STD_TRUE when an output changed.
+ */
+static Std_Bool_t HOST_CheckOutputs(void);
+
+/**
+ * @brief Advances the virtual time from event to event (the next timer event or the end).
+ *
+ * @param cycles The CPU cycles.
+ * @param isStopOnInterrupt STD_TRUE: returns at the first serviced interrupt.
+ * @return STD_TRUE when at least one interrupt was serviced.
+ */
+static Std_Bool_t HOST_Run(u64 cycles, Std_Bool_t isStopOnInterrupt);
+
+#endif /* HOST_PRIVATE_H_ */
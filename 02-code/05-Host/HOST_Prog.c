@@ -0,0 +1,609 @@
+/**
+ * @file HOST_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the host port: the register file, the virtual time,
+ *         the timers and the interrupt dispatcher.
+ *         The virtual time jumps from a timer event (compare match, TOP) to the next one: the counts in between
+ *         are added at once, a firmware second costs about one step per tick instead of one per count.
+ *         Nothing is compiled without HOST_BUILD.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see HOST_Interface.h
+ * @see HOST_Lcfg.h
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#if defined(HOST_BUILD)
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_BitMath.h"
+#include "Utils_interrupt.h"
+
+// MCAL
+#include "MCU_config.h"
+
+// own module files
+#include "HOST_Interface.h"
+#include "HOST_Lcfg.h"
+#include "HOST_Private.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns the prescaler of a timer (0: stopped or external clock).
+ */
+static u16 HOST_TimerPrescaler(u8 timer)
+{
+	static const u16 prescalers01[8]={ 0 , 1 , 8 , 64 , 256 , 1024 , 0 , 0 }; /*< 6,7: external clock on T0/T1 */
+	static const u16 prescalers2[8]= { 0 , 1 , 8 , 32 , 64  , 128  , 256 , 1024 };
+	u16 prescaler;
+
+	switch (timer)
+	{
+		case 0:  prescaler=prescalers01[TCCR0&HOST_TCCRx_CS_MASK];  break;
+		case 1:  prescaler=prescalers01[TCCR1B&HOST_TCCRx_CS_MASK]; break;
+		default: prescaler=prescalers2[TCCR2&HOST_TCCRx_CS_MASK];   break;
+	}
+	return prescaler;
+}
+
+/**
+ * @brief Returns the clock of a timer in Hz (0: stopped by the sleep mode).
+ */
+static u32 HOST_TimerClock(u8 timer)
+{
+	u32 clock=F_CPU;
+
+	if ((timer==2) && (get_bit(ASSR,HOST_ASSR_AS2)==1))
+	{
+		clock=HOST_TIMER2_CRYSTAL_HZ; /*< asynchronous: runs in Power-save */
+	}
+	else if (HOST_IsClkIoStopped==STD_TRUE)
+	{
+		clock=0;
+	}
+	return clock;
+}
+
+/**
+ * @brief Returns the TOP of a timer and whether it is in a CTC mode.
+ */
+static u16 HOST_TimerTop(u8 timer, Std_Bool_t *isCtc)
+{
+	static const u16 fixedTop[4]={ 0xFFFF , 0x00FF , 0x01FF , 0x03FF }; /*< WGM11:10 of the TIMER1 8/9/10-bit modes */
+	u8 tccr;
+	u8 wgm;
+	u16 top;
+
+	if (timer==1)
+	{
+		wgm=(u8)(((TCCR1B>>HOST_TCCR1B_WGM12)&0x03)<<2) | (TCCR1A&0x03);
+		*isCtc=((wgm==4) || (wgm==12))? STD_TRUE : STD_FALSE;
+		switch (wgm)
+		{
+			case 4: case 9: case 11: case 15:  top=OCR1A;              break;
+			case 8: case 10: case 12: case 14: top=ICR1;               break;
+			default:                           top=fixedTop[wgm&0x03]; break;
+		}
+	}
+	else
+	{
+		tccr=(timer==0)? TCCR0 : TCCR2;
+		*isCtc=((get_bit(tccr,HOST_TCCRx_WGMx1)==1) && (get_bit(tccr,HOST_TCCRx_WGMx0)==0))? STD_TRUE : STD_FALSE;
+		top=(*isCtc==STD_TRUE)? HOST_TimerGetCompare(timer,0) : 0xFF;
+	}
+	return top;
+}
+
+/**
+ * @brief Returns the counter of a timer (TCNTx).
+ */
+static u16 HOST_TimerGetCounter(u8 timer)
+{
+	u16 counter;
+
+	switch (timer)
+	{
+		case 0:  counter=TCNT0; break;
+		case 1:  counter=TCNT1; break;
+		default: counter=TCNT2; break;
+	}
+	return counter;
+}
+
+/**
+ * @brief Returns the compare value (OCRx) of a compare unit of a timer.
+ */
+static u16 HOST_TimerGetCompare(u8 timer, u8 unit)
+{
+	u16 compare;
+
+	switch (timer)
+	{
+		case 0:  compare=OCR0;                        break;
+		case 1:  compare=(unit==0)? OCR1A : OCR1B;    break;
+		default: compare=OCR2;                        break;
+	}
+	return compare;
+}
+
+/**
+ * @brief One count of a timer: TOP to 0 (overflow outside CTC) or +1, then the compare matches.
+ */
+static void HOST_TimerCount(u8 timer)
+{
+	Std_Bool_t isCtc;
+	u16 top=HOST_TimerTop(timer,&isCtc);
+	u16 counter=HOST_TimerGetCounter(timer);
+	u8 unit;
+
+	if (counter>=top)
+	{
+		counter=0;
+		if (isCtc==STD_FALSE)
+		{
+			HOST_RaiseInterrupt((HOST_Vector_t)HOST_arrTimerOvf[timer]);
+		}
+	}
+	else
+	{
+		counter++;
+	}
+	switch (timer)
+	{
+		case 0:  TCNT0=(u8)counter; break;
+		case 1:  TCNT1=counter;     break;
+		default: TCNT2=(u8)counter; break;
+	}
+	for (unit=0; (unit<HOST_TIMER_UNITS) && (HOST_arrTimerComp[timer][unit]!=0); unit++)
+	{
+		if (counter==HOST_TimerGetCompare(timer,unit))
+		{
+			HOST_RaiseInterrupt((HOST_Vector_t)HOST_arrTimerComp[timer][unit]);
+		}
+	}
+}
+
+/**
+ * @brief Returns the number of counts of a timer until its next event (compare match or TOP to 0), at least 1.
+ */
+static u32 HOST_TimerCountsToEvent(u8 timer)
+{
+	Std_Bool_t isCtc;
+	u16 top=HOST_TimerTop(timer,&isCtc);
+	u16 counter=HOST_TimerGetCounter(timer);
+	u16 compare;
+	u32 toWrap=(counter>=top)? 1 : ((u32)top-counter+1);
+	u32 toEvent=toWrap;
+	u32 toCompare;
+	u8 unit;
+
+	for (unit=0; (unit<HOST_TIMER_UNITS) && (HOST_arrTimerComp[timer][unit]!=0); unit++)
+	{
+		compare=HOST_TimerGetCompare(timer,unit);
+		toCompare=(compare>counter)? ((u32)compare-counter) : (toWrap+compare); /*< after TOP the counter restarts at 0 */
+		if (toCompare<toEvent)
+		{
+			toEvent=toCompare;
+		}
+	}
+	return toEvent;
+}
+
+/**
+ * @brief Advances a timer by (counts) counts, at most up to its next event (countsToEvent).
+ */
+static void HOST_TimerAdvance(u8 timer, u32 counts, u32 countsToEvent)
+{
+	u32 plain=(counts>=countsToEvent)? (countsToEvent-1) : counts; /*< the counts before the event: no match, no wrap */
+
+	switch (timer)
+	{
+		case 0:  TCNT0=(u8)(TCNT0+plain);   break;
+		case 1:  TCNT1=(u16)(TCNT1+plain);  break;
+		default: TCNT2=(u8)(TCNT2+plain);   break;
+	}
+	if (counts>=countsToEvent)
+	{
+		HOST_TimerCount(timer);
+	}
+}
+
+/**
+ * @brief Raises the low level external interrupts (INT0/INT1 with sense control 00).
+ */
+static void HOST_LevelInterrupts(void)
+{
+	u8 pins=HOST_GetPins(HOST_PORTD);
+
+	if ((((MCUCR>>HOST_MCUCR_ISC00)&0x03)==0) && (get_bit(pins,HOST_INT0_PIN)==0))
+	{
+		HOST_RaiseInterrupt(HOST_INT0);
+	}
+	if ((((MCUCR>>HOST_MCUCR_ISC10)&0x03)==0) && (get_bit(pins,HOST_INT1_PIN)==0))
+	{
+		HOST_RaiseInterrupt(HOST_INT1);
+	}
+}
+
+/**
+ * @brief Services the pending enabled interrupts while the I bit of SREG is set.
+ */
+static Std_Bool_t HOST_ServiceInterrupts(void)
+{
+	Std_Bool_t isServiced=STD_FALSE;
+	u8 vector=1;
+
+	while ((get_bit(SREG,HOST_SREG_I)==1) && (vector<HOST_VECTORS_COUNT))
+	{
+		if ((get_bit(HOST_u32Pending,vector)==1) &&
+		    ((HOST_arrEnable[vector].address==0) || (get_bit(HOST_au8IoFile[HOST_arrEnable[vector].address],HOST_arrEnable[vector].bit)==1)))
+		{
+			HOST_u32Pending&=~(1UL<<vector);  /*< the flag is cleared when the vector is executed */
+			clear_bit(SREG,HOST_SREG_I);
+			if (HOST_arrVectors[vector]!=NULL_PTR)
+			{
+				HOST_arrVectors[vector]();
+			}
+			set_bit(SREG,HOST_SREG_I);         /*< reti */
+			isServiced=STD_TRUE;
+			vector=1;                          /*< the highest priority first again */
+		}
+		else
+		{
+			vector++;
+		}
+	}
+	return isServiced;
+}
+
+/**
+ * @brief Calls the outputs callback for every port whose outputs changed since the last check.
+ */
+static Std_Bool_t HOST_CheckOutputs(void)
+{
+	Std_Bool_t isChanged=STD_FALSE;
+	u8 i;
+	u8 port;
+	u8 outputs;
+
+	for (i=0; i<HOST_u8OutputsCount; i++)
+	{
+		port=HOST_au8OutputsPorts[i];
+		outputs=(u8)(HOST_au8IoFile[HOST_PORT_ADDRESS(port)]&HOST_au8IoFile[HOST_DDR_ADDRESS(port)]);
+		if (outputs!=HOST_au8OutputsShadow[port])
+		{
+			HOST_au8OutputsShadow[port]=outputs;
+			HOST_Outputs_Fptr(port);
+			isChanged=STD_TRUE;
+		}
+	}
+	return isChanged;
+}
+
+/**
+ * @brief Advances the virtual time from event to event (the next timer event or the end).
+ */
+static Std_Bool_t HOST_Run(u64 cycles, Std_Bool_t isStopOnInterrupt)
+{
+	Std_Bool_t isServiced=STD_FALSE;
+	u64 threshold[HOST_TIMERS_COUNT];
+	u32 clock[HOST_TIMERS_COUNT];
+	u32 toEvent[HOST_TIMERS_COUNT];
+	u64 step;
+	u64 next;
+	u8 timer;
+
+	if (HOST_IsOutputsArmed==STD_TRUE)
+	{
+		HOST_CheckOutputs(); /*< the last write before the delay/sleep happened at the current time */
+		HOST_IsOutputsArmed=STD_FALSE;
+	}
+	while ((cycles>0) && ((isServiced==STD_FALSE) || (isStopOnInterrupt==STD_FALSE)))
+	{
+		/* a timer counts when its rest reaches prescaler*F_CPU, the step ends at the first timer event */
+		step=cycles;
+		for (timer=0; timer<HOST_TIMERS_COUNT; timer++)
+		{
+			clock[timer]=HOST_TimerClock(timer);
+			threshold[timer]=(u64)HOST_TimerPrescaler(timer)*F_CPU;
+			if ((clock[timer]!=0) && (threshold[timer]!=0))
+			{
+				toEvent[timer]=HOST_TimerCountsToEvent(timer);
+				next=((toEvent[timer]*threshold[timer])-HOST_au64TimerRest[timer]+clock[timer]-1)/clock[timer];
+				if (next<step)
+				{
+					step=next;
+				}
+			}
+		}
+		if (step==0)
+		{
+			step=1;
+		}
+
+		HOST_u64Cycles+=step;
+		cycles-=step;
+		for (timer=0; timer<HOST_TIMERS_COUNT; timer++)
+		{
+			if ((clock[timer]!=0) && (threshold[timer]!=0))
+			{
+				HOST_au64TimerRest[timer]+=step*clock[timer];
+				HOST_TimerAdvance(timer,(u32)(HOST_au64TimerRest[timer]/threshold[timer]),toEvent[timer]);
+				HOST_au64TimerRest[timer]%=threshold[timer];
+			}
+		}
+
+		HOST_LevelInterrupts();
+		if (HOST_Step_Fptr!=NULL_PTR)
+		{
+			HOST_Step_Fptr();
+		}
+		if (HOST_ServiceInterrupts()==STD_TRUE)
+		{
+			isServiced=STD_TRUE;
+		}
+	}
+	return isServiced;
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Clears the register file, the virtual time, the pending interrupts and the pin levels.
+ */
+void HOST_Init(void)
+{
+	u8 i;
+
+	for (i=0; i<HOST_IO_SIZE; i++)
+	{
+		HOST_au8IoFile[i]=0;
+	}
+	for (i=0; i<HOST_PORTS_COUNT; i++)
+	{
+		HOST_au8PinsLevel[i]=HOST_PINS_DEFAULT;
+		HOST_au8OutputsShadow[i]=0;
+	}
+	for (i=0; i<HOST_TIMERS_COUNT; i++)
+	{
+		HOST_au64TimerRest[i]=0;
+	}
+	HOST_u32Pending=0;
+	HOST_u64Cycles=0;
+	HOST_IsClkIoStopped=STD_FALSE;
+	HOST_IsOutputsArmed=STD_FALSE;
+}
+
+/**
+ * @brief Returns the simulated register at a data space address (used by MemMap.h).
+ */
+volatile u8 *HOST_Io8(u8 address)
+{
+	u8 port;
+
+	/* a PORTx/DDRx write happens after HOST_Io8() returned its address: the next accesses check the outputs */
+	if ((HOST_IsOutputsArmed==STD_TRUE) && (HOST_CheckOutputs()==STD_TRUE))
+	{
+		HOST_IsOutputsArmed=STD_FALSE;
+	}
+	/* PORTA 0x3B, DDRA 0x3A, PINA 0x39 ... PIND 0x30: the other registers are returned directly (the hot path) */
+	if ((address>=HOST_PIN_ADDRESS(HOST_PORTD)) && (address<=HOST_PORT_ADDRESS(HOST_PORTA)))
+	{
+		port=(u8)((HOST_PORT_ADDRESS(HOST_PORTA)-address)/3);
+		if (address==HOST_PIN_ADDRESS(port))
+		{
+			if (HOST_Pins_Fptr!=NULL_PTR)
+			{
+				HOST_Pins_Fptr(port);
+			}
+			HOST_au8IoFile[address]=HOST_GetPins((HOST_Port_t)port);
+		}
+		else if (HOST_u8OutputsCount>0)
+		{
+			HOST_IsOutputsArmed=STD_TRUE;
+		}
+		else
+		{
+			//no outputs callback
+		}
+	}
+	return &HOST_au8IoFile[address%HOST_IO_SIZE];
+}
+
+/**
+ * @brief Sets the I bit of SREG and services the pending interrupts (sei()).
+ */
+void HOST_Sei(void)
+{
+	set_bit(SREG,HOST_SREG_I);
+	HOST_ServiceInterrupts();
+}
+
+/**
+ * @brief Clears the I bit of SREG (cli()).
+ */
+void HOST_Cli(void)
+{
+	clear_bit(SREG,HOST_SREG_I);
+}
+
+/**
+ * @brief The sleep instruction: enables the interrupts then advances the virtual time until an interrupt is serviced.
+ */
+void HOST_Sleep(void)
+{
+	u8 mode=(MCUCR>>HOST_MCUCR_SM0)&0x07;
+
+	set_bit(SREG,HOST_SREG_I);
+	HOST_IsClkIoStopped=(mode>1)? STD_TRUE : STD_FALSE; /*< 0: Idle, 1: ADC noise reduction */
+	while (HOST_Run(HOST_SLEEP_STEP_CYCLES,STD_TRUE)==STD_FALSE)
+	{
+		//no wake-up yet
+	}
+	HOST_IsClkIoStopped=STD_FALSE;
+}
+
+/**
+ * @brief Advances the virtual time by (us) microseconds (_delay_us()/_delay_ms()).
+ */
+void HOST_Delay_us(u32 us)
+{
+	HOST_Run(((u64)us*F_CPU)/1000000UL,STD_FALSE);
+}
+
+/**
+ * @brief Advances the virtual time by (cycles) CPU cycles.
+ */
+void HOST_Advance(u32 cycles)
+{
+	HOST_Run(cycles,STD_FALSE);
+}
+
+/**
+ * @brief Returns the virtual time in CPU cycles since HOST_Init().
+ */
+u64 HOST_GetCycles(void)
+{
+	return HOST_u64Cycles;
+}
+
+/**
+ * @brief Sets the external levels of the pins of a port.
+ */
+void HOST_SetPins(HOST_Port_t port, u8 levels)
+{
+	u8 before;
+	u8 after;
+	u8 sense;
+
+	if (port<HOST_PORTS_COUNT)
+	{
+		before=HOST_GetPins(port);
+		HOST_au8PinsLevel[port]=levels;
+		after=HOST_GetPins(port);
+		if (port==HOST_PORTD)
+		{
+			/* sense control: 01 any change, 10 falling, 11 rising (00 low level: HOST_LevelInterrupts()) */
+			sense=(MCUCR>>HOST_MCUCR_ISC00)&0x03;
+			if ((get_bit((before^after),HOST_INT0_PIN)==1) &&
+			    ((sense==1) || ((sense==2) && (get_bit(after,HOST_INT0_PIN)==0)) || ((sense==3) && (get_bit(after,HOST_INT0_PIN)==1))))
+			{
+				HOST_RaiseInterrupt(HOST_INT0);
+			}
+			sense=(MCUCR>>HOST_MCUCR_ISC10)&0x03;
+			if ((get_bit((before^after),HOST_INT1_PIN)==1) &&
+			    ((sense==1) || ((sense==2) && (get_bit(after,HOST_INT1_PIN)==0)) || ((sense==3) && (get_bit(after,HOST_INT1_PIN)==1))))
+			{
+				HOST_RaiseInterrupt(HOST_INT1);
+			}
+		}
+		else if (port==HOST_PORTB)
+		{
+			/* sense control: 0 falling, 1 rising */
+			sense=get_bit(MCUCSR,HOST_MCUCSR_ISC2);
+			if ((get_bit((before^after),HOST_INT2_PIN)==1) && (get_bit(after,HOST_INT2_PIN)==sense))
+			{
+				HOST_RaiseInterrupt(HOST_INT2);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Returns the levels of the pins of a port: PORTx for the outputs, the external levels for the inputs.
+ */
+u8 HOST_GetPins(HOST_Port_t port)
+{
+	u8 ddr=HOST_au8IoFile[HOST_DDR_ADDRESS(port)];
+
+	return (u8)((HOST_au8IoFile[HOST_PORT_ADDRESS(port)]&ddr) | (HOST_au8PinsLevel[port]&(u8)~ddr));
+}
+
+/**
+ * @brief Returns the levels driven by the outputs of a port (PORTx & DDRx), the inputs read 0.
+ */
+u8 HOST_GetOutputs(HOST_Port_t port)
+{
+	return (u8)(HOST_au8IoFile[HOST_PORT_ADDRESS(port)]&HOST_au8IoFile[HOST_DDR_ADDRESS(port)]);
+}
+
+/**
+ * @brief Returns the value of a register without the side effects of an access.
+ */
+u8 HOST_PeekIo(u8 address)
+{
+	return HOST_au8IoFile[address%HOST_IO_SIZE];
+}
+
+/**
+ * @brief Raises an interrupt (injection), it stays pending until it is serviced.
+ */
+void HOST_RaiseInterrupt(HOST_Vector_t vector)
+{
+	if ((vector>0) && (vector<HOST_VECTORS_COUNT))
+	{
+		HOST_u32Pending|=(1UL<<vector);
+	}
+}
+
+/**
+ * @brief An input capture event of TIMER1: ICR1 takes TCNT1 and TIMER1_CAPT is raised.
+ */
+void HOST_Timer1Capture(void)
+{
+	ICR1=TCNT1;
+	HOST_RaiseInterrupt(HOST_TIMER1_CAPT);
+}
+
+/**
+ * @brief Sets the function called after every step of the virtual time.
+ */
+void HOST_SetStepCallBack(Ptr_VoidFuncVoid_t LocalPtr)
+{
+	HOST_Step_Fptr=LocalPtr;
+}
+
+/**
+ * @brief Sets the function called before a PINx register is read.
+ */
+void HOST_SetPinsCallBack(Ptr_VoidFuncU8_t LocalPtr)
+{
+	HOST_Pins_Fptr=LocalPtr;
+}
+
+/**
+ * @brief Sets the function called when the outputs of a port change.
+ */
+void HOST_SetOutputsCallBack(Ptr_VoidFuncU8_t LocalPtr, u8 portsMask)
+{
+	u8 port;
+
+	HOST_u8OutputsCount=0;
+	HOST_IsOutputsArmed=STD_FALSE;
+	for (port=0; port<HOST_PORTS_COUNT; port++)
+	{
+		HOST_au8OutputsShadow[port]=HOST_GetOutputs((HOST_Port_t)port);
+		if ((get_bit(portsMask,port)==1) && (LocalPtr!=NULL_PTR))
+		{
+			HOST_au8OutputsPorts[HOST_u8OutputsCount]=port;
+			HOST_u8OutputsCount++;
+		}
+	}
+	HOST_Outputs_Fptr=LocalPtr;
+}
+
+#endif /* HOST_BUILD */
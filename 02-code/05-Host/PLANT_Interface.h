@@ -0,0 +1,146 @@
+/**
+ * @file PLANT_Interface.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the interfacing information of the oven plant simulator (host build only).
+ *         The plant runs the firmware on the host port (HOST_Interface.h) and replays a scenario on the virtual time:
+ *         - the door switch, the weight sensor, the START/STOP buttons and the keypad matrix are driven by the script
+ *         - the turntable encoder pulses (TIMER1 input capture) follow the motor output, it can be jammed
+ *         - the heater, lamp and motor outputs are recorded (time of every change) and compared to an expected trace
+ *         - the display is the HD44780 model (HD44780_Interface.h): its frames can be checked after the run
+ *
+ *         The virtual time jumps from a timer event to the next one, a long cook (e.g. 99:59) runs in a few seconds
+ *         (about 1000 times the real time at -O2), the same script always gives the same trace.
+ *
+ * @note The firmware globals are not re-initialized: one PLANT_Run() per process.
+ *
+ * @par Example (scenario.c, built as the harness of the host port):
+ *   @code
+ *    static const PLANT_Event_t script[]={ { 0    , PLANT_FOOD , 1   } ,      // food on the plate, door closed
+ *                                          { 500  , PLANT_KEY  , '1' } ,      // 00:01
+ *                                          { 800  , PLANT_KEY  , '0' } ,      // 00:10
+ *                                          { 1200 , PLANT_START, 0   } };
+ *    static const PLANT_Trace_t expected[]={ { 1330  , PLANT_HEATER|PLANT_LAMP|PLANT_MOTOR } ,
+ *                                            { 11330 , 0 } };
+ *    int main(void)
+ *    {
+ *        u8 mismatch;
+ *        PLANT_Run(script,4,15000,FIRMWARE_main);
+ *        return (PLANT_CompareTrace(expected,2,20,&mismatch)==STD_OK)? 0 : 1;
+ *    }
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef PLANT_INTERFACE_H_
+#define PLANT_INTERFACE_H_
+
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The outputs in a trace record (bit mask).
+ */
+#define PLANT_HEATER              0x01
+#define PLANT_LAMP                0x02
+#define PLANT_MOTOR               0x04
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief The actions of a scenario.
+ */
+typedef enum
+{
+	PLANT_DOOR,     /*< value: 1 opened , 0 closed */
+	PLANT_FOOD,     /*< value: 1 food on the plate , 0 empty */
+	PLANT_START,    /*< presses the START button for PLANT_PRESS_MS */
+	PLANT_STOP,     /*< presses the STOP button for PLANT_PRESS_MS */
+	PLANT_KEY,      /*< value: the character of the key (keypad_charArray), pressed for PLANT_PRESS_MS */
+	PLANT_JAM       /*< value: 1 the turntable is jammed (no encoder pulse) , 0 free */
+}PLANT_Action_t;
+
+/**
+ * @brief An event of a scenario, the events are sorted by time.
+ */
+typedef struct
+{
+	u32 timeMs;             /*< the virtual time of the event since the reset */
+	PLANT_Action_t action;
+	u8 value;
+}PLANT_Event_t;
+
+/**
+ * @brief A change of the outputs.
+ */
+typedef struct
+{
+	u32 timeMs;             /*< the virtual time of the change since the reset */
+	u8 outputs;             /*< PLANT_HEATER | PLANT_LAMP | PLANT_MOTOR after the change */
+}PLANT_Trace_t;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Runs the firmware for (durationMs) of virtual time while the scenario is replayed, then returns.
+ *        The door is closed, the plate is empty and nothing is pressed at the reset.
+ *
+ * @param script The scenario, sorted by time.
+ * @param count The number of events of the scenario.
+ * @param durationMs The virtual duration of the run.
+ * @param firmwareMain The main() of the firmware (main.c built with -Dmain=FIRMWARE_main), it never returns.
+ * @return STD_OK , STD_NULL_POINTER or STD_INVALID_ARG (the events are not sorted by time).
+ */
+Std_Error_t PLANT_Run(const PLANT_Event_t script[], u8 count, u32 durationMs, Ptr_VoidFuncVoid_t firmwareMain);
+
+/**
+ * @brief Returns the recorded output changes of the last run.
+ *
+ * @param trace Pointer to receive the address of the records.
+ * @return The number of records (PLANT_TRACE_SIZE at most).
+ */
+u8 PLANT_GetTrace(const PLANT_Trace_t **trace);
+
+/**
+ * @brief Compares the recorded output changes to the expected ones.
+ *
+ * @param expected The expected changes, sorted by time.
+ * @param count The number of expected changes.
+ * @param toleranceMs The allowed difference of the time of a change.
+ * @param mismatch Pointer to receive the index of the first different record (count when the numbers differ).
+ * @return STD_OK (same changes) , STD_NOK , STD_NULL_POINTER or STD_BUFFER_OVERFLOW (the trace is full).
+ */
+Std_Error_t PLANT_CompareTrace(const PLANT_Trace_t expected[], u8 count, u32 toleranceMs, u8 *mismatch);
+
+/**
+ * @brief Applies an action now (at the current virtual time), like an event of the scenario.
+ *        Used from the step callback (PLANT_SetStepCallBack()) by the generated scenarios (FUZZ_Interface.h).
+ *
+ * @param action The action.
+ * @param value The value of the action (PLANT_Action_t).
+ * @return STD_OK or STD_INVALID_ARG.
+ */
+Std_Error_t PLANT_Act(PLANT_Action_t action, u8 value);
+
+/**
+ * @brief Sets the function called at the start of every step of the plant (before the events of the scenario),
+ *        NULL_PTR to remove it.
+ *
+ * @param LocalPtr Pointer to the callback function.
+ */
+void PLANT_SetStepCallBack(Ptr_VoidFuncVoid_t LocalPtr);
+
+#endif /* PLANT_INTERFACE_H_ */
@@ -0,0 +1,49 @@
+/**
+ * @file PLANT_Lcfg.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the configurations of the oven plant simulator (host build only).
+ *         - the pins of the oven (the same as main.c)
+ *         - the press duration of the buttons and the keys
+ *         - the turntable speed
+ *         - the size of the output trace
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef PLANT_LCFG_H_
+#define PLANT_LCFG_H_
+
+/**
+ * @brief The pins of the oven (DIO_PIN_t), they must follow main.c.
+ *
+ * inputs : the buttons (active low), the weight sensor (low: food), the door sensor (high: opened)
+ * outputs: the heater, the lamp and the motor (high: ON)
+ */
+#define PLANT_START_PIN           PA0
+#define PLANT_STOP_PIN            PA1
+#define PLANT_WEIGHT_PIN          PA3
+#define PLANT_DOOR_PIN            PB2
+#define PLANT_HEATER_PIN          PC0
+#define PLANT_LAMP_PIN            PC1
+#define PLANT_MOTOR_PIN           PC2
+
+/**
+ * @brief How long a button or a key is held (ms): longer than the period of task_keypad() (TASK_KEYPAD_PERIOD)
+ *        so the key is scanned, the button event is generated at the release.
+ */
+#define PLANT_PRESS_MS            120
+
+/**
+ * @brief The speed of the turntable while the motor is ON and not jammed (rpm x10),
+ *        the encoder gives TURNTABLE_PULSES_PER_REV input captures per revolution.
+ */
+#define PLANT_TURNTABLE_RPM_X10   60
+
+/**
+ * @brief The number of output changes kept in the trace (the later changes are counted, not kept).
+ */
+#define PLANT_TRACE_SIZE          32
+
+#endif /* PLANT_LCFG_H_ */
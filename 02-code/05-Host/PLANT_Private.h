@@ -0,0 +1,94 @@
+/**
+ * @file PLANT_Private.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the private macros, functions and static global variables of the oven plant simulator.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef PLANT_PRIVATE_H_
+#define PLANT_PRIVATE_H_
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*              DO NOT CHANGE ANYTHING BELOW THIS COMMENT                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* the port and the bit of a DIO_PIN_t (PA0..PD7) */
+#define PLANT_PORT(pin)           ((HOST_Port_t)((pin)/8))
+#define PLANT_BIT(pin)            ((pin)%8)
+
+#define PLANT_CYCLES_PER_MS       (F_CPU/1000UL)
+
+/* the CPU cycles between two encoder pulses */
+#define PLANT_PULSE_CYCLES        ((u64)F_CPU*600UL/((u32)PLANT_TURNTABLE_RPM_X10*TURNTABLE_PULSES_PER_REV))
+
+#define PLANT_NO_KEY              '\0'
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Sets the external level of a pin (HOST_SetPins() of its port when it changes).
+ */
+static void PLANT_SetPin(u8 pin, u8 level);
+
+/**
+ * @brief Returns whether a pin is an output driven high (DDRx and PORTx set).
+ */
+static Std_Bool_t PLANT_IsOutputHigh(u8 pin);
+
+/**
+ * @brief Applies an event of the scenario at the current virtual time.
+ */
+static void PLANT_Apply(const PLANT_Event_t *event, u32 nowMs);
+
+/**
+ * @brief The step callback of the host port: the step callback of the plant, the scenario, the releases, the encoder, the trace and the end of the run.
+ */
+static void PLANT_Step(void);
+
+/**
+ * @brief The pins callback of the host port: the keypad matrix, a column is low while the pressed key's row is low.
+ */
+static void PLANT_Pins(u8 port);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static jmp_buf PLANT_End;
+
+static const PLANT_Event_t *PLANT_pScript=NULL_PTR;
+static u8 PLANT_u8Count=0;
+static u8 PLANT_u8Next=0;              /*< the next event of the scenario */
+static u32 PLANT_u32DurationMs=0;
+
+static u8 PLANT_au8Levels[HOST_PORTS_COUNT];
+static u32 PLANT_u32StartReleaseMs=0;  /*< 0: not pressed */
+static u32 PLANT_u32StopReleaseMs=0;
+static u32 PLANT_u32KeyReleaseMs=0;
+static u8 PLANT_u8Key=PLANT_NO_KEY;
+
+static Std_Bool_t PLANT_IsJammed=STD_FALSE;
+static u64 PLANT_u64NextPulse=0;       /*< the virtual time (cycles) of the next encoder pulse */
+
+static Ptr_VoidFuncVoid_t PLANT_Step_Fptr=NULL_PTR;
+
+static PLANT_Trace_t PLANT_arrTrace[PLANT_TRACE_SIZE];
+static u8 PLANT_u8TraceCount=0;
+static u16 PLANT_u16TraceLost=0;       /*< the changes not kept (the trace is full) */
+static u8 PLANT_u8Outputs=0;
+
+#endif /* PLANT_PRIVATE_H_ */
@@ -0,0 +1,373 @@
+/**
+ * @file PLANT_Prog.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the implementation of the oven plant simulator: the inputs of the oven follow the
+ *         scenario on the virtual time of the host port, the outputs are recorded.
+ *         Nothing is compiled out of the host build.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @see PLANT_Interface.h
+ * @see PLANT_Lcfg.h
+ * @copyright Copyright (c) 2026
+ *
+ */
+#if defined(HOST_BUILD)
+
+#include <setjmp.h>
+
+// lib
+#include "Std_Types.h"
+#include "Utils_BitMath.h"
+
+// MCAL
+#include "MCU_config.h"
+#include "DIO_Interface.h"
+
+// HAL
+#include "Keypad_Lcfg.h"
+#include "Keypad_private.h"
+#include "Turntable_Lcfg.h"
+
+// host port
+#include "HOST_Interface.h"
+#include "HD44780_Lcfg.h"
+#include "HD44780_Interface.h"
+
+// own module files
+#include "PLANT_Interface.h"
+#include "PLANT_Lcfg.h"
+#include "PLANT_Private.h"
+
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Sets the external level of a pin (HOST_SetPins() of its port when it changes).
+ */
+static void PLANT_SetPin(u8 pin, u8 level)
+{
+	u8 levels=PLANT_au8Levels[PLANT_PORT(pin)];
+
+	if (level==0)
+	{
+		clear_bit(levels,PLANT_BIT(pin));
+	}
+	else
+	{
+		set_bit(levels,PLANT_BIT(pin));
+	}
+	if (levels!=PLANT_au8Levels[PLANT_PORT(pin)])
+	{
+		PLANT_au8Levels[PLANT_PORT(pin)]=levels;
+		HOST_SetPins(PLANT_PORT(pin),levels);
+	}
+}
+
+/**
+ * @brief Returns whether a pin is an output driven high (DDRx and PORTx set).
+ */
+static Std_Bool_t PLANT_IsOutputHigh(u8 pin)
+{
+	return (get_bit(HOST_GetOutputs(PLANT_PORT(pin)),PLANT_BIT(pin))==1)? STD_TRUE : STD_FALSE;
+}
+
+/**
+ * @brief Applies an event of the scenario at the current virtual time.
+ */
+static void PLANT_Apply(const PLANT_Event_t *event, u32 nowMs)
+{
+	switch (event->action)
+	{
+		case PLANT_DOOR:
+			PLANT_SetPin(PLANT_DOOR_PIN,(event->value!=0)? 1 : 0);
+		break;
+
+		case PLANT_FOOD:
+			PLANT_SetPin(PLANT_WEIGHT_PIN,(event->value!=0)? 0 : 1);
+		break;
+
+		case PLANT_START:
+			PLANT_SetPin(PLANT_START_PIN,0);
+			PLANT_u32StartReleaseMs=nowMs+PLANT_PRESS_MS;
+		break;
+
+		case PLANT_STOP:
+			PLANT_SetPin(PLANT_STOP_PIN,0);
+			PLANT_u32StopReleaseMs=nowMs+PLANT_PRESS_MS;
+		break;
+
+		case PLANT_KEY:
+			PLANT_u8Key=event->value;
+			PLANT_u32KeyReleaseMs=nowMs+PLANT_PRESS_MS;
+		break;
+
+		case PLANT_JAM:
+			PLANT_IsJammed=(event->value!=0)? STD_TRUE : STD_FALSE;
+		break;
+
+		default:
+			//do nothing
+		break;
+	}
+}
+
+/**
+ * @brief The step callback of the host port: the step callback of the plant, the scenario, the releases, the encoder, the trace and the end of the run.
+ */
+static void PLANT_Step(void)
+{
+	u64 cycles=HOST_GetCycles();
+	u32 nowMs=(u32)(cycles/PLANT_CYCLES_PER_MS);
+	u8 outputs=0;
+
+	if (PLANT_Step_Fptr!=NULL_PTR)
+	{
+		PLANT_Step_Fptr();
+	}
+	while ((PLANT_u8Next<PLANT_u8Count) && (PLANT_pScript[PLANT_u8Next].timeMs<=nowMs))
+	{
+		PLANT_Apply(&PLANT_pScript[PLANT_u8Next],nowMs);
+		PLANT_u8Next++;
+	}
+
+	/* the releases */
+	if ((PLANT_u32StartReleaseMs!=0) && (nowMs>=PLANT_u32StartReleaseMs))
+	{
+		PLANT_u32StartReleaseMs=0;
+		PLANT_SetPin(PLANT_START_PIN,1);
+	}
+	if ((PLANT_u32StopReleaseMs!=0) && (nowMs>=PLANT_u32StopReleaseMs))
+	{
+		PLANT_u32StopReleaseMs=0;
+		PLANT_SetPin(PLANT_STOP_PIN,1);
+	}
+	if ((PLANT_u8Key!=PLANT_NO_KEY) && (nowMs>=PLANT_u32KeyReleaseMs))
+	{
+		PLANT_u8Key=PLANT_NO_KEY;
+	}
+
+	/* the outputs */
+	if (PLANT_IsOutputHigh(PLANT_HEATER_PIN)==STD_TRUE)
+	{
+		outputs|=PLANT_HEATER;
+	}
+	if (PLANT_IsOutputHigh(PLANT_LAMP_PIN)==STD_TRUE)
+	{
+		outputs|=PLANT_LAMP;
+	}
+	if (PLANT_IsOutputHigh(PLANT_MOTOR_PIN)==STD_TRUE)
+	{
+		outputs|=PLANT_MOTOR;
+	}
+	if (outputs!=PLANT_u8Outputs)
+	{
+		PLANT_u8Outputs=outputs;
+		if (PLANT_u8TraceCount<PLANT_TRACE_SIZE)
+		{
+			PLANT_arrTrace[PLANT_u8TraceCount].timeMs=nowMs;
+			PLANT_arrTrace[PLANT_u8TraceCount].outputs=outputs;
+			PLANT_u8TraceCount++;
+		}
+		else
+		{
+			PLANT_u16TraceLost++;
+		}
+	}
+
+	/* the turntable encoder: a pulse every PLANT_PULSE_CYCLES while the motor turns */
+	if (((outputs&PLANT_MOTOR)==0) || (PLANT_IsJammed==STD_TRUE))
+	{
+		PLANT_u64NextPulse=cycles+PLANT_PULSE_CYCLES;
+	}
+	else if (cycles>=PLANT_u64NextPulse)
+	{
+		PLANT_u64NextPulse+=PLANT_PULSE_CYCLES;
+		HOST_Timer1Capture();
+	}
+
+	if (nowMs>=PLANT_u32DurationMs)
+	{
+		longjmp(PLANT_End,1);
+	}
+}
+
+/**
+ * @brief The pins callback of the host port: the keypad matrix, a column is low while the pressed key's row is low.
+ */
+static void PLANT_Pins(u8 port)
+{
+	u8 row;
+	u8 col;
+	u8 pin;
+
+	for (col=0; col<COLS; col++)
+	{
+		pin=keypad_pinMap.kEYPAD_cols[col];
+		if (PLANT_PORT(pin)==port)
+		{
+			PLANT_SetPin(pin,1);
+			for (row=0; row<ROWS; row++)
+			{
+				if ((PLANT_u8Key!=PLANT_NO_KEY) && (keypad_charArray[row][col]==PLANT_u8Key) &&
+				    (get_bit(HOST_GetPins(PLANT_PORT(keypad_pinMap.kEYPAD_rows[row])),PLANT_BIT(keypad_pinMap.kEYPAD_rows[row]))==0))
+				{
+					PLANT_SetPin(pin,0);
+				}
+			}
+		}
+	}
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Runs the firmware for (durationMs) of virtual time while the scenario is replayed, then returns.
+ */
+Std_Error_t PLANT_Run(const PLANT_Event_t script[], u8 count, u32 durationMs, Ptr_VoidFuncVoid_t firmwareMain)
+{
+	Std_Error_t error=STD_OK;
+	u8 i;
+	u8 port;
+
+	if (((script==NULL_PTR) && (count>0)) || (firmwareMain==NULL_PTR))
+	{
+		error=STD_NULL_POINTER;
+	}
+	else
+	{
+		for (i=1; i<count; i++)
+		{
+			if (script[i].timeMs<script[i-1].timeMs)
+			{
+				error=STD_INVALID_ARG;
+			}
+		}
+	}
+
+	if (error==STD_OK)
+	{
+		PLANT_pScript=script;
+		PLANT_u8Count=count;
+		PLANT_u8Next=0;
+		PLANT_u32DurationMs=durationMs;
+		PLANT_u32StartReleaseMs=0;
+		PLANT_u32StopReleaseMs=0;
+		PLANT_u8Key=PLANT_NO_KEY;
+		PLANT_IsJammed=STD_FALSE;
+		PLANT_u8TraceCount=0;
+		PLANT_u16TraceLost=0;
+		PLANT_u8Outputs=0;
+
+		HOST_Init();
+		for (port=0; port<HOST_PORTS_COUNT; port++)
+		{
+			PLANT_au8Levels[port]=0xFF;      /*< the pull-ups: released buttons, empty plate */
+			HOST_SetPins((HOST_Port_t)port,0xFF);
+		}
+		PLANT_SetPin(PLANT_DOOR_PIN,0);      /*< closed */
+		HD44780_Init();                      /*< the display */
+		PLANT_u64NextPulse=PLANT_PULSE_CYCLES;
+		HOST_SetStepCallBack(PLANT_Step);
+		HOST_SetPinsCallBack(PLANT_Pins);
+
+		if (setjmp(PLANT_End)==0)
+		{
+			firmwareMain();
+		}
+		HOST_SetStepCallBack(NULL_PTR);
+		HOST_SetPinsCallBack(NULL_PTR);
+	}
+	return error;
+}
+
+/**
+ * @brief Returns the recorded output changes of the last run.
+ */
+u8 PLANT_GetTrace(const PLANT_Trace_t **trace)
+{
+	if (trace!=NULL_PTR)
+	{
+		*trace=PLANT_arrTrace;
+	}
+	return PLANT_u8TraceCount;
+}
+
+/**
+ * @brief Compares the recorded output changes to the expected ones.
+ */
+Std_Error_t PLANT_CompareTrace(const PLANT_Trace_t expected[], u8 count, u32 toleranceMs, u8 *mismatch)
+{
+	Std_Error_t error=STD_OK;
+	u8 i;
+	u32 difference;
+
+	if (((expected==NULL_PTR) && (count>0)) || (mismatch==NULL_PTR))
+	{
+		error=STD_NULL_POINTER;
+	}
+	else if (PLANT_u16TraceLost>0)
+	{
+		*mismatch=PLANT_TRACE_SIZE;
+		error=STD_BUFFER_OVERFLOW;
+	}
+	else
+	{
+		*mismatch=count;
+		for (i=0; (i<count) && (i<PLANT_u8TraceCount) && (error==STD_OK); i++)
+		{
+			difference=(PLANT_arrTrace[i].timeMs>expected[i].timeMs)? (PLANT_arrTrace[i].timeMs-expected[i].timeMs)
+			                                                        : (expected[i].timeMs-PLANT_arrTrace[i].timeMs);
+			if ((PLANT_arrTrace[i].outputs!=expected[i].outputs) || (difference>toleranceMs))
+			{
+				*mismatch=i;
+				error=STD_NOK;
+			}
+		}
+		if ((error==STD_OK) && (count!=PLANT_u8TraceCount))
+		{
+			error=STD_NOK;
+		}
+	}
+	return error;
+}
+
+/**
+ * @brief Applies an action now (at the current virtual time), like an event of the scenario.
+ */
+Std_Error_t PLANT_Act(PLANT_Action_t action, u8 value)
+{
+	Std_Error_t error=STD_OK;
+	PLANT_Event_t event;
+
+	if (action>PLANT_JAM)
+	{
+		error=STD_INVALID_ARG;
+	}
+	else
+	{
+		event.timeMs=(u32)(HOST_GetCycles()/PLANT_CYCLES_PER_MS);
+		event.action=action;
+		event.value=value;
+		PLANT_Apply(&event,event.timeMs);
+	}
+	return error;
+}
+
+/**
+ * @brief Sets the function called at the start of every step of the plant.
+ */
+void PLANT_SetStepCallBack(Ptr_VoidFuncVoid_t LocalPtr)
+{
+	PLANT_Step_Fptr=LocalPtr;
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,326 @@
+#!/usr/bin/env python3
+"""Cycle-count benchmark of the MCAL/HAL hot paths of the microwave oven firmware (ATmega32).
+
+The firmware sources of 02-code are built with the Release flags of the Microchip Studio project,
+then:
+  - bench_main.c (linked with main.c renamed FIRMWARE_main) is run in simavr, it prints the exact
+    cycles of each benchmark on the simavr console ("BENCH <name> <cycles>").
+  - the ISR prologues and epilogues of the firmware image are counted from the avr-objdump
+    disassembly (straight-line code, the cycles are static).
+
+The results are written as JSON and compared with the baselines of bench_thresholds.json,
+the exit code is 1 when a result is above its baseline + tolerance. A result without a baseline (missing or null)
+is reported as unbaselined; it fails only once the baselines were measured ("require_baselines": true, set by
+--update), then a new case records its baseline with --update in the change that adds it.
+The budgets of bench_thresholds.json are design limits, not measures: a result above its budget fails
+(no tolerance), --update does not change them.
+
+Usage:
+  python3 bench.py                      # build, run, compare
+  python3 bench.py --json results.json  # also write the results
+  python3 bench.py --update             # record the results as the new baselines
+  python3 bench.py --preemptive         # the firmware with the preemptive kernel: adds the OS_TICK_ISR case
+  python3 bench.py --heater-isr both    # the heater ISRs app-bound and driver-bound, side by side
+  python3 bench.py --exti-isr both      # the EXTI ISRs (the door) driver-bound and app-bound, side by side
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+CODE = os.path.normpath(os.path.join(HERE, '..', '..', '02-code'))
+LAYERS = ('01-LIB', '02-MCAL', '03-HAL', '04-Services')  # 05-Host is the host port only
+
+MCU = 'atmega32'
+# the Release configuration of Atmega32.cproj
+CFLAGS = ['-mmcu=' + MCU, '-std=gnu99', '-Os', '-funsigned-char', '-funsigned-bitfields',
+          '-fpack-struct', '-fshort-enums', '-ffunction-sections', '-fdata-sections',
+          '-Wall', '-DNDEBUG']
+LDFLAGS = ['-mmcu=' + MCU, '-Wl,--gc-sections', '-lm']
+# the preemptive kernel (OS_Lcfg.h) instead of the cooperative scheduler
+PREEMPTIVE_CFLAGS = ['-DOS_PREEMPTIVE=OS_ON']
+# the binding of the heater ISRs TIMER1_COMPA/COMPB (TIMERS_Lcfg.h): the ISR of main.c or the driver ISR + callback
+HEATER_ISR_CFLAGS = {'app': [],
+                     'driver': ['-DTIMER1_COMPA_ISR_OWNER=TIMER_ISR_DRIVER', '-DTIMER1_COMPB_ISR_OWNER=TIMER_ISR_DRIVER']}
+HEATER_ISR_NAMES = ('TIMER1_COMPA', 'TIMER1_COMPB')
+# the binding of the EXTI ISRs INT0/INT1/INT2 (EXTI_Lcfg.h): the driver ISR + callback or the ISR of main.c (the door)
+EXTI_ISR_CFLAGS = {'driver': [],
+                   'app': ['-DINT0_ISR_OWNER=EXTI_ISR_APP', '-DINT1_ISR_OWNER=EXTI_ISR_APP',
+                           '-DINT2_ISR_OWNER=EXTI_ISR_APP']}
+EXTI_ISR_NAMES = ('INT0', 'INT1', 'INT2')
+# the idle function of main.c (system_idle()): Idle sleep or the spinning dispatcher (isr.py --idle-mode)
+IDLE_MODE_CFLAGS = {'sleep': [], 'spin': ['-DIDLE_MODE=IDLE_SPIN']}
+# keeps the simavr MCU description (AVR_MCU() of bench_main.c) out of the flash and the garbage collection
+BENCH_LDFLAGS = ['-Wl,--undefined=_mmcu,--section-start=.mmcu=0x910000']
+
+# ISR entry: 4 cycles of interrupt response (PC push, I cleared) + 3 of the jmp of the vector table
+ISR_ENTRY_CYCLES = 7
+# cycles of the instructions of an ISR prologue / epilogue
+INSN_CYCLES = {'push': 2, 'pop': 2, 'in': 1, 'out': 1, 'eor': 1, 'clr': 1, 'reti': 4}
+PROLOGUE_INSNS = ('push', 'in', 'eor', 'clr')
+EPILOGUE_INSNS = ('pop', 'out')
+
+ANSI = re.compile(r'\x1b\[[0-9;]*m')
+BENCH_LINE = re.compile(r'BENCH (\S+) (\d+|overflow)')
+
+
+def run(cmd, **kwargs):
+    result = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True, **kwargs)
+    if result.returncode != 0:
+        sys.exit('bench: %s failed\n%s' % (' '.join(cmd), result.stdout))
+    return result.stdout
+
+
+def f_cpu():
+    with open(os.path.join(CODE, '02-MCAL', 'MCU_config.h')) as f:
+        match = re.search(r'#define\s+F_CPU\s+(\d+)', f.read())
+    return int(match.group(1))
+
+
+def firmware_sources():
+    sources = []
+    for layer in LAYERS:
+        for root, _, files in os.walk(os.path.join(CODE, layer)):
+            sources += [os.path.join(root, name) for name in files if name.endswith('.c')]
+    return sorted(sources)
+
+
+def include_flags():
+    """-I of every module directory of the firmware (05-Host is the host port only)."""
+    dirs = set()
+    for root, _, files in os.walk(CODE):
+        if not os.path.relpath(root, CODE).startswith('05-') and any(name.endswith('.h') for name in files):
+            dirs.add(root)
+    return ['-I' + path for path in sorted(dirs)]
+
+
+def cflags(args):
+    """The Release flags and the variant of args (--preemptive, --heater-isr, --exti-isr, --idle-mode)."""
+    flags = CFLAGS + (PREEMPTIVE_CFLAGS if getattr(args, 'preemptive', False) else [])
+    return flags + HEATER_ISR_CFLAGS[getattr(args, 'heater_isr', 'app')] + \
+        EXTI_ISR_CFLAGS[getattr(args, 'exti_isr', 'driver')] + IDLE_MODE_CFLAGS[getattr(args, 'idle_mode', 'sleep')]
+
+
+def build_firmware(args, build_dir):
+    """Builds the firmware image, returns its path."""
+    firmware = os.path.join(build_dir, 'firmware.elf')
+    run([args.cc] + cflags(args) + include_flags() + firmware_sources() +
+        [os.path.join(CODE, 'main.c'), '-o', firmware] + LDFLAGS)
+    return firmware
+
+
+def build(args, build_dir):
+    firmware = build_firmware(args, build_dir)
+    common = [args.cc] + cflags(args) + include_flags()
+    main = os.path.join(CODE, 'main.c')
+
+    bench = os.path.join(build_dir, 'bench.elf')
+    cmd = common + ['-Dmain=FIRMWARE_main', '-c', main, '-o', os.path.join(build_dir, 'main.o')]
+    run(cmd)
+    extra = ['-I' + args.simavr_include] if args.simavr_include else []
+    run(common + extra + firmware_sources() + [os.path.join(build_dir, 'main.o'),
+                                               os.path.join(HERE, 'bench_main.c'), '-o', bench] +
+        LDFLAGS + BENCH_LDFLAGS)
+    return firmware, bench
+
+
+def parse_bench(output):
+    """The "BENCH <name> <cycles>" lines of the simavr console, None for an overflow."""
+    results = {}
+    for line in output.splitlines():
+        match = BENCH_LINE.search(ANSI.sub('', line))
+        if match:
+            value = match.group(2)
+            results[match.group(1)] = None if value == 'overflow' else int(value)
+    return results
+
+
+def vector_names():
+    """__vector_N -> the XXX_VECT name of Utils_interrupt.h."""
+    names = {}
+    with open(os.path.join(CODE, '01-LIB', 'Utils_interrupt.h')) as f:
+        for name, vector in re.findall(r'#define\s+(\w+_VECT)\s+(__vector_\d+)', f.read()):
+            names.setdefault(vector, name)
+    return names
+
+
+def parse_isrs(disassembly):
+    """The prologue (with the entry) and epilogue (with the reti) cycles of every __vector_N."""
+    functions = {}
+    current = None
+    for line in disassembly.splitlines():
+        header = re.match(r'^[0-9a-f]+ <(\w+)>:', line)
+        if header:
+            current = header.group(1)
+            functions[current] = []
+            continue
+        insn = re.match(r'^\s+[0-9a-f]+:\s+(?:[0-9a-f]{2} )+\s*(\w+)', line)
+        if insn and current is not None:
+            functions[current].append(insn.group(1))
+
+    names = vector_names()
+    results = {}
+    for function, insns in sorted(functions.items()):
+        if not re.match(r'__vector_\d+$', function) or 'reti' not in insns:
+            continue
+        prologue = ISR_ENTRY_CYCLES
+        for mnemonic in insns:
+            if mnemonic not in PROLOGUE_INSNS:
+                break
+            prologue += INSN_CYCLES[mnemonic]
+        last = len(insns) - 1 - insns[::-1].index('reti')
+        epilogue = INSN_CYCLES['reti']
+        for mnemonic in reversed(insns[:last]):
+            if mnemonic not in EPILOGUE_INSNS:
+                break
+            epilogue += INSN_CYCLES[mnemonic]
+        name = names.get(function, function)
+        results['ISR_prologue_' + name] = prologue
+        results['ISR_epilogue_' + name] = epilogue
+    return results
+
+
+def measure(args):
+    """Builds and runs the benchmark of a variant, returns its results.
+    The heater ISR results of the driver-bound variant are named <name>_DRIVER, the EXTI ISR results of the app-bound
+    variant <name>_APP: all the variants have their baselines."""
+    build_dir = tempfile.mkdtemp(prefix='bench_')
+    try:
+        firmware, bench = build(args, build_dir)
+        try:
+            output = subprocess.run([args.simavr, '-m', MCU, '-f', str(f_cpu()), bench],
+                                    stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                                    universal_newlines=True, timeout=args.timeout).stdout
+        except subprocess.TimeoutExpired:
+            sys.exit('bench: simavr did not exit after %d s' % args.timeout)
+        results = parse_bench(output)
+        if not results:
+            sys.exit('bench: no BENCH line in the simavr output\n' + output)
+        results.update(parse_isrs(run([args.objdump, '-d', firmware])))
+    finally:
+        shutil.rmtree(build_dir, ignore_errors=True)
+    if args.heater_isr == 'driver':
+        results = dict((name + '_DRIVER' if any(isr in name for isr in HEATER_ISR_NAMES) else name, cycles)
+                       for name, cycles in results.items())
+    if args.exti_isr == 'app':
+        results = dict((name + '_APP' if any(isr in name for isr in EXTI_ISR_NAMES) else name, cycles)
+                       for name, cycles in results.items())
+    return results
+
+
+def heater_isr_table(results):
+    """The heater ISRs of both variants: [(name, app cycles, driver cycles)]."""
+    return [(name, results[name], results.get(name + '_DRIVER')) for name in sorted(results)
+            if any(isr in name for isr in HEATER_ISR_NAMES) and not name.endswith('_DRIVER')]
+
+
+def exti_isr_table(results):
+    """The EXTI ISRs of both variants: [(name, app cycles, driver cycles)]."""
+    return [(name, results.get(name + '_APP'), results[name]) for name in sorted(results)
+            if any(isr in name for isr in EXTI_ISR_NAMES) and not name.endswith('_APP')]
+
+
+def print_binding_table(title, table):
+    print('\n%-32s %8s %8s %8s' % (title, 'app', 'driver', 'delta'), file=sys.stderr)
+    for name, app, driver in table:
+        delta = '-' if app is None or driver is None else '%+d' % (driver - app)
+        print('%-32s %8s %8s %8s' % (name, app, driver, delta), file=sys.stderr)
+
+
+def compare(results, thresholds):
+    """The regressions: [(name, cycles, baseline, limit)] and the results without a baseline: [(name, cycles)].
+    The baselines of the cases that were not run (the other variants) are not checked."""
+    tolerance = thresholds.get('tolerance_percent', 0)
+    baselines = thresholds.get('baselines', {})
+    regressions = []
+    missing = []
+    for name, cycles in sorted(results.items()):
+        baseline = baselines.get(name)
+        if baseline is None:
+            missing.append((name, cycles))
+            continue
+        limit = baseline * (100 + tolerance) // 100
+        if cycles is None or cycles > limit:
+            regressions.append((name, cycles, baseline, limit))
+    return regressions, missing
+
+
+def over_budget(results, thresholds):
+    """The results above their budget: [(name, cycles, budget)]."""
+    return [(name, results[name], budget) for name, budget in sorted(thresholds.get('budgets', {}).items())
+            if name in results and (results[name] is None or results[name] > budget)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Cycle-count benchmark of the MCAL/HAL hot paths (simavr).')
+    parser.add_argument('--cc', default='avr-gcc')
+    parser.add_argument('--objdump', default='avr-objdump')
+    parser.add_argument('--simavr', default='simavr')
+    parser.add_argument('--simavr-include', default=None,
+                        help='directory of avr_mcu_section.h (simavr/sim/avr)')
+    parser.add_argument('--thresholds', default=os.path.join(HERE, 'bench_thresholds.json'))
+    parser.add_argument('--json', default=None, help='write the results to this file')
+    parser.add_argument('--update', action='store_true', help='record the results as the baselines')
+    parser.add_argument('--timeout', type=int, default=60, help='simavr timeout in seconds')
+    parser.add_argument('--preemptive', action='store_true',
+                        help='build with the preemptive kernel (OS_PREEMPTIVE=OS_ON): the context switch is measured')
+    parser.add_argument('--heater-isr', choices=('app', 'driver', 'both'), default='app',
+                        help='the binding of the heater ISRs TIMER1_COMPA/COMPB (both: two builds, compared)')
+    parser.add_argument('--exti-isr', choices=('driver', 'app', 'both'), default='driver',
+                        help='the binding of the EXTI ISRs INT0/INT1/INT2 (both: two builds, compared)')
+    args = parser.parse_args()
+
+    results = {}
+    heater_isrs = ('app', 'driver') if args.heater_isr == 'both' else (args.heater_isr,)
+    exti_isrs = ('driver', 'app') if args.exti_isr == 'both' else (args.exti_isr,)
+    for heater_isr in heater_isrs:
+        for exti_isr in exti_isrs:
+            results.update(measure(argparse.Namespace(**dict(vars(args), heater_isr=heater_isr, exti_isr=exti_isr))))
+
+    report = {'mcu': MCU, 'f_cpu': f_cpu(), 'cflags': CFLAGS, 'preemptive': args.preemptive,
+              'heater_isr': list(heater_isrs), 'exti_isr': list(exti_isrs), 'cycles': results}
+    text = json.dumps(report, indent=2, sort_keys=True)
+    print(text)
+    if len(heater_isrs) == 2:
+        print_binding_table('heater ISR', heater_isr_table(results))
+    if len(exti_isrs) == 2:
+        print_binding_table('EXTI ISR', exti_isr_table(results))
+    if args.json:
+        with open(args.json, 'w') as f:
+            f.write(text + '\n')
+
+    with open(args.thresholds) as f:
+        thresholds = json.load(f)
+    if args.update:
+        baselines = thresholds.setdefault('baselines', {})
+        baselines.update(results)  # the cases of the other variants (--preemptive, --heater-isr, --exti-isr) are kept
+        thresholds['baselines'] = {name: baselines[name] for name in sorted(baselines)}
+        thresholds['require_baselines'] = True  # measured: a case without a baseline fails from now on
+        with open(args.thresholds, 'w') as f:
+            f.write(json.dumps(thresholds, indent=2) + '\n')
+        return 0
+
+    regressions, missing = compare(results, thresholds)
+    for name, cycles, baseline, limit in regressions:
+        print('REGRESSION %s: %s cycles, baseline %d, limit %d' %
+              (name, 'overflow' if cycles is None else cycles, baseline, limit), file=sys.stderr)
+    overs = over_budget(results, thresholds)
+    for name, cycles, budget in overs:
+        print('OVER BUDGET %s: %s cycles, budget %d' % (name, 'overflow' if cycles is None else cycles, budget),
+              file=sys.stderr)
+    is_strict = thresholds.get('require_baselines', False)
+    for name, cycles in missing:
+        print('%s %s: %s cycles, record it with --update' % ('NO BASELINE' if is_strict else 'UNBASELINED', name,
+              'overflow' if cycles is None else cycles), file=sys.stderr)
+    return 1 if regressions or overs or (missing and is_strict) else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
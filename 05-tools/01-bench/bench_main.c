@@ -0,0 +1,306 @@
+/**
+ * @file bench_main.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the cycle-count benchmark image of the MCAL/HAL hot paths (ATmega32, F_CPU of MCU_config.h).
+ *         It is built with the firmware sources (main.c with -Dmain=FIRMWARE_main) by bench.py and run in simavr.
+ *
+ *         - TIMER1 counts the CPU clock (normal mode, no prescaler), the interrupts are disabled.
+ *         - Every benchmark is a noinline wrapper called through a pointer, the cost of an empty wrapper
+ *           (call, return and the two TCNT1 reads) is subtracted: the results are the exact cycles of the call.
+ *         - A result is printed as "BENCH <name> <cycles>" on the simavr console register,
+ *           "BENCH <name> overflow" when it is longer than 65535 cycles.
+ *         - The image ends with a sleep with the interrupts disabled (simavr exits).
+ *
+ * @see bench.py
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_BitMath.h"
+#include "Utils_interrupt.h"
+#include "Protothread.h"
+#include "RingBuffer.h"
+
+// MCAL
+#include "MCU_config.h"
+#include "DIO_Interface.h"
+#include "TIMERS_Interfacing.h"
+#include "TIMERS_Lcfg.h"
+#include "EXTI_Interface.h"
+#include "EXTI_Lcfg.h"
+#include "WDT_Interface.h"
+#include "UART_Interface.h"
+
+// HAL
+#include "Keypad_interface.h"
+#include "LCD_Interface.h"
+
+// Services
+#include "OS_Lcfg.h"
+#include "OS_Interface.h"
+#include "TRACE_Lcfg.h"
+#include "TRACE_Interface.h"
+
+#include "avr_mcu_section.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define BENCH_TCCR1B_CS10         0
+#define BENCH_TIFR_TOV1           2
+#define BENCH_MCUCR_SE            7
+
+#define BENCH_LCD                 0
+#define BENCH_OUTPUT_PIN          PC1     /*< the lamp */
+#define BENCH_INPUT_PIN           PA0     /*< the start button */
+
+#define BENCH_NOINLINE            __attribute__((noinline))
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef struct
+{
+	const char *name;
+	Ptr_VoidFuncVoid_t bench;
+}BENCH_Case_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* the simavr console: the characters written to TWAR are printed by line (the TWI is not used) */
+AVR_MCU(F_CPU, "atmega32");
+AVR_MCU_SIMAVR_CONSOLE(&TWAR);
+
+static u8 BENCH_u8Key;
+static u8 BENCH_au8Str[]="Microwave";
+RINGBUF_DEFINE(BENCH_Ring,16);
+
+/**
+ * @brief The heater ISRs of main.c, called as functions (prologue + body + epilogue + reti): the 1s cooking timer
+ *        (compare match A) and the end of the heater ON time (compare match B).
+ *        App-bound: the ISR of main.c. Driver-bound: the ISR of TIMERS_Prog.c that calls the callback of main.c
+ *        (TIMERS_Lcfg.h, bench.py --heater-isr).
+ */
+void TIMER1_COMPA_VECT(void);
+void TIMER1_COMPB_VECT(void);
+
+/**
+ * @brief The door ISR (INT2, DOOR_INTERLOCK_INT2 of main.c), called as a function: driver-bound, the ISR of
+ *        EXTI_Prog.c that calls the callback of main.c, app-bound, the ISR of main.c (EXTI_Lcfg.h, bench.py --exti-isr).
+ */
+void INT2_VECT(void);
+#if (INT2_ISR_OWNER==EXTI_ISR_DRIVER)
+void system_doorOpened(void);
+#endif
+#if (TIMER1_COMPA_ISR_OWNER==TIMER_ISR_DRIVER)
+void system_timerSecond(void);
+#endif
+#if (TIMER1_COMPB_ISR_OWNER==TIMER_ISR_DRIVER)
+void system_heaterOff(void);
+#endif
+
+/**
+ * @brief The tick of the preemptive kernel (naked ISR, called as a function): the context of the bench (the idle task)
+ *        is saved, the tick runs, the highest ready task is selected (the idle task, no task is created) and restored.
+ */
+#if (OS_PREEMPTIVE==OS_ON)
+void TIMER0_COMP_VECT(void);
+#endif
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+static BENCH_NOINLINE void BENCH_Empty(void)            { }
+static BENCH_NOINLINE void BENCH_DioWritePin(void)      { Dio_WritePin(BENCH_OUTPUT_PIN,DIO_VOLT_HIGH); }
+static BENCH_NOINLINE void BENCH_DioReadPin(void)       { (void)Dio_ReadPin(BENCH_INPUT_PIN); }
+static BENCH_NOINLINE void BENCH_DioInit(void)          { Dio_Init(); }
+static BENCH_NOINLINE void BENCH_KeypadGetKey(void)     { (void)KEYPAD_GetKey(&BENCH_u8Key); }
+static BENCH_NOINLINE void BENCH_LcdWriteCh(void)       { LCD_WriteCh(BENCH_LCD,'A'); }
+static BENCH_NOINLINE void BENCH_LcdWriteStr(void)      { LCD_WriteStr(BENCH_LCD,BENCH_au8Str); }
+static BENCH_NOINLINE void BENCH_LcdWriteNum(void)      { LCD_WriteNum(BENCH_LCD,12345); }
+static BENCH_NOINLINE void BENCH_UartWrite(void)        { (void)UART_Write(BENCH_au8Str,8); }
+static BENCH_NOINLINE void BENCH_RingBufPush(void)      { (void)RingBuf_Push(&BENCH_Ring,'5'); }
+static BENCH_NOINLINE void BENCH_RingBufPop(void)       { (void)RingBuf_Pop(&BENCH_Ring,&BENCH_u8Key); } /*< pops the pushed byte */
+static BENCH_NOINLINE void BENCH_Timer1CompA(void)
+{
+	TIMER1_COMPA_VECT();
+	Global_Interrupt_Disable__asm(); /*< reti enabled the interrupts */
+}
+static BENCH_NOINLINE void BENCH_Timer1CompB(void)
+{
+	TIMER1_COMPB_VECT();
+	Global_Interrupt_Disable__asm();
+}
+static BENCH_NOINLINE void BENCH_Int2(void)
+{
+	INT2_VECT();
+	Global_Interrupt_Disable__asm();
+}
+#if (OS_PREEMPTIVE==OS_ON)
+static BENCH_NOINLINE void BENCH_OsTick(void)
+{
+	TIMER0_COMP_VECT();
+	Global_Interrupt_Disable__asm(); /*< reti enabled the interrupts */
+}
+#endif
+#if (TRACE_ENABLE==TRACE_ON)
+static BENCH_NOINLINE void BENCH_TraceRecordIsr(void)   { TRACE_RECORD_ISR(TRACE_KEY,'5'); }
+static BENCH_NOINLINE void BENCH_TraceRecord(void)      { TRACE_RECORD(TRACE_KEY,'5'); }
+#endif
+
+/**
+ * @brief The benchmarks, the names are the keys of bench_thresholds.json.
+ */
+static const BENCH_Case_t BENCH_arrCases[]={ { "Dio_WritePin"         , BENCH_DioWritePin  },
+                                             { "Dio_ReadPin"          , BENCH_DioReadPin   },
+                                             { "Dio_Init"             , BENCH_DioInit      },
+                                             { "KEYPAD_GetKey"        , BENCH_KeypadGetKey },
+                                             { "LCD_WriteCh"          , BENCH_LcdWriteCh   },
+                                             { "LCD_WriteStr_9"       , BENCH_LcdWriteStr  },
+                                             { "LCD_WriteNum_12345"   , BENCH_LcdWriteNum  },
+                                             { "ISR_TIMER1_COMPA"     , BENCH_Timer1CompA  },
+                                             { "ISR_TIMER1_COMPB"     , BENCH_Timer1CompB  },
+                                             { "ISR_INT2"             , BENCH_Int2         },
+                                             { "UART_Write_8"         , BENCH_UartWrite    },
+                                             { "RingBuf_Push"         , BENCH_RingBufPush  },
+                                             { "RingBuf_Pop"          , BENCH_RingBufPop   },
+#if (OS_PREEMPTIVE==OS_ON)
+                                             { "OS_TICK_ISR"          , BENCH_OsTick       },
+#endif
+#if (TRACE_ENABLE==TRACE_ON)
+                                             { "TRACE_RECORD_ISR"     , BENCH_TraceRecordIsr },
+                                             { "TRACE_RECORD"         , BENCH_TraceRecord    },
+#endif
+                                           };
+
+/**
+ * @brief Returns the cycles of a call of (bench), including the measurement overhead.
+ *
+ * @param isOverflow Pointer to receive STD_TRUE when the call is longer than 65535 cycles.
+ */
+static u16 BENCH_Measure(Ptr_VoidFuncVoid_t bench, Std_Bool_t *isOverflow)
+{
+	u16 start;
+	u16 end;
+
+	TCNT1=0;
+	TIFR=(1<<BENCH_TIFR_TOV1); /*< cleared by writing 1 */
+	start=TCNT1;
+	bench();
+	end=TCNT1;
+	*isOverflow=(get_bit(TIFR,BENCH_TIFR_TOV1)==1)? STD_TRUE : STD_FALSE;
+	return (u16)(end-start);
+}
+
+/**
+ * @brief Prints a character on the simavr console.
+ */
+static void BENCH_PutCh(u8 ch)
+{
+	TWAR=ch;
+}
+
+/**
+ * @brief Prints "BENCH <name> <cycles>" (or overflow) on the simavr console.
+ */
+static void BENCH_Print(const char *name, u16 cycles, Std_Bool_t isOverflow)
+{
+	u8 digits[5];
+	u8 count=0;
+	const char *str="BENCH ";
+
+	while (*str!='\0')
+	{
+		BENCH_PutCh((u8)*str++);
+	}
+	while (*name!='\0')
+	{
+		BENCH_PutCh((u8)*name++);
+	}
+	BENCH_PutCh(' ');
+	if (isOverflow==STD_TRUE)
+	{
+		str="overflow";
+		while (*str!='\0')
+		{
+			BENCH_PutCh((u8)*str++);
+		}
+	}
+	else
+	{
+		do
+		{
+			digits[count++]=(u8)('0'+(cycles%10));
+			cycles/=10;
+		}while (cycles>0);
+		while (count>0)
+		{
+			BENCH_PutCh(digits[--count]);
+		}
+	}
+	BENCH_PutCh('\n');
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+int main(void)
+{
+	Std_Bool_t isOverflow;
+	u16 overhead;
+	u16 cycles;
+	u8 i;
+
+	Global_Interrupt_Disable__asm();
+	Dio_Init();
+#if (TRACE_ENABLE==TRACE_ON)
+	TRACE_Init(WDT_RESET_POWER_ON); /*< a valid empty log (.noinit) */
+#endif
+#if (TIMER1_COMPA_ISR_OWNER==TIMER_ISR_DRIVER)
+	TIMER1_COMPA_SetCallBack(system_timerSecond); /*< as system_init() */
+#endif
+#if (TIMER1_COMPB_ISR_OWNER==TIMER_ISR_DRIVER)
+	TIMER1_COMPB_SetCallBack(system_heaterOff);
+#endif
+#if (INT2_ISR_OWNER==EXTI_ISR_DRIVER)
+	EXTI_SetCallBack(EXTI_INT2,system_doorOpened);
+#endif
+#if (OS_PREEMPTIVE==OS_ON)
+	OS_Init();
+	OS_Start();                       /*< the bench is the idle task */
+	TIMER0_COMP_INT(STD_DISABLED);    /*< the ticks are the calls of the case */
+#endif
+	TCCR1A=0;
+	TCCR1B=(1<<BENCH_TCCR1B_CS10);  /*< normal mode, clk/1 */
+
+	overhead=BENCH_Measure(BENCH_Empty,&isOverflow);
+	for (i=0; i<(sizeof(BENCH_arrCases)/sizeof(BENCH_arrCases[0])); i++)
+	{
+		cycles=BENCH_Measure(BENCH_arrCases[i].bench,&isOverflow);
+		BENCH_Print(BENCH_arrCases[i].name,(u16)(cycles-overhead),isOverflow);
+	}
+	BENCH_Print("overhead",overhead,STD_FALSE);
+
+	set_bit(MCUCR,BENCH_MCUCR_SE);
+	while (1)
+	{
+		__asm__ __volatile__ ("sleep"); /*< with the interrupts disabled: simavr exits */
+	}
+}
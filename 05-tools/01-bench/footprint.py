@@ -0,0 +1,283 @@
+#!/usr/bin/env python3
+"""Flash and SRAM footprint of the microwave oven firmware (ATmega32) per module, source file and symbol.
+
+The firmware sources of 02-code are compiled one object per source file with the Release flags of the
+Microchip Studio project (bench.py), linked with a map file, then every input section of the map is
+attributed to its source file and symbol:
+  - text   : .text* (code, vectors, progmem), the libgcc/avr-libc parts are attributed to "toolchain"
+  - data   : .data* (initialized variables: flash for the initial values + SRAM)
+  - rodata : .rodata* (const data: on AVR it is copied to SRAM like .data, flash + SRAM)
+  - bss    : .bss*, .noinit, COMMON (SRAM only)
+
+  flash = text + data + rodata        sram = data + rodata + bss
+
+The totals and the module sizes are compared with footprint_budget.json, the exit code is 1 when:
+  - the image does not fit the device (flash / sram of "device", sram minus "stack_reserve"),
+  - a module is above its budget,
+  - a module has no budget (no entry or null) once the budgets were measured ("require_budgets": true, set by
+    --update); before that it is reported as unbudgeted: a new feature adds its module with its cost.
+
+--update records the module sizes plus "headroom_percent" of the budget file as the budgets.
+
+Usage:
+  python3 footprint.py                    # build, report, check the budget
+  python3 footprint.py --symbols 40       # also list the 40 biggest symbols
+  python3 footprint.py --json fp.json     # also write the full attribution
+  python3 footprint.py --update           # record the module sizes + headroom as the new budgets
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import sys
+import tempfile
+
+import bench
+
+HERE = bench.HERE
+CODE = bench.CODE
+TOOLCHAIN = 'toolchain'
+SECTIONS = ('text', 'data', 'rodata', 'bss')
+
+
+def module_of(source):
+    """The module of a source file (relative to 02-code): its directory, main.c is its own module."""
+    directory = os.path.dirname(source).replace(os.sep, '/')
+    return directory if directory else source
+
+
+def build(args, build_dir):
+    """Compiles one object per source file (same relative path as the source), links the firmware
+    and returns the map file."""
+    includes = bench.include_flags()
+    sources = bench.firmware_sources() + [os.path.join(CODE, 'main.c')]
+    objects = []
+    for source in sources:
+        relative = os.path.relpath(source, CODE)
+        obj = os.path.join(build_dir, 'obj', os.path.splitext(relative)[0] + '.o')
+        os.makedirs(os.path.dirname(obj), exist_ok=True)
+        bench.run([args.cc] + bench.CFLAGS + includes + ['-c', source, '-o', obj])
+        objects.append(obj)
+    map_file = os.path.join(build_dir, 'firmware.map')
+    bench.run([args.cc] + objects + ['-o', os.path.join(build_dir, 'firmware.elf'),
+                                           '-Wl,-Map=' + map_file] + bench.LDFLAGS)
+    return map_file
+
+
+def category(output_section, input_section):
+    if input_section.startswith('.rodata'):
+        return 'rodata'
+    if output_section in ('.bss', '.noinit') or input_section == 'COMMON':
+        return 'bss'
+    if output_section == '.data':
+        return 'data'
+    if output_section == '.text':
+        return 'text'
+    return None  # .eeprom, .fuse, .mmcu and the debug sections
+
+
+def parse_map(text):
+    """The input sections kept in the image: [(output section, input section, size, object, [(address, symbol)])]."""
+    # the discarded input sections are listed before the memory map
+    start = text.find('Linker script and memory map')
+    lines = text[start:].splitlines() if start >= 0 else []
+
+    sections = []
+    output_section = None
+    pending = None  # an input section name alone on its line
+    for line in lines:
+        output = re.match(r'^(\.\S+)', line)
+        if output:
+            output_section = output.group(1)
+            pending = None
+            continue
+        inline = re.match(r'^ (\.\S+|COMMON)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S.*)$', line)
+        alone = re.match(r'^ (\.\S+|COMMON)\s*$', line)
+        follow = re.match(r'^\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S.*)$', line)
+        symbol = re.match(r'^\s+0x([0-9a-f]+)\s+([A-Za-z_.$][\w.$]*)\s*$', line)
+        if inline:
+            sections.append([output_section, inline.group(1), int(inline.group(3), 16),
+                             inline.group(4).strip(), int(inline.group(2), 16), []])
+            pending = None
+        elif alone:
+            pending = alone.group(1)
+        elif follow and pending is not None:
+            sections.append([output_section, pending, int(follow.group(2), 16),
+                             follow.group(3).strip(), int(follow.group(1), 16), []])
+            pending = None
+        elif symbol and sections and not symbol.group(2).startswith('.'):
+            sections[-1][5].append((int(symbol.group(1), 16), symbol.group(2)))
+    return sections
+
+
+def symbols_of(input_section, size, address, globals_):
+    """Splits an input section between its symbols: [(symbol, size)].
+
+    -ffunction-sections/-fdata-sections name the section after its symbol (.text.<symbol>),
+    the other sections are split at the global symbols the map lists, else they are one entry."""
+    match = re.match(r'^\.(?:text(?:\.startup)?|data|bss|rodata|progmem\.data)\.(.+)$', input_section)
+    if match:
+        return [(match.group(1), size)]
+    inside = sorted(entry for entry in globals_ if address <= entry[0] < address + size)
+    if not inside:
+        return [(input_section, size)]
+    entries = []
+    if inside[0][0] > address:
+        entries.append((input_section, inside[0][0] - address))
+    for i, (start, name) in enumerate(inside):
+        end = inside[i + 1][0] if i + 1 < len(inside) else address + size
+        entries.append((name, end - start))
+    return entries
+
+
+def source_of(obj, sources):
+    """The source file (relative to 02-code) of an object whose path ends with the source path
+    (this build and the Microchip Studio build), None for the toolchain objects."""
+    path = os.path.splitext(obj.replace('\\', '/'))[0]
+    for source in sources:
+        if path == os.path.splitext(source)[0] or path.endswith('/' + os.path.splitext(source)[0]):
+            return source
+    return None
+
+
+def attribute(sections):
+    """{module: {file: {symbol: {category: bytes}}}}"""
+    sources = [os.path.relpath(path, CODE).replace(os.sep, '/')
+               for path in bench.firmware_sources() + [os.path.join(CODE, 'main.c')]]
+    # the longest first: the most specific path wins
+    sources.sort(key=len, reverse=True)
+    result = {}
+    for output_section, input_section, size, obj, address, globals_ in sections:
+        kind = category(output_section, input_section)
+        if kind is None or size == 0:
+            continue
+        source = source_of(obj, sources)
+        if source is None:
+            module, source = TOOLCHAIN, os.path.basename(obj)  # libgcc.a(_mulsi3.o), crtatmega32.o
+        else:
+            module = module_of(source)
+        files = result.setdefault(module, {}).setdefault(source, {})
+        for name, part in symbols_of(input_section, size, address, globals_):
+            entry = files.setdefault(name, dict.fromkeys(SECTIONS, 0))
+            entry[kind] += part
+    return result
+
+
+def totals(sizes):
+    total = dict.fromkeys(SECTIONS, 0)
+    for entry in sizes:
+        for kind in SECTIONS:
+            total[kind] += entry[kind]
+    total['flash'] = total['text'] + total['data'] + total['rodata']
+    total['sram'] = total['data'] + total['rodata'] + total['bss']
+    return total
+
+
+def summarize(attribution):
+    modules = {}
+    files = {}
+    symbols = []
+    for module, module_files in attribution.items():
+        module_symbols = []
+        for source, source_symbols in module_files.items():
+            files[source] = totals(source_symbols.values())
+            module_symbols += source_symbols.values()
+            symbols += [(name, source, sizes) for name, sizes in source_symbols.items()]
+        modules[module] = totals(module_symbols)
+    return modules, files, symbols
+
+
+def table(title, rows):
+    print('%-40s %7s %7s %7s %7s %7s %7s' % ((title,) + SECTIONS + ('flash', 'sram')))
+    for name, sizes in rows:
+        print('%-40s %7d %7d %7d %7d %7d %7d' % ((name,) + tuple(sizes[k] for k in SECTIONS + ('flash', 'sram'))))
+    print()
+
+
+def check(modules, total, budget):
+    """The budget failures: [message] and the modules without a budget: [message]."""
+    failures = []
+    missing = []
+    device = budget.get('device', {})
+    sram_limit = device.get('sram', 0) - budget.get('stack_reserve', 0)
+    if device.get('flash') is not None and total['flash'] > device['flash']:
+        failures.append('flash %d > device %d' % (total['flash'], device['flash']))
+    if device.get('sram') is not None and total['sram'] > sram_limit:
+        failures.append('sram %d > device %d - stack_reserve %d' %
+                        (total['sram'], device['sram'], budget.get('stack_reserve', 0)))
+    budgets = budget.get('modules', {})
+    for module, sizes in sorted(modules.items()):
+        for memory in ('flash', 'sram'):
+            limit = budgets.get(module, {}).get(memory)
+            if limit is None:
+                missing.append('%s has no %s budget (%d): record it with --update' % (module, memory, sizes[memory]))
+            elif sizes[memory] > limit:
+                failures.append('%s %s %d > budget %d' % (module, memory, sizes[memory], limit))
+    return failures, missing
+
+
+def with_headroom(size, percent):
+    """The budget of a size: size + percent, rounded up."""
+    return size + (size * percent + 99) // 100
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Flash/SRAM footprint per module, file and symbol.')
+    parser.add_argument('--cc', default='avr-gcc')
+    parser.add_argument('--map', default=None, help='use this map file of a build of 02-code (no build)')
+    parser.add_argument('--budget', default=os.path.join(HERE, 'footprint_budget.json'))
+    parser.add_argument('--symbols', type=int, default=20, help='number of the biggest symbols to list')
+    parser.add_argument('--json', default=None, help='write the attribution to this file')
+    parser.add_argument('--update', action='store_true', help='record the module sizes as the budgets')
+    args = parser.parse_args()
+
+    build_dir = tempfile.mkdtemp(prefix='footprint_')
+    try:
+        if args.map:
+            map_file = args.map
+        else:
+            map_file = build(args, build_dir)
+        with open(map_file) as f:
+            attribution = attribute(parse_map(f.read()))
+    finally:
+        shutil.rmtree(build_dir, ignore_errors=True)
+
+    modules, files, symbols = summarize(attribution)
+    total = totals(modules.values())
+    table('module', sorted(modules.items()) + [('TOTAL', total)])
+    table('file', sorted(files.items()))
+    symbols.sort(key=lambda entry: -totals([entry[2]])['flash'] - entry[2]['bss'])
+    table('symbol (file)', [('%s (%s)' % (name, os.path.basename(source)), totals([sizes]))
+                            for name, source, sizes in symbols[:args.symbols]])
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({'total': total, 'modules': modules, 'files': files, 'symbols': attribution},
+                      f, indent=2, sort_keys=True)
+            f.write('\n')
+
+    with open(args.budget) as f:
+        budget = json.load(f)
+    if args.update:
+        headroom = budget.get('headroom_percent', 0)
+        budget['modules'] = {module: {'flash': with_headroom(sizes['flash'], headroom),
+                                      'sram': with_headroom(sizes['sram'], headroom)}
+                             for module, sizes in sorted(modules.items())}
+        budget['require_budgets'] = True  # measured: a module without a budget fails from now on
+        with open(args.budget, 'w') as f:
+            f.write(json.dumps(budget, indent=2) + '\n')
+        return 0
+
+    failures, missing = check(modules, total, budget)
+    is_strict = budget.get('require_budgets', False)
+    for failure in failures:
+        print('OVER BUDGET ' + failure, file=sys.stderr)
+    for message in missing:
+        print(('NO BUDGET ' if is_strict else 'UNBUDGETED ') + message, file=sys.stderr)
+    return 1 if failures or (missing and is_strict) else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
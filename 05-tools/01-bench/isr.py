@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+"""Worst-case ISR latency and execution time of the microwave oven firmware (ATmega32) in simavr.
+
+The Release firmware image (bench.py) runs in isr_latency.c, a simavr harness that drives random oven activity
+(keys, buttons, door, weight sensor, turntable encoder) and measures, for every ISR of the image (__vector_N):
+  - the latency from the interrupt request (flag set while enabled) to the first instruction of the ISR,
+  - the execution time from that instruction to the end of the reti,
+and the interrupts-disabled windows of the main context (what delays the requests), and the part of the cycles
+the CPU was active (not sleeping).
+
+The report gives the worst and mean values in cycles and microseconds, and the code that was running
+when the worst request of each vector was queued.
+
+Usage:
+  python3 isr.py --simavr-include <simavr>/simavr/sim --simavr-lib <simavr>/simavr/obj-<arch>
+  python3 isr.py ... --seconds 120 --seed 7 --json isr.json
+  python3 isr.py ... --heater-isr both   # the heater ISRs (TIMER1_COMPA/COMPB) app-bound and driver-bound
+  python3 isr.py ... --exti-isr both     # the EXTI ISRs (INT0/INT1/INT2, the door) driver-bound and app-bound
+  python3 isr.py ... --activity none --idle-mode both   # the active cycles in standby, with and without the idle sleep
+"""
+
+import argparse
+import bisect
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+import bench
+
+HERE = bench.HERE
+CODE = bench.CODE
+
+
+def symbols(nm_output):
+    """The code symbols sorted by address: [(address, name)]."""
+    entries = []
+    for line in nm_output.splitlines():
+        match = re.match(r'^([0-9a-f]+)\s+[TtWw]\s+(\S+)$', line)
+        if match:
+            entries.append((int(match.group(1), 16), match.group(2)))
+    return sorted(entries)
+
+
+def locate(address, code_symbols):
+    """<function>+0x<offset> of a code address."""
+    index = bisect.bisect_right([entry[0] for entry in code_symbols], address) - 1
+    if index < 0:
+        return '0x%x' % address
+    start, name = code_symbols[index]
+    return '%s+0x%x' % (name, address - start) if address != start else name
+
+
+def vectors(code_symbols):
+    """The ISRs of the image: [(vector number, address)]."""
+    found = []
+    for address, name in code_symbols:
+        match = re.match(r'^__vector_(\d+)$', name)
+        if match:
+            found.append((int(match.group(1)), address))
+    return sorted(found)
+
+
+def build_harness(args, build_dir):
+    harness = os.path.join(build_dir, 'isr_latency')
+    cmd = [args.host_cc, '-O2', '-DHOST_BUILD', '-std=gnu99', '-funsigned-char', '-fshort-enums',
+           '-I' + os.path.join(CODE, '05-Host')] + bench.include_flags()
+    if args.simavr_include:
+        cmd.append('-I' + args.simavr_include)
+    cmd += [os.path.join(HERE, 'isr_latency.c'), os.path.join(CODE, '03-HAL', '02-Keypad', 'Keypad_Lcfg.c'),
+            '-o', harness]
+    if args.simavr_lib:
+        cmd.append('-L' + args.simavr_lib)
+    bench.run(cmd + ['-lsimavr', '-lelf'])
+    return harness
+
+
+def parse(output, code_symbols, names):
+    results = {'vectors': {}, 'windows': [], 'cycles': 0, 'sleep_cycles': 0}
+    addresses = dict((number, address) for number, address in vectors(code_symbols))
+    for line in output.splitlines():
+        fields = line.split()
+        if fields[:1] == ['ISR'] and len(fields) == 8:
+            number, count, worst, total, worst_exec, total_exec = (int(x) for x in fields[1:7])
+            name = names.get('__vector_%d' % number, '__vector_%d' % number)
+            results['vectors'][name] = {
+                'vector': number, 'address': addresses.get(number), 'count': count,
+                'latency_worst': worst, 'latency_mean': total // count if count else None,
+                'exec_worst': worst_exec, 'exec_mean': total_exec // count if count else None,
+                'worst_queued_at': locate(int(fields[7], 16), code_symbols) if count else None}
+        elif fields[:1] == ['CLI'] and len(fields) == 4:
+            results['windows'].append({'start': locate(int(fields[1], 16), code_symbols),
+                                       'count': int(fields[2]), 'worst': int(fields[3])})
+        elif fields[:1] == ['SLEEP'] and len(fields) == 2:
+            results['sleep_cycles'] = int(fields[1])
+        elif fields[:1] == ['END'] and len(fields) == 2:
+            results['cycles'] = int(fields[1])
+    results['windows'].sort(key=lambda window: -window['worst'])
+    results['active_percent'] = active_percent(results)
+    return results
+
+
+def active_percent(results):
+    """The part of the simulated cycles the CPU was not sleeping."""
+    if not results['cycles']:
+        return None
+    return round(100.0 * (results['cycles'] - results['sleep_cycles']) / results['cycles'], 2)
+
+
+def report(results, f_cpu, top):
+    us = lambda cycles: '-' if cycles is None else '%.1f' % (cycles * 1e6 / f_cpu)
+    cycles = lambda value: '-' if value is None else str(value)
+    print('%.1f s simulated at %d Hz (activity: %s)' % (results['cycles'] / f_cpu, f_cpu, results['activity']))
+    print('active %s%% of the cycles (%d sleeping)' % (results['active_percent'], results['sleep_cycles']))
+    print()
+    print('%-22s %7s %9s %9s %9s %9s %9s %9s  %s' % ('vector', 'count', 'lat.max', 'lat.mean', 'us.max',
+                                                      'exec.max', 'exec.mean', 'us.max', 'worst queued at'))
+    for name, vector in sorted(results['vectors'].items(), key=lambda item: item[1]['vector']):
+        print('%-22s %7d %9s %9s %9s %9s %9s %9s  %s' % (
+            name, vector['count'], cycles(vector['latency_worst'] if vector['count'] else None),
+            cycles(vector['latency_mean']), us(vector['latency_worst'] if vector['count'] else None),
+            cycles(vector['exec_worst'] if vector['count'] else None), cycles(vector['exec_mean']),
+            us(vector['exec_worst'] if vector['count'] else None), vector['worst_queued_at'] or 'not triggered'))
+    print()
+    print('%-40s %7s %9s %9s' % ('interrupts disabled from', 'count', 'max', 'us.max'))
+    for window in results['windows'][:top]:
+        print('%-40s %7d %9d %9s' % (window['start'], window['count'], window['worst'], us(window['worst'])))
+
+
+def run_variant(args, f_cpu):
+    """Builds the firmware of a variant and runs it in the harness, returns its results."""
+    build_dir = tempfile.mkdtemp(prefix='isr_')
+    try:
+        firmware = bench.build_firmware(args, build_dir)
+        code_symbols = symbols(bench.run([args.nm, '-n', firmware]))
+        harness = build_harness(args, build_dir)
+        cmd = [harness, firmware, str(f_cpu), str(args.seconds), str(args.seed), args.activity]
+        cmd += ['%d:%x' % (number, address) for number, address in vectors(code_symbols)]
+        result = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+        if result.returncode != 0:
+            sys.exit('isr: the firmware crashed or the harness failed\n' + result.stdout)
+    finally:
+        shutil.rmtree(build_dir, ignore_errors=True)
+
+    results = parse(result.stdout, code_symbols, bench.vector_names())
+    results.update({'f_cpu': f_cpu, 'seconds': args.seconds, 'seed': args.seed, 'activity': args.activity,
+                    'heater_isr': args.heater_isr, 'exti_isr': args.exti_isr, 'idle_mode': args.idle_mode})
+    return results
+
+
+def report_bindings(title, names, variants, f_cpu):
+    """The vectors (names) of both bindings (same seed: same activity)."""
+    us = lambda cycles: '-' if cycles is None else '%.1f' % (cycles * 1e6 / f_cpu)
+    print()
+    print('%-22s %-12s %7s %9s %9s %9s %9s' % (title, 'variant', 'count', 'lat.max', 'exec.max', 'exec.mean',
+                                              'us.max'))
+    for name in names:
+        for variant, results in variants:
+            vector = results['vectors'].get(name)
+            if vector is None or not vector['count']:
+                print('%-22s %-12s %7s' % (name, variant, 'not triggered'))
+                continue
+            print('%-22s %-12s %7d %9d %9d %9s %9s' % (name, variant, vector['count'], vector['latency_worst'],
+                                                       vector['exec_worst'], vector['exec_mean'],
+                                                       us(vector['exec_worst'])))
+
+
+def report_active(variants, f_cpu):
+    """The active cycles of the idle modes (same seed: same activity)."""
+    print()
+    print('%-12s %-9s %9s %14s' % ('variant', 'idle', 'active %', 'active cyc/s'))
+    for variant, results in variants:
+        seconds = results['cycles'] / f_cpu
+        active = results['cycles'] - results['sleep_cycles']
+        print('%-12s %-9s %9s %14d' % (variant, results['idle_mode'], results['active_percent'],
+                                       active / seconds if seconds else 0))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Worst-case ISR latency and execution time (simavr).')
+    parser.add_argument('--cc', default='avr-gcc')
+    parser.add_argument('--nm', default='avr-nm')
+    parser.add_argument('--host-cc', default='cc')
+    parser.add_argument('--simavr-include', default=None, help='directory of sim_avr.h (simavr/sim)')
+    parser.add_argument('--simavr-lib', default=None, help='directory of libsimavr')
+    parser.add_argument('--seconds', type=int, default=30, help='simulated time')
+    parser.add_argument('--seed', type=int, default=1, help='seed of the random activity')
+    parser.add_argument('--windows', type=int, default=10, help='number of interrupts-disabled windows to list')
+    parser.add_argument('--json', default=None, help='write the results to this file')
+    parser.add_argument('--heater-isr', choices=('app', 'driver', 'both'), default='app',
+                        help='the binding of the heater ISRs TIMER1_COMPA/COMPB (both: two runs, compared)')
+    parser.add_argument('--exti-isr', choices=('driver', 'app', 'both'), default='driver',
+                        help='the binding of the EXTI ISRs INT0/INT1/INT2 (both: two runs, compared)')
+    parser.add_argument('--idle-mode', choices=('sleep', 'spin', 'both'), default='sleep',
+                        help='the idle function of main.c: IDLE_SLEEP or IDLE_SPIN (both: two runs, compared)')
+    parser.add_argument('--activity', choices=('random', 'none'), default='random',
+                        help='none: no user action, the oven stays in standby (IDLE_OFF_STATE)')
+    args = parser.parse_args()
+
+    f_cpu = bench.f_cpu()
+    heater_isrs = ('app', 'driver') if args.heater_isr == 'both' else (args.heater_isr,)
+    exti_isrs = ('driver', 'app') if args.exti_isr == 'both' else (args.exti_isr,)
+    idle_modes = ('sleep', 'spin') if args.idle_mode == 'both' else (args.idle_mode,)
+    variants = []
+    for heater_isr in heater_isrs:
+        for exti_isr in exti_isrs:
+            for idle_mode in idle_modes:
+                variant = '/'.join(name for name, count in (('heater-' + heater_isr, len(heater_isrs)),
+                                                            ('exti-' + exti_isr, len(exti_isrs)),
+                                                            (idle_mode, len(idle_modes)))
+                                   if count > 1) or heater_isr
+                results = run_variant(argparse.Namespace(**dict(vars(args), heater_isr=heater_isr, exti_isr=exti_isr,
+                                                                idle_mode=idle_mode)), f_cpu)
+                if len(heater_isrs) * len(exti_isrs) * len(idle_modes) > 1:
+                    print('== %s' % variant)
+                report(results, f_cpu, args.windows)
+                variants.append((variant, results))
+    if len(heater_isrs) > 1:
+        report_bindings('heater ISR', ('TIMER1_COMPA_VECT', 'TIMER1_COMPB_VECT'), variants, f_cpu)
+    if len(exti_isrs) > 1:
+        report_bindings('EXTI ISR', ('INT0_VECT', 'INT1_VECT', 'INT2_VECT'), variants, f_cpu)
+    if len(idle_modes) > 1:
+        report_active(variants, f_cpu)
+    if args.json:
+        with open(args.json, 'w') as f:
+            output = variants[0][1] if len(variants) == 1 else dict(variants)
+            f.write(json.dumps(output, indent=2, sort_keys=True) + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,514 @@
+/**
+ * @file isr_latency.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the ISR latency and execution time harness: the firmware image runs in simavr
+ *         (cycle exact) under random oven activity and every interrupt is measured.
+ *
+ *         - latency  : from the cycle the interrupt is queued (flag set while enabled) to the first instruction
+ *                      of its ISR (includes the interrupts-disabled windows, the ISRs running, the wake-up,
+ *                      the 4 cycles of response and the jmp of the vector table).
+ *         - execution: from the first instruction of the ISR to the end of its reti (nested ISRs included).
+ *         - the interrupts-disabled windows of the main context (cli ... sei / SREG restore), by start address.
+ *         - the sleeping cycles (sleep instruction to the wake-up): the rest of the cycles are the active ones.
+ *
+ *         The activity is random but reproducible (seed): keypad keys, start/stop buttons, door and weight sensor
+ *         on the wiring of the plant simulator (PLANT_Lcfg.h), the turntable encoder pulses while the motor is ON.
+ *         With the activity "none" there is no user action: the oven stays in standby (IDLE_OFF_STATE).
+ *
+ *         It is built and run by isr.py, the output lines are:
+ *           ISR <vector> <count> <worst latency> <sum latency> <worst exec> <sum exec> <pc when the worst was queued>
+ *           CLI <start pc> <count> <worst cycles>
+ *           SLEEP <sleeping cycles>
+ *           END <cycles>
+ *
+ * @par Usage:
+ *   isr_latency <firmware.elf> <F_CPU> <seconds> <seed> <random|none> <vector number>:<ISR byte address> ...
+ * @see isr.py
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// simavr
+#include "sim_avr.h"
+#include "sim_elf.h"
+#include "sim_interrupts.h"
+#include "avr_ioport.h"
+
+// lib
+#include "Std_Types.h"
+#include "Utils_BitMath.h"
+
+// MCAL
+#include "DIO_Interface.h"
+
+// HAL
+#include "Keypad_Lcfg.h"
+#include "Keypad_private.h"
+#include "Turntable_Lcfg.h"
+
+// host port: the wiring of the oven
+#include "PLANT_Lcfg.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define ISR_MCU                   "atmega32"
+#define ISR_FLASH_SIZE            0x8000
+#define ISR_MAX_VECTORS           21
+#define ISR_MAX_NESTING           8
+#define ISR_MAX_WINDOWS           32
+#define ISR_NONE                  ((u64)-1)
+#define ISR_RETI                  0x9518
+
+#define ISR_PORT(pin)             ((u8)((pin)/8))
+#define ISR_BIT(pin)              ((u8)((pin)%8))
+#define ISR_PORT_REG(port)        (0x3B-(3*(port)))   /*< data address of PORTx, DDRx is below it */
+
+#define ISR_ENCODER_PIN           PD6                 /*< ICP1 */
+#define ISR_NO_KEY                0
+#define ISR_IDLE_MIN_MS           100
+#define ISR_IDLE_MAX_MS           1500
+#define ISR_ENCODER_HALF_MS       (600000UL/(PLANT_TURNTABLE_RPM_X10*TURNTABLE_PULSES_PER_REV)/2)
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef struct
+{
+	u8 number;                    /**< vector number (__vector_N) */
+	u32 address;                  /**< byte address of the ISR */
+	u64 queued;                   /**< cycle of the pending request, ISR_NONE when none */
+	u16 queuedPc;                 /**< PC when the request was queued */
+	u32 count;
+	u32 worstLatency;
+	u64 sumLatency;
+	u16 worstPc;                  /**< PC when the worst request was queued */
+	u32 worstExec;
+	u64 sumExec;
+}ISR_Vector_t;
+
+typedef struct
+{
+	ISR_Vector_t *vector;
+	u64 entry;                    /**< cycle of the first instruction of the ISR */
+}ISR_Active_t;
+
+typedef struct
+{
+	u16 pc;                       /**< address of the first instruction with the interrupts disabled */
+	u32 count;
+	u32 worst;
+}ISR_Window_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static avr_t *ISR_pAvr;
+static ISR_Vector_t ISR_arrVectors[ISR_MAX_VECTORS];
+static u8 ISR_u8VectorsCount;
+static u8 ISR_au8VectorAt[ISR_FLASH_SIZE/2];       /*< index+1 of the vector whose ISR starts at the word address */
+
+static ISR_Active_t ISR_arrActive[ISR_MAX_NESTING];
+static u8 ISR_u8Depth;
+
+static ISR_Window_t ISR_arrWindows[ISR_MAX_WINDOWS];
+static u8 ISR_u8WindowsCount;
+static u64 ISR_u64WindowStart=ISR_NONE;
+static u16 ISR_u16WindowPc;
+
+static u32 ISR_u32Random;
+static u8 ISR_u8Key=ISR_NO_KEY;
+static u8 ISR_au8Levels[4]={0xFF,0xFF,0xFF,0xFF};  /*< external levels of the ports (pull-ups: high) */
+
+static u64 ISR_u64SleepCycles;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief xorshift32: reproducible random numbers from the seed.
+ */
+static u32 ISR_Random(void)
+{
+	ISR_u32Random^=ISR_u32Random<<13;
+	ISR_u32Random^=ISR_u32Random>>17;
+	ISR_u32Random^=ISR_u32Random<<5;
+	return ISR_u32Random;
+}
+
+static u64 ISR_MsToCycles(u32 ms)
+{
+	return ((u64)ms*ISR_pAvr->frequency)/1000;
+}
+
+/**
+ * @brief Sets the external level of an input pin (raises its simavr IRQ when it changes).
+ */
+static void ISR_SetPin(u8 pin, u8 level)
+{
+	u8 levels=ISR_au8Levels[ISR_PORT(pin)];
+
+	if (level==0)
+	{
+		clear_bit(levels,ISR_BIT(pin));
+	}
+	else
+	{
+		set_bit(levels,ISR_BIT(pin));
+	}
+	if (levels!=ISR_au8Levels[ISR_PORT(pin)])
+	{
+		ISR_au8Levels[ISR_PORT(pin)]=levels;
+		avr_raise_irq(avr_io_getirq(ISR_pAvr,AVR_IOCTL_IOPORT_GETIRQ('A'+ISR_PORT(pin)),ISR_BIT(pin)),level);
+	}
+}
+
+/**
+ * @brief Returns the level of a pin: driven by the firmware when it is an output, external otherwise.
+ */
+static u8 ISR_GetPin(u8 pin)
+{
+	u8 port=ISR_PORT(pin);
+	u8 level;
+
+	if (get_bit(ISR_pAvr->data[ISR_PORT_REG(port)-1],ISR_BIT(pin))==1)
+	{
+		level=get_bit(ISR_pAvr->data[ISR_PORT_REG(port)],ISR_BIT(pin));
+	}
+	else
+	{
+		level=get_bit(ISR_au8Levels[port],ISR_BIT(pin));
+	}
+	return level;
+}
+
+/**
+ * @brief The keypad matrix: a column is low while the pressed key's row is low.
+ */
+static void ISR_Keypad(void)
+{
+	u8 row;
+	u8 col;
+	u8 level;
+
+	for (col=0; col<COLS; col++)
+	{
+		level=1;
+		for (row=0; row<ROWS; row++)
+		{
+			if ((ISR_u8Key!=ISR_NO_KEY) && (keypad_charArray[row][col]==ISR_u8Key) &&
+			    (ISR_GetPin(keypad_pinMap.kEYPAD_rows[row])==0))
+			{
+				level=0;
+			}
+		}
+		ISR_SetPin(keypad_pinMap.kEYPAD_cols[col],level);
+	}
+}
+
+/**
+ * @brief Starts a random action of the user, returns the cycle of its release.
+ */
+static u64 ISR_Action(u64 now)
+{
+	u32 action=ISR_Random()%100;
+	u8 row;
+	u8 col;
+
+	if (action<40)
+	{
+		do
+		{
+			row=(u8)(ISR_Random()%ROWS);
+			col=(u8)(ISR_Random()%COLS);
+		}while (keypad_charArray[row][col]=='\0');
+		ISR_u8Key=keypad_charArray[row][col];
+	}
+	else if (action<60)
+	{
+		ISR_SetPin(PLANT_START_PIN,0);
+	}
+	else if (action<70)
+	{
+		ISR_SetPin(PLANT_STOP_PIN,0);
+	}
+	else if (action<85)
+	{
+		ISR_SetPin(PLANT_DOOR_PIN,(u8)(ISR_GetPin(PLANT_DOOR_PIN)^1));
+	}
+	else
+	{
+		ISR_SetPin(PLANT_WEIGHT_PIN,(u8)(ISR_GetPin(PLANT_WEIGHT_PIN)^1));
+	}
+	return now+ISR_MsToCycles(PLANT_PRESS_MS);
+}
+
+/**
+ * @brief Releases the key and the buttons.
+ */
+static void ISR_Release(void)
+{
+	ISR_u8Key=ISR_NO_KEY;
+	ISR_SetPin(PLANT_START_PIN,1);
+	ISR_SetPin(PLANT_STOP_PIN,1);
+	ISR_Keypad();
+}
+
+/**
+ * @brief simavr IRQ callback of a vector: queued (1) or serviced (0).
+ */
+static void ISR_Pending(struct avr_irq_t *irq, uint32_t value, void *param)
+{
+	ISR_Vector_t *vector=(ISR_Vector_t *)param;
+
+	(void)irq;
+	if ((value==1) && (vector->queued==ISR_NONE))
+	{
+		vector->queued=ISR_pAvr->cycle;
+		vector->queuedPc=(u16)ISR_pAvr->pc;
+	}
+}
+
+/**
+ * @brief Registers the measured vectors (argv: <number>:<address>).
+ */
+static Std_Error_t ISR_AddVectors(int argc, char *argv[])
+{
+	Std_Error_t error=STD_OK;
+	avr_int_vector_t *simVector;
+	ISR_Vector_t *vector;
+	unsigned number;
+	unsigned address;
+	int i;
+	u8 j;
+
+	for (i=0; (i<argc) && (error==STD_OK); i++)
+	{
+		if ((sscanf(argv[i],"%u:%x",&number,&address)!=2) || (ISR_u8VectorsCount>=ISR_MAX_VECTORS) ||
+		    (address>=ISR_FLASH_SIZE))
+		{
+			error=STD_INVALID_ARG;
+		}
+		else
+		{
+			vector=&ISR_arrVectors[ISR_u8VectorsCount];
+			vector->number=(u8)number;
+			vector->address=address;
+			vector->queued=ISR_NONE;
+			ISR_au8VectorAt[address/2]=++ISR_u8VectorsCount;
+			for (j=0; j<ISR_pAvr->interrupts.vector_count; j++)
+			{
+				simVector=ISR_pAvr->interrupts.vector[j];
+				if (simVector->vector==number)
+				{
+					avr_irq_register_notify(simVector->irq+AVR_INT_IRQ_PENDING,ISR_Pending,vector);
+				}
+			}
+		}
+	}
+	return error;
+}
+
+/**
+ * @brief Records an interrupts-disabled window of the main context.
+ */
+static void ISR_Window(u16 pc, u32 cycles)
+{
+	u8 i;
+
+	for (i=0; (i<ISR_u8WindowsCount) && (ISR_arrWindows[i].pc!=pc); i++)
+	{
+	}
+	if (i<ISR_MAX_WINDOWS)
+	{
+		if (i==ISR_u8WindowsCount)
+		{
+			ISR_u8WindowsCount++;
+			ISR_arrWindows[i].pc=pc;
+		}
+		ISR_arrWindows[i].count++;
+		if (cycles>ISR_arrWindows[i].worst)
+		{
+			ISR_arrWindows[i].worst=cycles;
+		}
+	}
+}
+
+/**
+ * @brief Accounts the instruction executed at (pc) by the last avr_run() that started at (start).
+ */
+static void ISR_Step(avr_flashaddr_t pc, u64 start)
+{
+	avr_t *avr=ISR_pAvr;
+	ISR_Vector_t *vector;
+	u32 cycles;
+	u8 index;
+
+	if ((ISR_u8Depth>0) && ((avr->flash[pc]|(avr->flash[pc+1]<<8))==ISR_RETI))
+	{
+		ISR_u8Depth--;
+		vector=ISR_arrActive[ISR_u8Depth].vector;
+		cycles=(u32)(avr->cycle-ISR_arrActive[ISR_u8Depth].entry);
+		vector->sumExec+=cycles;
+		if (cycles>vector->worstExec)
+		{
+			vector->worstExec=cycles;
+		}
+	}
+
+	index=(avr->pc<ISR_FLASH_SIZE)? ISR_au8VectorAt[avr->pc/2] : 0;
+	if ((index>0) && (ISR_u8Depth<ISR_MAX_NESTING))
+	{
+		vector=&ISR_arrVectors[index-1];
+		ISR_arrActive[ISR_u8Depth].vector=vector;
+		ISR_arrActive[ISR_u8Depth].entry=avr->cycle;
+		ISR_u8Depth++;
+		vector->count++;
+		if (vector->queued!=ISR_NONE)
+		{
+			cycles=(u32)(avr->cycle-vector->queued);
+			vector->sumLatency+=cycles;
+			if (cycles>vector->worstLatency)
+			{
+				vector->worstLatency=cycles;
+				vector->worstPc=vector->queuedPc;
+			}
+			vector->queued=ISR_NONE;
+		}
+	}
+
+	/* the vector table and the ISRs run with the interrupts disabled by the hardware,
+	   a window ends when the interrupts are enabled or a request is serviced */
+	if (ISR_u8Depth==0)
+	{
+		if ((avr->sreg[S_I]==0) && (avr->pc>=(avr->vector_size*ISR_MAX_VECTORS)))
+		{
+			if (ISR_u64WindowStart==ISR_NONE)
+			{
+				ISR_u64WindowStart=start;
+				ISR_u16WindowPc=(u16)pc;
+			}
+		}
+		else if (ISR_u64WindowStart!=ISR_NONE)
+		{
+			ISR_Window(ISR_u16WindowPc,(u32)(avr->cycle-ISR_u64WindowStart));
+			ISR_u64WindowStart=ISR_NONE;
+		}
+	}
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+	elf_firmware_t firmware;
+	avr_flashaddr_t pc;
+	u64 start;
+	u64 end;
+	u64 nextAction;
+	u64 release=ISR_NONE;
+	u64 nextEdge=0;
+	u8 encoder=0;
+	int state=cpu_Running;
+	Std_Bool_t isSleeping;
+	u8 i;
+
+	if ((argc<7) || ((strcmp(argv[5],"random")!=0) && (strcmp(argv[5],"none")!=0)))
+	{
+		fprintf(stderr,"usage: %s <firmware.elf> <F_CPU> <seconds> <seed> <random|none> <vector>:<address> ...\n",
+		        argv[0]);
+		return 2;
+	}
+	memset(&firmware,0,sizeof(firmware));
+	if (elf_read_firmware(argv[1],&firmware)!=0)
+	{
+		fprintf(stderr,"can't read %s\n",argv[1]);
+		return 2;
+	}
+	strcpy(firmware.mmcu,ISR_MCU);
+	firmware.frequency=(uint32_t)strtoul(argv[2],NULL,10);
+	ISR_pAvr=avr_make_mcu_by_name(ISR_MCU);
+	avr_init(ISR_pAvr);
+	avr_load_firmware(ISR_pAvr,&firmware);
+	ISR_u32Random=(u32)strtoul(argv[4],NULL,10)|1;
+	if (ISR_AddVectors(argc-6,&argv[6])!=STD_OK)
+	{
+		fprintf(stderr,"bad vector argument\n");
+		return 2;
+	}
+
+	/* closed door, food on the scale, buttons and keys released */
+	ISR_SetPin(PLANT_DOOR_PIN,0);
+	ISR_SetPin(PLANT_WEIGHT_PIN,0);
+	ISR_Release();
+
+	end=(u64)strtoul(argv[3],NULL,10)*ISR_pAvr->frequency;
+	nextAction=(strcmp(argv[5],"none")==0)? ISR_NONE : ISR_MsToCycles(ISR_IDLE_MAX_MS);
+	while ((ISR_pAvr->cycle<end) && (state!=cpu_Done) && (state!=cpu_Crashed))
+	{
+		pc=ISR_pAvr->pc;
+		start=ISR_pAvr->cycle;
+		isSleeping=(ISR_pAvr->state==cpu_Sleeping)? STD_TRUE : STD_FALSE;
+		state=avr_run(ISR_pAvr);
+		if (isSleeping==STD_TRUE)
+		{
+			ISR_u64SleepCycles+=ISR_pAvr->cycle-start; /*< simavr jumps to the next timer event */
+		}
+		ISR_Step(pc,start);
+
+		if (ISR_pAvr->cycle>=nextAction)
+		{
+			release=ISR_Action(ISR_pAvr->cycle);
+			nextAction=release+ISR_MsToCycles(ISR_IDLE_MIN_MS+(ISR_Random()%(ISR_IDLE_MAX_MS-ISR_IDLE_MIN_MS)));
+		}
+		if (ISR_pAvr->cycle>=release)
+		{
+			ISR_Release();
+			release=ISR_NONE;
+		}
+		if (ISR_u8Key!=ISR_NO_KEY)
+		{
+			ISR_Keypad(); /*< follows the row scan */
+		}
+		if (ISR_pAvr->cycle>=nextEdge)
+		{
+			encoder=(ISR_GetPin(PLANT_MOTOR_PIN)==1)? (u8)(encoder^1) : 0;
+			ISR_SetPin(ISR_ENCODER_PIN,encoder);
+			nextEdge=ISR_pAvr->cycle+ISR_MsToCycles(ISR_ENCODER_HALF_MS);
+		}
+	}
+
+	for (i=0; i<ISR_u8VectorsCount; i++)
+	{
+		printf("ISR %u %lu %lu %llu %lu %llu 0x%x\n",ISR_arrVectors[i].number,(unsigned long)ISR_arrVectors[i].count,
+		       (unsigned long)ISR_arrVectors[i].worstLatency,(unsigned long long)ISR_arrVectors[i].sumLatency,
+		       (unsigned long)ISR_arrVectors[i].worstExec,(unsigned long long)ISR_arrVectors[i].sumExec,
+		       ISR_arrVectors[i].worstPc);
+	}
+	for (i=0; i<ISR_u8WindowsCount; i++)
+	{
+		printf("CLI 0x%x %lu %lu\n",ISR_arrWindows[i].pc,(unsigned long)ISR_arrWindows[i].count,
+		       (unsigned long)ISR_arrWindows[i].worst);
+	}
+	printf("SLEEP %llu\n",(unsigned long long)ISR_u64SleepCycles);
+	printf("END %llu\n",(unsigned long long)ISR_pAvr->cycle);
+	return ((state==cpu_Crashed)? 1 : 0);
+}
@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+"""Decoder of the trace recorder of the microwave oven firmware (04-Services/08-Trace).
+
+Reads a dump of TRACE_Log (or of the whole SRAM, the log is found by its magic) and prints the records
+as a timeline, the oldest first:
+
+     time (ms)     delta   event                  arg
+             0         -   TRACE_RESET            POWER_ON
+          1290     +1290   TRACE_KEY              '1'
+     ...
+
+The names of the events, of the states, of the state machine events and of the reset flags are read from
+the sources of 02-code (TRACE_Lcfg.h, main.c, WDT_Interface.h), the tick of the deltas from UPTIME_Lcfg.h.
+A delta of 65535 ticks means 65535 or more (the recorder saturates): the times after it are marked with '>='.
+The records written since the last tick are not stamped yet: they are stamped as the next tick would do it
+(the first one gets the delta of the log, the next ones 0).
+
+Usage:
+  (avr-gdb) dump binary value trace.bin TRACE_Log
+  python3 trace_decode.py trace.bin
+  python3 trace_decode.py --hex sram.txt          # a text dump of hex bytes (the addresses are ignored)
+  python3 trace_decode.py --json trace.json trace.bin
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+CODE = os.path.normpath(os.path.join(HERE, '..', '..', '02-code'))
+
+# the layout of TRACE_Log_t and of a record (TRACE_Interface.h, packed: -fpack-struct)
+HEADER = struct.Struct('<HHBBB')   # magic, delta, size, head (| frozen flag), stamped
+RECORD = struct.Struct('<HBB')     # delta, event, arg
+MAGIC = 0x5254
+MAX_DELTA = 0xFFFF
+
+
+def source(*path):
+    with open(os.path.join(CODE, *path), errors='replace') as f:
+        return f.read()
+
+
+def enum_names(text, name):
+    """The members of the typedef enum (name) of a C source, by value (no explicit values)."""
+    match = re.search(r'typedef\s+enum\s*\{([^}]*)\}\s*' + name + r'\s*;', text)
+    if not match:
+        sys.exit('trace_decode: typedef enum %s not found' % name)
+    body = re.sub(r'/\*.*?\*/|//[^\n]*', '', match.group(1), flags=re.S)
+    return [member.strip() for member in body.split(',') if member.strip()]
+
+
+def reset_flags():
+    text = source('02-MCAL', '05-WDT', 'WDT_Interface.h')
+    return [(int(value, 16), name) for name, value in
+            re.findall(r'#define\s+WDT_RESET_(\w+)\s+(0x[0-9A-Fa-f]+)', text)]
+
+
+def tick_ms():
+    """The tick of the uptime service, the unit of the deltas."""
+    text = source('04-Services', '03-Uptime', 'UPTIME_Lcfg.h')
+    return int(re.search(r'#define\s+UPTIME_TICK_MS\s+(\d+)', text).group(1))
+
+
+def read_dump(path, is_hex):
+    if is_hex:
+        with open(path) as f:
+            words = re.findall(r'\b(?:0x)?([0-9A-Fa-f]{2})\b', re.sub(r'^[^:\n]*:', '', f.read(), flags=re.M))
+        return bytes(int(word, 16) for word in words)
+    with open(path, 'rb') as f:
+        return f.read()
+
+
+def find_log(data):
+    """Returns the header and the records of the first valid log of the dump."""
+    start = 0
+    while True:
+        offset = data.find(struct.pack('<H', MAGIC), start)
+        if offset < 0 or offset + HEADER.size > len(data):
+            sys.exit('trace_decode: no valid TRACE_Log in the dump (magic 0x%04X)' % MAGIC)
+        magic, delta, size, head, stamped = HEADER.unpack_from(data, offset)
+        ring = size * RECORD.size
+        end = offset + HEADER.size + ring
+        valid = (size in (2, 4, 8, 16, 32) and end <= len(data) and
+                 head & ~(ring | (ring - 1)) == 0 and head % RECORD.size == 0 and
+                 stamped < ring and stamped % RECORD.size == 0)
+        if valid:
+            header = {'size': size, 'frozen': head & ring != 0, 'oldest': head & (ring - 1),
+                      'stamped': stamped, 'delta': delta}
+            return header, stamp(header, bytearray(data[offset + HEADER.size:end]))
+        start = offset + 1
+
+
+def stamp(header, ring):
+    """Stamps the records written since the last tick as TRACE_STAMP() (TRACE_Interface.h)."""
+    offset = header['stamped']
+    delta = header['delta']
+    while offset != header['oldest']:
+        struct.pack_into('<H', ring, offset, delta)
+        delta = 0
+        offset = (offset + RECORD.size) % len(ring)
+    if header['stamped'] != header['oldest']:
+        header['delta'] = 0
+    return ring
+
+
+def decode(header, ring, names):
+    """The records the oldest first, with their time since the oldest one."""
+    events = names['events']
+    records = []
+    ms = 0
+    is_lower_bound = False
+    size = header['size'] * RECORD.size
+    for i in range(header['size']):
+        delta, event, arg = RECORD.unpack_from(ring, (header['oldest'] + i * RECORD.size) % size)
+        if event == 0:
+            continue  # TRACE_NONE: an empty record
+        if records:
+            step = delta * names['tick_ms']
+            is_lower_bound = is_lower_bound or delta == MAX_DELTA
+            ms += step
+        else:
+            step = None  # the time before the oldest record is unknown
+        name = events[event] if event < len(events) else 'EVENT_%d' % event
+        records.append({'ms': ms, 'step_ms': step,
+                        'lower_bound': is_lower_bound, 'event': name, 'arg': arg,
+                        'text': argument(name, arg, names)})
+    return records
+
+
+def argument(event, arg, names):
+    def name(table, value):
+        return table[value] if value < len(table) else str(value)
+    if event == 'TRACE_RESET':
+        return '|'.join(flag for value, flag in names['resets'] if arg & value) or '0x%02X' % arg
+    if event == 'TRACE_EVENT':
+        return name(names['transitions'], arg)
+    if event == 'TRACE_STATE':
+        return name(names['states'], arg)
+    if event == 'TRACE_ONOFF':
+        return {0: 'OFF', 1: 'ON'}.get(arg, str(arg))
+    if event == 'TRACE_KEY':
+        return repr(chr(arg)) if 0x20 <= arg < 0x7F else '0x%02X' % arg
+    if event == 'TRACE_HEATER_ISR':
+        return {0: 'heater OFF', 1: 'heater ON'}.get(arg, str(arg))
+    if event == 'TRACE_STACK_OVERFLOW':
+        return 'priority %d' % arg
+    if event == 'TRACE_INIT_FAILED':
+        return 'error %d' % arg
+    return '' if arg == 0 else str(arg)
+
+
+def report(header, records):
+    print('TRACE_Log: %d records of %d%s' % (len(records), header['size'],
+                                             ', frozen (fault)' if header['frozen'] else ''))
+    print('%12s %9s   %-22s %s' % ('time (ms)', 'delta', 'event', 'arg'))
+    for record in records:
+        mark = '>=' if record['lower_bound'] else ''
+        step = '-' if record['step_ms'] is None else '+%d' % record['step_ms']
+        print('%12s %9s   %-22s %s' % (mark + '%d' % record['ms'], step, record['event'], record['text']))
+    print('%d ticks or more since the last record' % header['delta'] if header['delta'] == MAX_DELTA else
+          '%d ticks since the last record' % header['delta'])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('dump', help='a dump of TRACE_Log or of the SRAM')
+    parser.add_argument('--hex', action='store_true', help='the dump is a text of hex bytes')
+    parser.add_argument('--json', help='also write the records as JSON')
+    args = parser.parse_args()
+
+    main_c = source('main.c')
+    names = {'events': enum_names(source('04-Services', '08-Trace', 'TRACE_Lcfg.h'), 'TRACE_EventId_t'),
+             'states': enum_names(main_c, 'STATE_t'),
+             'transitions': enum_names(main_c, 'TRANSATION_t'),
+             'resets': reset_flags(),
+             'tick_ms': tick_ms()}
+    header, ring = find_log(read_dump(args.dump, args.hex))
+    records = decode(header, ring, names)
+    report(header, records)
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({'log': header, 'records': records}, f, indent=2)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,99 @@
+/**
+ * @file fuzz.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the harness of the state machine fuzzer (FUZZ_Interface.h): it fuzzes the firmware with
+ *         a seed and a number of executions, prints the statistics and, on a violation, the sequence that leads to it
+ *         as a scenario file (plant_run.c) to replay it and keep it as a regression test.
+ *
+ * @par Usage:
+ *   @code
+ *    fuzz                   # FUZZ_EXECUTIONS executions, seed FUZZ_SEED
+ *    fuzz 100000 7          # <executions> <seed>
+ *   @endcode
+ * @see Makefile (make fuzz)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// lib
+#include "Std_Types.h"
+
+// host port
+#include "PLANT_Interface.h"
+#include "FUZZ_Lcfg.h"
+#include "FUZZ_Interface.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#ifndef FUZZ_EXECUTIONS
+#define FUZZ_EXECUTIONS           2000UL
+#endif
+#ifndef FUZZ_SEED
+#define FUZZ_SEED                 1UL
+#endif
+
+/* the tail of the replay after the violation (ms) */
+#define FUZZ_REPLAY_TAIL_MS       1000
+
+void FIRMWARE_main(void);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+	static const char *const actions[]={ "DOOR" , "FOOD" , "START" , "STOP" , "KEY" , "JAM" };
+	static const char *const violations[]={ "none" , "heater ON with the door opened" , "TIMER1 running out of ON_STATE" };
+	u32 executions=(argc>1)? (u32)strtoul(argv[1],NULL_PTR,0) : FUZZ_EXECUTIONS;
+	u32 seed=(argc>2)? (u32)strtoul(argv[2],NULL_PTR,0) : FUZZ_SEED;
+	FUZZ_Stats_t stats;         /*< on the stack: the statics are part of the snapshots */
+	FUZZ_Failure_t failure;
+	Std_Error_t error;
+	u8 i;
+
+	error=FUZZ_Run(executions,seed,FIRMWARE_main,&stats,&failure);
+	printf("seed %lu: %lu executions, %lu virtual s, corpus %u, coverage %u\n",(unsigned long)seed,
+	       (unsigned long)stats.executions,(unsigned long)(stats.virtualMs/1000),stats.corpus,stats.coverage);
+
+	if (error==STD_NOK)
+	{
+		printf("VIOLATION %s at %lu ms, the scenario:\n",violations[failure.violation],(unsigned long)failure.timeMs);
+		printf("duration %lu\n",(unsigned long)(failure.timeMs+FUZZ_REPLAY_TAIL_MS));
+		for (i=0; i<failure.count; i++)
+		{
+			if (failure.script[i].action==PLANT_KEY)
+			{
+				printf("%-6lu KEY   %c\n",(unsigned long)failure.script[i].timeMs,failure.script[i].value);
+			}
+			else if ((failure.script[i].action==PLANT_START) || (failure.script[i].action==PLANT_STOP))
+			{
+				printf("%-6lu %s\n",(unsigned long)failure.script[i].timeMs,actions[failure.script[i].action]);
+			}
+			else
+			{
+				printf("%-6lu %-5s %u\n",(unsigned long)failure.script[i].timeMs,actions[failure.script[i].action],
+				       failure.script[i].value);
+			}
+		}
+	}
+	else if (error!=STD_OK)
+	{
+		printf("FUZZ_Run() error %d\n",error);
+	}
+	else
+	{
+		//no violation
+	}
+	return (error==STD_OK)? 0 : 1;
+}
@@ -0,0 +1,328 @@
+/**
+ * @file plant_run.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the scenario runner of the oven plant simulator (PLANT_Interface.h): it replays a scenario
+ *         file on the firmware, prints the output changes and compares them to a golden trace.
+ *
+ *         A scenario file (scenarios/<name>.scn), one event per line sorted by time, a line that starts
+ *         with '#' is a comment (the key '#' is a value):
+ *           duration  15000          the virtual duration of the run in ms (required)
+ *           tolerance 0              the allowed difference of the time of a change in ms (optional, default 0)
+ *           0     FOOD  1            <time ms> DOOR|FOOD|JAM <0|1>
+ *           500   KEY   1            <time ms> KEY <the character of the key>
+ *           1200  START              <time ms> START|STOP
+ *
+ *         A trace (the output of the runner, scenarios/<name>.golden), one output change per line:
+ *           1330  HEATER|LAMP|MOTOR   <time ms> <the outputs after the change, OFF when none>
+ *
+ * @par Usage:
+ *   @code
+ *    plant_run scenarios/cook.scn                              # prints the trace
+ *    plant_run scenarios/cook.scn scenarios/cook.golden        # exit code 1 when the trace is different
+ *   @endcode
+ * @see Makefile (make test, make golden)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// lib
+#include "Std_Types.h"
+
+// host port
+#include "PLANT_Interface.h"
+#include "PLANT_Lcfg.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define RUN_MAX_EVENTS            255
+#define RUN_LINE_SIZE             128
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+typedef struct
+{
+	const char *name;
+	PLANT_Action_t action;
+}RUN_ActionName_t;
+
+typedef struct
+{
+	const char *name;
+	u8 mask;
+}RUN_OutputName_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static const RUN_ActionName_t RUN_arrActions[]={ { "DOOR"  , PLANT_DOOR  } ,
+                                                  { "FOOD"  , PLANT_FOOD  } ,
+                                                  { "START" , PLANT_START } ,
+                                                  { "STOP"  , PLANT_STOP  } ,
+                                                  { "KEY"   , PLANT_KEY   } ,
+                                                  { "JAM"   , PLANT_JAM   } };
+
+static const RUN_OutputName_t RUN_arrOutputs[]={ { "HEATER" , PLANT_HEATER } ,
+                                                  { "LAMP"   , PLANT_LAMP   } ,
+                                                  { "MOTOR"  , PLANT_MOTOR  } };
+
+static PLANT_Event_t RUN_arrScript[RUN_MAX_EVENTS];
+static PLANT_Trace_t RUN_arrGolden[PLANT_TRACE_SIZE];
+
+void FIRMWARE_main(void);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Exits with the code 2 (a wrong file, not a mismatch).
+ */
+static void RUN_Fail(const char *path, u16 line, const char *message)
+{
+	fprintf(stderr,"%s:%u: %s\n",path,line,message);
+	exit(2);
+}
+
+/**
+ * @brief Reads the next line that is not a comment, returns the number of words (at most 3).
+ */
+static u8 RUN_ReadLine(FILE *file, char words[3][RUN_LINE_SIZE], u16 *line)
+{
+	char text[RUN_LINE_SIZE];
+	u8 count=0;
+	int scanned;
+
+	while ((count==0) && (fgets(text,sizeof(text),file)!=NULL))
+	{
+		(*line)++;
+		text[strcspn(text,"\r\n")]='\0';
+		scanned=sscanf(text,"%127s %127s %127s",words[0],words[1],words[2]);
+		count=((scanned>0) && (words[0][0]!='#'))? (u8)scanned : 0;
+	}
+	return count;
+}
+
+/**
+ * @brief Parses a scenario file, returns the number of events.
+ */
+static u8 RUN_ReadScenario(const char *path, u32 *durationMs, u32 *toleranceMs)
+{
+	FILE *file=fopen(path,"r");
+	char words[3][RUN_LINE_SIZE];
+	u16 line=0;
+	u8 count=0;
+	u8 wordsCount;
+	u8 i;
+	Std_Bool_t isFound;
+
+	if (file==NULL)
+	{
+		RUN_Fail(path,0,"can't open the scenario");
+	}
+	*durationMs=0;
+	*toleranceMs=0;
+	while ((wordsCount=RUN_ReadLine(file,words,&line))>0)
+	{
+		if (strcmp(words[0],"duration")==0)
+		{
+			*durationMs=(u32)strtoul(words[1],NULL,10);
+		}
+		else if (strcmp(words[0],"tolerance")==0)
+		{
+			*toleranceMs=(u32)strtoul(words[1],NULL,10);
+		}
+		else if (count==RUN_MAX_EVENTS)
+		{
+			RUN_Fail(path,line,"too many events");
+		}
+		else
+		{
+			isFound=STD_FALSE;
+			for (i=0; i<(sizeof(RUN_arrActions)/sizeof(RUN_arrActions[0])); i++)
+			{
+				if ((wordsCount>=2) && (strcmp(words[1],RUN_arrActions[i].name)==0))
+				{
+					RUN_arrScript[count].action=RUN_arrActions[i].action;
+					isFound=STD_TRUE;
+				}
+			}
+			if (isFound==STD_FALSE)
+			{
+				RUN_Fail(path,line,"unknown action");
+			}
+			RUN_arrScript[count].timeMs=(u32)strtoul(words[0],NULL,10);
+			if (RUN_arrScript[count].action==PLANT_KEY)
+			{
+				RUN_arrScript[count].value=(wordsCount==3)? (u8)words[2][0] : 0;
+			}
+			else
+			{
+				RUN_arrScript[count].value=(wordsCount==3)? (u8)strtoul(words[2],NULL,10) : 0;
+			}
+			count++;
+		}
+	}
+	fclose(file);
+	if (*durationMs==0)
+	{
+		RUN_Fail(path,line,"no duration");
+	}
+	return count;
+}
+
+/**
+ * @brief Parses a trace file, returns the number of changes.
+ */
+static u8 RUN_ReadTrace(const char *path, PLANT_Trace_t trace[])
+{
+	FILE *file=fopen(path,"r");
+	char words[3][RUN_LINE_SIZE];
+	char *name;
+	u16 line=0;
+	u8 count=0;
+	u8 i;
+	Std_Bool_t isFound;
+
+	if (file==NULL)
+	{
+		RUN_Fail(path,0,"can't open the golden trace");
+	}
+	while (RUN_ReadLine(file,words,&line)>=2)
+	{
+		if (count==PLANT_TRACE_SIZE)
+		{
+			RUN_Fail(path,line,"more changes than PLANT_TRACE_SIZE");
+		}
+		trace[count].timeMs=(u32)strtoul(words[0],NULL,10);
+		trace[count].outputs=0;
+		for (name=strtok(words[1],"|"); name!=NULL; name=strtok(NULL,"|"))
+		{
+			isFound=(strcmp(name,"OFF")==0)? STD_TRUE : STD_FALSE;
+			for (i=0; i<(sizeof(RUN_arrOutputs)/sizeof(RUN_arrOutputs[0])); i++)
+			{
+				if (strcmp(name,RUN_arrOutputs[i].name)==0)
+				{
+					trace[count].outputs|=RUN_arrOutputs[i].mask;
+					isFound=STD_TRUE;
+				}
+			}
+			if (isFound==STD_FALSE)
+			{
+				RUN_Fail(path,line,"unknown output");
+			}
+		}
+		count++;
+	}
+	fclose(file);
+	return count;
+}
+
+/**
+ * @brief Prints a change as a line of a trace file.
+ */
+static void RUN_PrintChange(FILE *stream, const char *prefix, const PLANT_Trace_t *change)
+{
+	u8 i;
+	const char *separator="";
+
+	fprintf(stream,"%s%-7lu ",prefix,(unsigned long)change->timeMs);
+	if (change->outputs==0)
+	{
+		fprintf(stream,"OFF");
+	}
+	for (i=0; i<(sizeof(RUN_arrOutputs)/sizeof(RUN_arrOutputs[0])); i++)
+	{
+		if ((change->outputs&RUN_arrOutputs[i].mask)!=0)
+		{
+			fprintf(stream,"%s%s",separator,RUN_arrOutputs[i].name);
+			separator="|";
+		}
+	}
+	fprintf(stream,"\n");
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+int main(int argc, char *argv[])
+{
+	int result=0;
+	u32 durationMs;
+	u32 toleranceMs;
+	u8 eventsCount;
+	u8 goldenCount=0;
+	u8 traceCount;
+	u8 mismatch;
+	u8 i;
+	const PLANT_Trace_t *trace;
+	const char *name;
+	Std_Error_t error;
+
+	if ((argc!=2) && (argc!=3))
+	{
+		fprintf(stderr,"usage: plant_run <scenario> [<golden trace>]\n");
+		return 2;
+	}
+	eventsCount=RUN_ReadScenario(argv[1],&durationMs,&toleranceMs);
+	if (argc==3)
+	{
+		goldenCount=RUN_ReadTrace(argv[2],RUN_arrGolden);
+	}
+	if (PLANT_Run(RUN_arrScript,eventsCount,durationMs,FIRMWARE_main)!=STD_OK)
+	{
+		RUN_Fail(argv[1],0,"the events are not sorted by time");
+	}
+	traceCount=PLANT_GetTrace(&trace);
+
+	if (argc==2)
+	{
+		name=strrchr(argv[1],'/');
+		printf("# %s: the output changes (time ms, outputs)\n",(name!=NULL)? (name+1) : argv[1]);
+		for (i=0; i<traceCount; i++)
+		{
+			RUN_PrintChange(stdout,"",&trace[i]);
+		}
+	}
+	else
+	{
+		error=PLANT_CompareTrace(RUN_arrGolden,goldenCount,toleranceMs,&mismatch);
+		if (error!=STD_OK)
+		{
+			result=1;
+			printf("%s: the trace is different from %s (tolerance %lums)%s\n",argv[1],argv[2],
+			       (unsigned long)toleranceMs,(error==STD_BUFFER_OVERFLOW)? ", the plant trace is full" : "");
+			if (mismatch<goldenCount)
+			{
+				printf("first difference at change %u\n",mismatch);
+			}
+			for (i=0; i<goldenCount; i++)
+			{
+				RUN_PrintChange(stdout,"  expected ",&RUN_arrGolden[i]);
+			}
+			for (i=0; i<traceCount; i++)
+			{
+				RUN_PrintChange(stdout,"  actual   ",&trace[i]);
+			}
+		}
+	}
+	return result;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file test.h
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the checks of the host tests (test_*.c, built and run by the Makefile).
+ *         A failed check prints its file, line and expression (with the values for TEST_CHECK_EQ()) and the test
+ *         goes on, TEST_RESULT() prints the summary and is the exit code of main(): 0 when every check passed.
+ *
+ * @par Example:
+ *   @code
+ *    int main(void)
+ *    {
+ *        TEST_CHECK(RingBuf_Count(&rb)==0);
+ *        TEST_CHECK_EQ(RingBuf_Push(&rb,5),STD_OK);
+ *        return TEST_RESULT();
+ *    }
+ *   @endcode
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef TEST_H_
+#define TEST_H_
+
+#include <stdio.h>
+#include "Std_Types.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief Checks a condition.
+ */
+#define TEST_CHECK(condition)                                                              \
+	do{ TEST_u32Checks++;                                                                  \
+		if (!(condition))                                                                  \
+		{                                                                                  \
+			TEST_u32Failures++;                                                            \
+			printf("%s:%d: FAIL %s\n",__FILE__,__LINE__,#condition);                      \
+		} }while(0)
+
+/**
+ * @brief Checks that two integer expressions are equal, both values are printed when they are not.
+ */
+#define TEST_CHECK_EQ(actual,expected)                                                     \
+	do{ long long test_actual=(long long)(actual);                                        \
+		long long test_expected=(long long)(expected);                                    \
+		TEST_u32Checks++;                                                                  \
+		if (test_actual!=test_expected)                                                    \
+		{                                                                                  \
+			TEST_u32Failures++;                                                            \
+			printf("%s:%d: FAIL %s == %s (%lld != %lld)\n",__FILE__,__LINE__,#actual,#expected, \
+			       test_actual,test_expected);                                             \
+		} }while(0)
+
+/**
+ * @brief Prints the summary, evaluates to the exit code of the test (0: passed).
+ */
+#define TEST_RESULT()                                                                      \
+	( printf("%s: %lu checks, %lu failed\n",__FILE__,(unsigned long)TEST_u32Checks,               \
+	         (unsigned long)TEST_u32Failures),                                             \
+	  (TEST_u32Failures==0)? 0 : 1 )
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static u32 TEST_u32Checks=0;
+static u32 TEST_u32Failures=0;
+
+#endif /* TEST_H_ */
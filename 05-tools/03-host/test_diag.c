@@ -0,0 +1,188 @@
+/**
+ * @file test_diag.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the test of the diagnostics dump (DISPLAY_DIAG_DUMP, main.c): DIAGNOSTICS_KEY is pressed
+ *         until the dump page, the lines sent over the USART are collected and checked (the header, the loop statistics
+ *         and the histogram of every state, the statistics of the scheduler tasks).
+ *
+ *         The host port has no USART model: the step callback raises the data register empty interrupt while UDRIE is
+ *         set and takes the byte the UDRE ISR wrote in UDR (UDR is cleared before, the dump has no 0 byte).
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+// lib
+#include "Std_Types.h"
+#include "Utils_BitMath.h"
+
+// Services
+#include "PROF_Lcfg.h"
+
+// host port
+#include "HOST_Interface.h"
+#include "PLANT_Interface.h"
+#include "HD44780_Lcfg.h"
+#include "HD44780_Interface.h"
+
+#include "test.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define TEST_UDR_ADDRESS          0x2C        /*< MemMap.h */
+#define TEST_UCSRB_ADDRESS        0x2A
+#define TEST_UCSRB_UDRIE          5
+#define TEST_LOOP_LINES           (1+(2*PROF_LOOP_TAGS))
+#define TEST_TASKS                4           /*< TASK_COUNT of main.c (cooperative scheduler) */
+#define TEST_DUMP_LINES           (TEST_LOOP_LINES+TEST_TASKS)
+#define TEST_TASK_WCET_MAX_US     10000       /*< the LCD delays of the display, far below a wrap of the timestamps */
+#define TEST_LINE_SIZE            80
+#define TEST_DURATION_MS          5000
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* DIAGNOSTICS_KEY: the pages of the states, the stack, then the dump */
+static const PLANT_Event_t TEST_arrScript[]={ { 500  , PLANT_KEY , 'D' } ,
+                                              { 800  , PLANT_KEY , 'D' } ,
+                                              { 1100 , PLANT_KEY , 'D' } ,
+                                              { 1400 , PLANT_KEY , 'D' } ,
+                                              { 1700 , PLANT_KEY , 'D' } ,
+                                              { 2000 , PLANT_KEY , 'D' } ,
+                                              { 2300 , PLANT_KEY , 'D' } };
+
+static char TEST_arrLines[TEST_DUMP_LINES+1][TEST_LINE_SIZE]; /*< one more: no line after the dump */
+static u8 TEST_u8Line=0;
+static u8 TEST_u8Column=0;
+static Std_Bool_t TEST_IsUdreRaised=STD_FALSE;
+
+void FIRMWARE_main(void);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief The step callback of the plant: the transmitter of the USART, one byte per step.
+ */
+static void TEST_Step(void)
+{
+	u8 byte;
+
+	if (TEST_IsUdreRaised==STD_TRUE)
+	{
+		TEST_IsUdreRaised=STD_FALSE;
+		byte=HOST_PeekIo(TEST_UDR_ADDRESS);
+		*HOST_Io8(TEST_UDR_ADDRESS)=0;
+		if ((byte=='\n') && (TEST_u8Line<=TEST_DUMP_LINES))
+		{
+			TEST_u8Line++;
+			TEST_u8Column=0;
+		}
+		else if ((byte!=0) && (byte!='\r') && (TEST_u8Line<=TEST_DUMP_LINES) && (TEST_u8Column<(TEST_LINE_SIZE-1)))
+		{
+			TEST_arrLines[TEST_u8Line][TEST_u8Column]=(char)byte;
+			TEST_u8Column++;
+		}
+		else
+		{
+			//no byte sent
+		}
+	}
+	if (get_bit(HOST_PeekIo(TEST_UCSRB_ADDRESS),TEST_UCSRB_UDRIE)==1)
+	{
+		HOST_RaiseInterrupt(HOST_USART_UDRE);
+		TEST_IsUdreRaised=STD_TRUE; /*< the ISR runs in the step */
+	}
+}
+
+/**
+ * @brief Reads the number after the prefix in the line, -1 when the prefix is not found.
+ */
+static long TEST_Field(const char *line, const char *prefix)
+{
+	const char *found=strstr(line,prefix);
+
+	return (found!=NULL)? strtol(found+strlen(prefix),NULL,10) : -1;
+}
+
+/**
+ * @brief The lines of the dump: the header, the statistics and the histogram of every state, then the tasks.
+ */
+static void TEST_Lines(void)
+{
+	char prefix[16];
+	char *next;
+	long histogramSum;
+	u8 tag;
+	u8 i;
+
+	TEST_CHECK_EQ(TEST_u8Line,TEST_DUMP_LINES);
+	TEST_CHECK_EQ(strncmp(TEST_arrLines[0],"LOOP US/COUNT:",14),0);
+	TEST_CHECK(TEST_Field(TEST_arrLines[0],"US/COUNT:")>0);
+	TEST_CHECK_EQ(TEST_Field(TEST_arrLines[0],"BUCKETS:"),PROF_BUCKETS);
+	for (tag=0; tag<PROF_LOOP_TAGS; tag++)
+	{
+		printf("%s\n%s\n",TEST_arrLines[1+(2*tag)],TEST_arrLines[2+(2*tag)]);
+		snprintf(prefix,sizeof(prefix),"LOOP S%u N:",tag);
+		TEST_CHECK_EQ(strncmp(TEST_arrLines[1+(2*tag)],prefix,strlen(prefix)),0);
+		TEST_CHECK(TEST_Field(TEST_arrLines[1+(2*tag)]," W:")>=TEST_Field(TEST_arrLines[1+(2*tag)]," P99:"));
+
+		snprintf(prefix,sizeof(prefix),"HIST S%u",tag);
+		TEST_CHECK_EQ(strncmp(TEST_arrLines[2+(2*tag)],prefix,strlen(prefix)),0);
+		next=TEST_arrLines[2+(2*tag)]+strlen(prefix);
+		histogramSum=0;
+		for (i=0; i<PROF_BUCKETS; i++)
+		{
+			histogramSum+=strtol(next,&next,10);
+		}
+		TEST_CHECK_EQ(*next,'\0'); /*< PROF_BUCKETS buckets */
+		if (tag==0)
+		{
+			/* IDLE_OFF_STATE: the only state of the run */
+			TEST_CHECK(TEST_Field(TEST_arrLines[1],"N:")>0);
+			TEST_CHECK(histogramSum>0);
+		}
+	}
+	for (i=0; i<TEST_TASKS; i++)
+	{
+		printf("%s\n",TEST_arrLines[TEST_LOOP_LINES+i]);
+		snprintf(prefix,sizeof(prefix),"TASK T%u N:",i);
+		TEST_CHECK_EQ(strncmp(TEST_arrLines[TEST_LOOP_LINES+i],prefix,strlen(prefix)),0);
+		TEST_CHECK(TEST_Field(TEST_arrLines[TEST_LOOP_LINES+i],"N:")>0);  /*< every task ran */
+		TEST_CHECK(TEST_Field(TEST_arrLines[TEST_LOOP_LINES+i]," O:")>=0);
+		TEST_CHECK(TEST_Field(TEST_arrLines[TEST_LOOP_LINES+i]," W:")>=TEST_Field(TEST_arrLines[TEST_LOOP_LINES+i]," L:"));
+		TEST_CHECK(TEST_Field(TEST_arrLines[TEST_LOOP_LINES+i]," W:")<TEST_TASK_WCET_MAX_US);
+	}
+	TEST_CHECK_EQ(TEST_arrLines[TEST_DUMP_LINES][0],'\0'); /*< sent once */
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+int main(void)
+{
+	HD44780_Frame_t screen;
+
+	PLANT_SetStepCallBack(TEST_Step);
+	TEST_CHECK_EQ(PLANT_Run(TEST_arrScript,sizeof(TEST_arrScript)/sizeof(TEST_arrScript[0]),TEST_DURATION_MS,FIRMWARE_main),
+	              STD_OK);
+	TEST_CHECK_EQ(HD44780_GetScreen(&screen),STD_OK);
+	TEST_CHECK_EQ(strncmp((const char*)screen.text[3],"HIST>UART",9),0);
+	TEST_Lines();
+	return TEST_RESULT();
+}
@@ -0,0 +1,204 @@
+/**
+ * @file test_door_pins.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the test of the door interlock pins: the door is opened in the middle of a cook, at several
+ *         phases of the tick, the heater pin then the motor pin must drop in the interrupt of the edge
+ *         (system_doorOpened(), main.c), not in a task, and the cook resumes with START after the door is closed.
+ *
+ *         The host does not time the code: the drop is at the virtual time of the edge unless the interrupt waits
+ *         (a section with the interrupts disabled, DOOR_INTERLOCK_POLLED). The bound DOOR_HEATER_OFF_MAX_US is a
+ *         number of cycles of the target, it is checked on the image by the ISR latency harness (isr.py), not here.
+ *
+ * @note The outputs callback of the host port replaces the one of the display model: this run has no display checks.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "Utils_BitMath.h"
+
+// MCAL
+#include "MCU_config.h"
+#include "DIO_Interface.h"
+
+// host port
+#include "HOST_Interface.h"
+#include "PLANT_Interface.h"
+#include "PLANT_Lcfg.h"
+
+#include "test.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define TEST_DURATION_MS                30000
+#define TEST_CYCLES_PER_US              (F_CPU/1000000UL)
+#define TEST_CYCLES_PER_MS              (F_CPU/1000UL)
+#define TEST_US_TO_CYCLES(us)           ((u64)(us)*TEST_CYCLES_PER_US)
+#define TEST_NOT_YET                    0xFFFFFFFFFFFFFFFFULL
+
+#define TEST_HEATER_PORT                ((HOST_Port_t)(PLANT_HEATER_PIN/8))
+#define TEST_HEATER_BIT                 (PLANT_HEATER_PIN%8)
+#define TEST_MOTOR_PORT                 ((HOST_Port_t)(PLANT_MOTOR_PIN/8))
+#define TEST_MOTOR_BIT                  (PLANT_MOTOR_PIN%8)
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief A door opening of the test: the door opens at openUs, closes at closeUs, START is pressed at resumeUs.
+ */
+typedef struct
+{
+	u32 openUs;
+	u32 closeUs;
+	u32 resumeUs;
+}TEST_Opening_t;
+
+/**
+ * @brief The measures of an opening.
+ */
+typedef struct
+{
+	Std_Bool_t isHeaterOn;   /*< the heater was ON before the edge */
+	u64 edgeCycles;          /*< the virtual time of the edge */
+	u64 heaterOffCycles;     /*< the virtual time of the heater drop (TEST_NOT_YET) */
+	u64 motorOffCycles;      /*< the virtual time of the motor drop (TEST_NOT_YET) */
+}TEST_Measure_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* a 30 s cook, started at 1.2 s */
+static const PLANT_Event_t TEST_arrScript[]={ { 0    , PLANT_FOOD  , 1   } ,
+                                              { 500  , PLANT_KEY   , '3' } ,
+                                              { 800  , PLANT_KEY   , '0' } ,
+                                              { 1200 , PLANT_START , 0   } };
+
+/* the openings: not on the ms ticks, inside the cook (it goes on after each one) */
+static const TEST_Opening_t TEST_arrOpenings[]={ { 4000250  , 5000000  , 5500000  } ,
+                                                 { 8000777  , 9000000  , 9500000  } ,
+                                                 { 12345678 , 13000000 , 13500000 } ,
+                                                 { 17999999 , 19000000 , 19500000 } };
+
+#define TEST_OPENINGS_COUNT   (sizeof(TEST_arrOpenings)/sizeof(TEST_arrOpenings[0]))
+
+static TEST_Measure_t TEST_arrMeasures[TEST_OPENINGS_COUNT];
+static u8 TEST_u8Opening=0;           /*< the current opening */
+static u8 TEST_u8Phase=0;             /*< 0: closed, 1: opened, 2: closed (waiting for the resume) */
+static Std_Bool_t TEST_IsWatching=STD_FALSE;
+
+void FIRMWARE_main(void);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief The outputs callback of the host port: the time of the heater and motor drops after an edge.
+ */
+static void TEST_Outputs(u8 port)
+{
+	TEST_Measure_t *measure=&TEST_arrMeasures[TEST_u8Opening];
+
+	if ((TEST_u8Opening<TEST_OPENINGS_COUNT) && (TEST_u8Phase==1))
+	{
+		if ((port==TEST_HEATER_PORT) && (measure->heaterOffCycles==TEST_NOT_YET) &&
+		    (get_bit(HOST_GetOutputs(TEST_HEATER_PORT),TEST_HEATER_BIT)==0))
+		{
+			measure->heaterOffCycles=HOST_GetCycles();
+		}
+		if ((port==TEST_MOTOR_PORT) && (measure->motorOffCycles==TEST_NOT_YET) &&
+		    (get_bit(HOST_GetOutputs(TEST_MOTOR_PORT),TEST_MOTOR_BIT)==0))
+		{
+			measure->motorOffCycles=HOST_GetCycles();
+		}
+	}
+}
+
+/**
+ * @brief The step callback of the plant: opens, closes the door and resumes the cook.
+ */
+static void TEST_Step(void)
+{
+	u64 now=HOST_GetCycles();
+	const TEST_Opening_t *opening=&TEST_arrOpenings[TEST_u8Opening];
+	TEST_Measure_t *measure=&TEST_arrMeasures[TEST_u8Opening];
+
+	if (TEST_IsWatching==STD_FALSE)
+	{
+		TEST_IsWatching=STD_TRUE;
+		HOST_SetOutputsCallBack(TEST_Outputs,(u8)((1<<TEST_HEATER_PORT)|(1<<TEST_MOTOR_PORT)));
+	}
+	if (TEST_u8Opening<TEST_OPENINGS_COUNT)
+	{
+		if ((TEST_u8Phase==0) && (now>=TEST_US_TO_CYCLES(opening->openUs)))
+		{
+			measure->isHeaterOn=(get_bit(HOST_GetOutputs(TEST_HEATER_PORT),TEST_HEATER_BIT)==1)? STD_TRUE : STD_FALSE;
+			measure->edgeCycles=now;
+			measure->heaterOffCycles=TEST_NOT_YET;
+			measure->motorOffCycles=TEST_NOT_YET;
+			TEST_u8Phase=1;
+			(void)PLANT_Act(PLANT_DOOR,1);
+		}
+		else if ((TEST_u8Phase==1) && (now>=TEST_US_TO_CYCLES(opening->closeUs)))
+		{
+			TEST_u8Phase=2;
+			(void)PLANT_Act(PLANT_DOOR,0);
+		}
+		else if ((TEST_u8Phase==2) && (now>=TEST_US_TO_CYCLES(opening->resumeUs)))
+		{
+			TEST_u8Phase=0;
+			TEST_u8Opening++;
+			(void)PLANT_Act(PLANT_START,0);
+		}
+		else
+		{
+			//waiting
+		}
+	}
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+int main(void)
+{
+	u8 i;
+	u64 delay;
+
+	PLANT_SetStepCallBack(TEST_Step);
+	TEST_CHECK_EQ(PLANT_Run(TEST_arrScript,sizeof(TEST_arrScript)/sizeof(TEST_arrScript[0]),TEST_DURATION_MS,FIRMWARE_main),
+	              STD_OK);
+	TEST_CHECK_EQ(TEST_u8Opening,TEST_OPENINGS_COUNT);
+
+	for (i=0; i<TEST_OPENINGS_COUNT; i++)
+	{
+		TEST_CHECK_EQ(TEST_arrMeasures[i].isHeaterOn,STD_TRUE); /*< in the middle of the cook */
+		TEST_CHECK(TEST_arrMeasures[i].heaterOffCycles!=TEST_NOT_YET);
+		TEST_CHECK(TEST_arrMeasures[i].motorOffCycles!=TEST_NOT_YET);
+		if (TEST_arrMeasures[i].heaterOffCycles!=TEST_NOT_YET)
+		{
+			delay=TEST_arrMeasures[i].heaterOffCycles-TEST_arrMeasures[i].edgeCycles;
+			printf("opening %u at %lu us: heater OFF after %lu host cycles\n",i,
+			       (unsigned long)TEST_arrOpenings[i].openUs,(unsigned long)delay);
+			TEST_CHECK(delay<TEST_CYCLES_PER_MS);               /*< in the interrupt of the edge */
+			TEST_CHECK(TEST_arrMeasures[i].motorOffCycles>=TEST_arrMeasures[i].heaterOffCycles); /*< the heat source first */
+		}
+	}
+	return TEST_RESULT();
+}
@@ -0,0 +1,132 @@
+/**
+ * @file test_fuzz.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the regression test of a sequence found by the fuzzer (make fuzz, seed 1): STOP (CANCEL)
+ *         in ON_STATE left TIMER1 running in PAUSE_STATE when the ON_STATE case did not call system_OnOff(STD_OFF).
+ *         The sequence is replayed by PLANT_Run() and the invariants of the fuzzer (FUZZ_Interface.h) are checked at
+ *         every step: TIMER1 only runs in ON_STATE, the heater is never ON with the door opened.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "Utils_BitMath.h"
+
+// MCAL
+#include "MCU_config.h"
+#include "DIO_Interface.h"
+
+// host port
+#include "HOST_Interface.h"
+#include "PLANT_Interface.h"
+#include "PLANT_Lcfg.h"
+#include "FUZZ_Lcfg.h"
+
+#include "test.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define TEST_DURATION_MS          4892        /*< the violation at 3892 ms + 1 s */
+#define TEST_PAUSE_STATE          2           /*< STATE_t of main.c */
+#define TEST_CYCLES_PER_MS        (F_CPU/1000UL)
+#define TEST_NO_BREACH            0xFFFFFFFFUL
+
+#define TEST_TCCR1B_ADDRESS       0x4E        /*< MemMap.h, CS12:CS10 */
+#define TEST_TCCR1B_CS_MASK       0x07
+
+#define TEST_DOOR_PORT            ((HOST_Port_t)(PLANT_DOOR_PIN/8))
+#define TEST_DOOR_BIT             (PLANT_DOOR_PIN%8)
+#define TEST_HEATER_PORT          ((HOST_Port_t)(PLANT_HEATER_PIN/8))
+#define TEST_HEATER_BIT           (PLANT_HEATER_PIN%8)
+
+void FIRMWARE_main(void);
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* the sequence printed by the fuzzer */
+static const PLANT_Event_t TEST_arrScript[]={ { 2345 , PLANT_KEY   , '8' } ,
+                                              { 2562 , PLANT_FOOD  , 1   } ,
+                                              { 3109 , PLANT_KEY   , '5' } ,
+                                              { 3686 , PLANT_START , 0   } ,
+                                              { 3764 , PLANT_STOP  , 0   } };
+
+static u32 TEST_u32TimerBreachMs=TEST_NO_BREACH;
+static u32 TEST_u32DoorBreachMs=TEST_NO_BREACH;
+static u32 TEST_u32MaxTimerBreachMs=0;
+static u32 TEST_u32MaxDoorBreachMs=0;
+static u8 TEST_u8WasOn=0;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Measures how long a breach of an invariant lasts.
+ */
+static void TEST_Breach(u8 isBreached, u32 nowMs, u32 *sinceMs, u32 *maxMs)
+{
+	if (isBreached==0)
+	{
+		*sinceMs=TEST_NO_BREACH;
+	}
+	else if (*sinceMs==TEST_NO_BREACH)
+	{
+		*sinceMs=nowMs;
+	}
+	else if ((nowMs-*sinceMs)>*maxMs)
+	{
+		*maxMs=nowMs-*sinceMs;
+	}
+	else
+	{
+		//shorter than the longest one
+	}
+}
+
+/**
+ * @brief The step callback of the plant: the invariants of the fuzzer.
+ */
+static void TEST_Step(void)
+{
+	u32 nowMs=(u32)(HOST_GetCycles()/TEST_CYCLES_PER_MS);
+	u8 isOpened=get_bit(HOST_GetPins(TEST_DOOR_PORT),TEST_DOOR_BIT);
+	u8 isHeating=get_bit(HOST_GetOutputs(TEST_HEATER_PORT),TEST_HEATER_BIT);
+	u8 isTiming=((HOST_PeekIo(TEST_TCCR1B_ADDRESS)&TEST_TCCR1B_CS_MASK)!=0)? 1 : 0;
+
+	if (system_getState()==FUZZ_ON_STATE)
+	{
+		TEST_u8WasOn=1;
+	}
+	TEST_Breach((isTiming==1) && (system_getState()!=FUZZ_ON_STATE),nowMs,&TEST_u32TimerBreachMs,&TEST_u32MaxTimerBreachMs);
+	TEST_Breach((isOpened==1) && (isHeating==1),nowMs,&TEST_u32DoorBreachMs,&TEST_u32MaxDoorBreachMs);
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+int main(void)
+{
+	PLANT_SetStepCallBack(TEST_Step);
+	TEST_CHECK_EQ(PLANT_Run(TEST_arrScript,sizeof(TEST_arrScript)/sizeof(TEST_arrScript[0]),TEST_DURATION_MS,FIRMWARE_main),STD_OK);
+
+	TEST_CHECK_EQ(TEST_u8WasOn,1);                          /*< the sequence reaches ON_STATE */
+	TEST_CHECK_EQ(system_getState(),TEST_PAUSE_STATE);      /*< and STOP pauses the cook */
+	TEST_CHECK(TEST_u32MaxTimerBreachMs<FUZZ_REACTION_MS);
+	TEST_CHECK(TEST_u32MaxDoorBreachMs<FUZZ_REACTION_MS);
+	TEST_CHECK_EQ(HOST_PeekIo(TEST_TCCR1B_ADDRESS)&TEST_TCCR1B_CS_MASK,0);
+	return TEST_RESULT();
+}
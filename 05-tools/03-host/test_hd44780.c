@@ -0,0 +1,194 @@
+/**
+ * @file test_hd44780.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the screen content tests of the firmware on the HD44780 display model (HD44780_Interface.h):
+ *         a 10 s cook is run on the oven plant (PLANT_Interface.h), the recorded frames are checked row by row and the
+ *         frames of a key press are diffed cell by cell. The bus of the LCD driver has no timing violation.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+
+// lib
+#include "Std_Types.h"
+
+// host port
+#include "PLANT_Interface.h"
+#include "HD44780_Lcfg.h"
+#include "HD44780_Interface.h"
+
+#include "test.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define TEST_NOT_FOUND            0xFFFF
+#define TEST_DURATION_MS          12000
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* the cook of scenarios/cook.scn: 10 s at 100% */
+static const PLANT_Event_t TEST_arrScript[]={ { 0    , PLANT_FOOD  , 1   } ,
+                                              { 500  , PLANT_KEY   , '1' } ,
+                                              { 800  , PLANT_KEY   , '0' } ,
+                                              { 1200 , PLANT_START , 0   } };
+
+static const HD44780_Frame_t *TEST_pFrames;
+static u16 TEST_u16FramesCount;
+
+void FIRMWARE_main(void);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns the first frame (from the index start) whose row is text, TEST_NOT_FOUND when there is none.
+ */
+static u16 TEST_FindFrame(u16 start, u8 row, const char *text)
+{
+	u16 found=TEST_NOT_FOUND;
+	u16 i;
+
+	for (i=start; (i<TEST_u16FramesCount) && (found==TEST_NOT_FOUND); i++)
+	{
+		if (strcmp((const char*)TEST_pFrames[i].text[row],text)==0)
+		{
+			found=i;
+		}
+	}
+	return found;
+}
+
+/**
+ * @brief The display is ON after the LCD initialization and the welcome screen is drawn.
+ */
+static void TEST_Welcome(void)
+{
+	u16 welcome=TEST_FindFrame(0,1,"  Abdelrahman Ahmed ");
+
+	TEST_CHECK(TEST_u16FramesCount>0);
+	TEST_CHECK_EQ(TEST_pFrames[0].isOn,STD_FALSE); /*< the power on state of the controller */
+	TEST_CHECK(welcome!=TEST_NOT_FOUND);
+	if (welcome!=TEST_NOT_FOUND)
+	{
+		TEST_CHECK_EQ(TEST_pFrames[welcome].isOn,STD_TRUE);
+		TEST_CHECK(strncmp((const char*)TEST_pFrames[welcome].text[0],"  Microwave",11)==0);
+		TEST_CHECK(welcome<TEST_FindFrame(0,2,"P:100% 00:01        ")); /*< before the time is set */
+	}
+}
+
+/**
+ * @brief The keys '1' then '0' set 00:01 then 00:10: only the two digits of the time change.
+ */
+static void TEST_TimeKeys(void)
+{
+	u16 first=TEST_FindFrame(0,2,"P:100% 00:01        ");
+	u16 second=TEST_FindFrame(0,2,"P:100% 00:10        ");
+	HD44780_Cell_t diffs[4];
+
+	TEST_CHECK(first!=TEST_NOT_FOUND);
+	TEST_CHECK(second!=TEST_NOT_FOUND);
+	if ((first!=TEST_NOT_FOUND) && (second!=TEST_NOT_FOUND))
+	{
+		TEST_CHECK(second>first);
+		TEST_CHECK_EQ(strcmp((const char*)TEST_pFrames[first].text[3],">>Set Timer Please<<"),0);
+		TEST_CHECK(TEST_pFrames[first].timeMs>=500);
+		TEST_CHECK(TEST_pFrames[second].timeMs>=800);
+
+		TEST_CHECK_EQ(HD44780_DiffFrames(&TEST_pFrames[second-1],&TEST_pFrames[second],diffs,4),2);
+		TEST_CHECK_EQ(diffs[0].row,2);
+		TEST_CHECK_EQ(diffs[0].col,10);
+		TEST_CHECK_EQ(diffs[0].before,'0');
+		TEST_CHECK_EQ(diffs[0].after,'1');
+		TEST_CHECK_EQ(diffs[1].row,2);
+		TEST_CHECK_EQ(diffs[1].col,11);
+		TEST_CHECK_EQ(diffs[1].before,'1');
+		TEST_CHECK_EQ(diffs[1].after,'0');
+	}
+}
+
+/**
+ * @brief The running screen after START, the time counts down, DONE at the end.
+ */
+static void TEST_Cook(void)
+{
+	u16 running=TEST_FindFrame(0,3,">>>>>>RUNNING<<<<<<<");
+	u16 nine=TEST_FindFrame(0,2,"P:100% 00:09        ");
+	u16 done=TEST_FindFrame(0,3,">>>>>>>>DONE<<<<<<<<");
+	HD44780_Frame_t screen;
+
+	TEST_CHECK(running!=TEST_NOT_FOUND);
+	TEST_CHECK(nine!=TEST_NOT_FOUND);
+	TEST_CHECK(done!=TEST_NOT_FOUND);
+	if ((running!=TEST_NOT_FOUND) && (nine!=TEST_NOT_FOUND) && (done!=TEST_NOT_FOUND))
+	{
+		TEST_CHECK(TEST_pFrames[running].timeMs>=1200);
+		TEST_CHECK((nine>running) && (done>nine));
+		TEST_CHECK(TEST_pFrames[done].timeMs>=11200); /*< not before the 10 s */
+	}
+	TEST_CHECK_EQ(HD44780_GetScreen(&screen),STD_OK);
+	TEST_CHECK_EQ(screen.isOn,STD_TRUE);
+	TEST_CHECK_EQ(strcmp((const char*)screen.text[1],"  Abdelrahman Ahmed "),0);
+}
+
+/**
+ * @brief A frame is recorded only when the screen changed, the frames are sorted by time.
+ */
+static void TEST_Frames(void)
+{
+	u16 i;
+
+	for (i=1; i<TEST_u16FramesCount; i++)
+	{
+		TEST_CHECK(TEST_pFrames[i].timeMs>TEST_pFrames[i-1].timeMs);
+		TEST_CHECK((HD44780_DiffFrames(&TEST_pFrames[i-1],&TEST_pFrames[i],NULL_PTR,0)>0) ||
+		           (TEST_pFrames[i].isOn!=TEST_pFrames[i-1].isOn));
+	}
+	TEST_CHECK_EQ(HD44780_DiffFrames(NULL_PTR,&TEST_pFrames[0],NULL_PTR,0),0);
+}
+
+/**
+ * @brief The LCD driver respects the timings of the controller.
+ */
+static void TEST_Timings(void)
+{
+	HD44780_Stats_t stats;
+
+	TEST_CHECK_EQ(HD44780_GetStats(&stats),STD_OK);
+	TEST_CHECK_EQ(stats.busyViolations,0);
+	TEST_CHECK_EQ(stats.earlyViolations,0);
+	TEST_CHECK_EQ(stats.pulseViolations,0);
+	TEST_CHECK_EQ(stats.setupViolations,0);
+	TEST_CHECK(stats.ops[HD44780_OP_DATA].count>0);
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+int main(void)
+{
+	TEST_CHECK_EQ(PLANT_Run(TEST_arrScript,sizeof(TEST_arrScript)/sizeof(TEST_arrScript[0]),TEST_DURATION_MS,FIRMWARE_main),
+	              STD_OK);
+	TEST_u16FramesCount=HD44780_GetFrames(&TEST_pFrames);
+
+	TEST_Welcome();
+	TEST_TimeKeys();
+	TEST_Cook();
+	TEST_Frames();
+	TEST_Timings();
+	return TEST_RESULT();
+}
@@ -0,0 +1,268 @@
+/**
+ * @file test_ringbuf.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the host tests of the SPSC ring buffer (01-LIB/RingBuffer.c): the sizes, full and empty,
+ *         the wrap around of the storage and of the free running indices, the all-or-nothing bulk push/pop,
+ *         the peek offsets and the zero-copy regions.
+ *
+ * @see RingBuffer.h
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "test.h"
+
+// lib
+#include "Std_Types.h"
+#include "RingBuffer.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define TEST_SIZE                 8
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+RINGBUF_DEFINE(TEST_Ring,TEST_SIZE);
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief Moves both indices to (index) with an empty buffer (the wrap around cases start there).
+ */
+static void TEST_Seek(u8 index)
+{
+	TEST_Ring.head=index;
+	TEST_Ring.tail=index;
+}
+
+static void TEST_Init(void)
+{
+	RingBuf_t ring;
+	u8 storage[TEST_SIZE];
+
+	TEST_CHECK_EQ(RingBuf_Init(NULL_PTR,storage,TEST_SIZE),STD_NULL_POINTER);
+	TEST_CHECK_EQ(RingBuf_Init(&ring,NULL_PTR,TEST_SIZE),STD_NULL_POINTER);
+	TEST_CHECK_EQ(RingBuf_Init(&ring,storage,0),STD_INVALID_ARG);
+	TEST_CHECK_EQ(RingBuf_Init(&ring,storage,1),STD_INVALID_ARG);
+	TEST_CHECK_EQ(RingBuf_Init(&ring,storage,6),STD_INVALID_ARG);
+	TEST_CHECK_EQ(RingBuf_Init(&ring,storage,255),STD_INVALID_ARG);
+	TEST_CHECK_EQ(RingBuf_Init(&ring,storage,TEST_SIZE),STD_OK);
+	TEST_CHECK_EQ(RingBuf_Count(&ring),0);
+	TEST_CHECK_EQ(RingBuf_Free(&ring),TEST_SIZE);
+}
+
+static void TEST_FullEmpty(void)
+{
+	u8 data;
+	u8 i;
+
+	TEST_Seek(0);
+	TEST_CHECK_EQ(RingBuf_Pop(&TEST_Ring,&data),STD_BUFFER_EMPTY);
+	for (i=0; i<TEST_SIZE; i++)
+	{
+		TEST_CHECK_EQ(RingBuf_Push(&TEST_Ring,i),STD_OK);
+	}
+	TEST_CHECK_EQ(RingBuf_Push(&TEST_Ring,0xAA),STD_BUFFER_FULL);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),TEST_SIZE);
+	TEST_CHECK_EQ(RingBuf_Free(&TEST_Ring),0);
+	for (i=0; i<TEST_SIZE; i++)
+	{
+		TEST_CHECK_EQ(RingBuf_Pop(&TEST_Ring,&data),STD_OK);
+		TEST_CHECK_EQ(data,i); /*< FIFO, the rejected 0xAA is not stored */
+	}
+	TEST_CHECK_EQ(RingBuf_Pop(&TEST_Ring,&data),STD_BUFFER_EMPTY);
+
+	TEST_CHECK_EQ(RingBuf_Push(&TEST_Ring,1),STD_OK);
+	TEST_CHECK_EQ(RingBuf_Push(&TEST_Ring,2),STD_OK);
+	RingBuf_Flush(&TEST_Ring);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),0);
+	TEST_CHECK_EQ(RingBuf_Pop(&TEST_Ring,&data),STD_BUFFER_EMPTY);
+}
+
+static void TEST_WrapAround(void)
+{
+	u16 i;
+	u8 pushed=0;
+	u8 popped=0;
+	u8 data;
+
+	/* 5 bytes stay stored while the indices go around the storage and around 255 -> 0 several times */
+	TEST_Seek(250);
+	for (i=0; i<5; i++)
+	{
+		TEST_CHECK_EQ(RingBuf_Push(&TEST_Ring,pushed++),STD_OK);
+	}
+	for (i=0; i<1000; i++)
+	{
+		TEST_CHECK_EQ(RingBuf_Push(&TEST_Ring,pushed++),STD_OK);
+		TEST_CHECK_EQ(RingBuf_Pop(&TEST_Ring,&data),STD_OK);
+		TEST_CHECK_EQ(data,popped++);
+		TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),5);
+	}
+
+	/* full across the index overflow */
+	TEST_Seek(252);
+	for (i=0; i<TEST_SIZE; i++)
+	{
+		TEST_CHECK_EQ(RingBuf_Push(&TEST_Ring,(u8)i),STD_OK);
+	}
+	TEST_CHECK_EQ(TEST_Ring.head,4);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),TEST_SIZE);
+	TEST_CHECK_EQ(RingBuf_Push(&TEST_Ring,0xAA),STD_BUFFER_FULL);
+	for (i=0; i<TEST_SIZE; i++)
+	{
+		TEST_CHECK_EQ(RingBuf_Pop(&TEST_Ring,&data),STD_OK);
+		TEST_CHECK_EQ(data,i);
+	}
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),0);
+}
+
+static void TEST_Bulk(void)
+{
+	const u8 record[]={ 10, 11, 12, 13 };
+	u8 out[TEST_SIZE]={ 0 };
+	u8 i;
+
+	TEST_Seek(6); /*< the records cross the end of the storage */
+	TEST_CHECK_EQ(RingBuf_PushBulk(&TEST_Ring,record,3),STD_OK);
+	TEST_CHECK_EQ(RingBuf_PushBulk(&TEST_Ring,record,2),STD_OK);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),5);
+
+	/* all or nothing: 4 bytes don't fit in the 3 free bytes */
+	TEST_CHECK_EQ(RingBuf_PushBulk(&TEST_Ring,record,4),STD_BUFFER_FULL);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),5);
+	TEST_CHECK_EQ(RingBuf_PushBulk(&TEST_Ring,record,3),STD_OK);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),TEST_SIZE);
+	TEST_CHECK_EQ(RingBuf_PushBulk(&TEST_Ring,record,1),STD_BUFFER_FULL);
+
+	TEST_CHECK_EQ(RingBuf_PopBulk(&TEST_Ring,out,3),STD_OK);
+	for (i=0; i<3; i++)
+	{
+		TEST_CHECK_EQ(out[i],record[i]);
+	}
+	/* nothing popped when less than len bytes are stored */
+	TEST_CHECK_EQ(RingBuf_PopBulk(&TEST_Ring,out,6),STD_BUFFER_EMPTY);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),5);
+	TEST_CHECK_EQ(RingBuf_PopBulk(&TEST_Ring,out,5),STD_OK);
+	TEST_CHECK_EQ(out[0],10);
+	TEST_CHECK_EQ(out[1],11);
+	TEST_CHECK_EQ(out[2],10);
+	TEST_CHECK_EQ(out[3],11);
+	TEST_CHECK_EQ(out[4],12);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),0);
+	TEST_CHECK_EQ(RingBuf_PushBulk(&TEST_Ring,record,0),STD_OK);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),0);
+}
+
+static void TEST_Peek(void)
+{
+	u8 data;
+	u8 i;
+
+	TEST_Seek(5);
+	TEST_CHECK_EQ(RingBuf_Peek(&TEST_Ring,0,&data),STD_BUFFER_EMPTY);
+	for (i=0; i<6; i++)
+	{
+		TEST_CHECK_EQ(RingBuf_Push(&TEST_Ring,(u8)(100+i)),STD_OK);
+	}
+	for (i=0; i<6; i++)
+	{
+		data=0;
+		TEST_CHECK_EQ(RingBuf_Peek(&TEST_Ring,i,&data),STD_OK);
+		TEST_CHECK_EQ(data,100+i);
+	}
+	TEST_CHECK_EQ(RingBuf_Peek(&TEST_Ring,6,&data),STD_BUFFER_EMPTY);
+	TEST_CHECK_EQ(RingBuf_Peek(&TEST_Ring,255,&data),STD_BUFFER_EMPTY);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),6); /*< nothing removed */
+
+	TEST_CHECK_EQ(RingBuf_Pop(&TEST_Ring,&data),STD_OK);
+	TEST_CHECK_EQ(RingBuf_Peek(&TEST_Ring,0,&data),STD_OK);
+	TEST_CHECK_EQ(data,101);
+}
+
+static void TEST_Regions(void)
+{
+	u8 *writeRegion;
+	const u8 *readRegion;
+	u8 len;
+	u8 i;
+	u8 data;
+
+	/* empty at index 6: the write region ends at the end of the storage */
+	TEST_Seek(6);
+	TEST_CHECK_EQ(RingBuf_GetReadRegion(&TEST_Ring,&readRegion),0);
+	len=RingBuf_GetWriteRegion(&TEST_Ring,&writeRegion);
+	TEST_CHECK_EQ(len,2);
+	TEST_CHECK(writeRegion==&TEST_Ring_storage[6]);
+	writeRegion[0]='a';
+	writeRegion[1]='b';
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),0); /*< not published before the commit */
+	RingBuf_CommitWrite(&TEST_Ring,2);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),2);
+
+	/* the next region starts at the beginning, limited by the free bytes */
+	len=RingBuf_GetWriteRegion(&TEST_Ring,&writeRegion);
+	TEST_CHECK_EQ(len,6);
+	TEST_CHECK(writeRegion==&TEST_Ring_storage[0]);
+	for (i=0; i<len; i++)
+	{
+		writeRegion[i]=(u8)('c'+i);
+	}
+	RingBuf_CommitWrite(&TEST_Ring,len);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),TEST_SIZE);
+	TEST_CHECK_EQ(RingBuf_GetWriteRegion(&TEST_Ring,&writeRegion),0); /*< full */
+
+	/* the read regions follow the same split */
+	len=RingBuf_GetReadRegion(&TEST_Ring,&readRegion);
+	TEST_CHECK_EQ(len,2);
+	TEST_CHECK_EQ(readRegion[0],'a');
+	TEST_CHECK_EQ(readRegion[1],'b');
+	RingBuf_Release(&TEST_Ring,1); /*< a partial release */
+	len=RingBuf_GetReadRegion(&TEST_Ring,&readRegion);
+	TEST_CHECK_EQ(len,1);
+	TEST_CHECK_EQ(readRegion[0],'b');
+	RingBuf_Release(&TEST_Ring,1);
+	len=RingBuf_GetReadRegion(&TEST_Ring,&readRegion);
+	TEST_CHECK_EQ(len,6);
+	TEST_CHECK_EQ(readRegion[0],'c');
+	TEST_CHECK_EQ(readRegion[5],'h');
+
+	/* the regions and the byte API share the indices */
+	TEST_CHECK_EQ(RingBuf_Pop(&TEST_Ring,&data),STD_OK);
+	TEST_CHECK_EQ(data,'c');
+	len=RingBuf_GetWriteRegion(&TEST_Ring,&writeRegion);
+	TEST_CHECK_EQ(len,2); /*< 3 free bytes: 2 at the end of the storage, 1 at the beginning */
+	TEST_CHECK(writeRegion==&TEST_Ring_storage[6]);
+	len=RingBuf_GetReadRegion(&TEST_Ring,&readRegion);
+	RingBuf_Release(&TEST_Ring,len);
+	TEST_CHECK_EQ(RingBuf_Count(&TEST_Ring),0);
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+int main(void)
+{
+	TEST_Init();
+	TEST_FullEmpty();
+	TEST_WrapAround();
+	TEST_Bulk();
+	TEST_Peek();
+	TEST_Regions();
+	return TEST_RESULT();
+}
@@ -0,0 +1,317 @@
+/**
+ * @file test_trace.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the tests of the trace recorder (TRACE_Interface.h) and the round trip through its decoder:
+ *         the records are written with the macros of the firmware, TRACE_TICK() is called as the uptime tick does,
+ *         TRACE_Log is dumped to a file as the debugger does and 05-tools/02-trace/trace_decode.py prints it back.
+ *         - the deltas stamped by the tick (the records of a tick, the records not stamped yet)
+ *         - the wrap of the ring (the oldest records are overwritten)
+ *         - the frozen log (TRACE_FAULT(): the next records are dropped) and TRACE_Restart()
+ *
+ * @note The decoder is run with python3 from the directory of this file (make test).
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// lib
+#include "Std_Types.h"
+#include "MemMap.h"
+#include "Utils_interrupt.h"
+
+// MCAL
+#include "WDT_Interface.h"
+
+// Services
+#include "TRACE_Lcfg.h"
+#include "TRACE_Interface.h"
+
+// host port
+#include "HOST_Interface.h"
+
+#include "test.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define TEST_DECODER              "python3 ../02-trace/trace_decode.py"
+#define TEST_LINE_SIZE            128
+#define TEST_MAX_ROWS             (TRACE_SIZE+1)
+#define TEST_WRAP_RECORDS         (TRACE_SIZE+8)
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  TYPEDEFS                                    */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/**
+ * @brief A row of the timeline printed by the decoder: time (ms), delta, event, arg.
+ */
+typedef struct
+{
+	char time[16];
+	char delta[16];
+	char event[32];
+	char arg[32];
+}TEST_Row_t;
+
+/**
+ * @brief The output of the decoder.
+ */
+typedef struct
+{
+	char title[TEST_LINE_SIZE];     /*< "TRACE_Log: <n> records of <size>[, frozen (fault)]" */
+	TEST_Row_t rows[TEST_MAX_ROWS];
+	u8 rowsCount;
+	char last[TEST_LINE_SIZE];      /*< "<n> ticks since the last record" */
+}TEST_Decoded_t;
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static TEST_Decoded_t TEST_Decoded;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief The uptime tick ISR: count ticks.
+ */
+static void TEST_Ticks(u16 count)
+{
+	u16 i;
+
+	for (i=0; i<count; i++)
+	{
+		TRACE_TICK();
+	}
+}
+
+/**
+ * @brief Dumps TRACE_Log to a file (dump binary value trace.bin TRACE_Log) and decodes it into TEST_Decoded.
+ */
+static void TEST_Decode(void)
+{
+	char path[]="/tmp/test_trace_XXXXXX";
+	char command[TEST_LINE_SIZE];
+	char line[TEST_LINE_SIZE];
+	TEST_Row_t *row;
+	FILE *output;
+	int file=mkstemp(path);
+
+	memset(&TEST_Decoded,0,sizeof(TEST_Decoded));
+	TEST_CHECK(file>=0);
+	if (file>=0)
+	{
+		TEST_CHECK_EQ(write(file,(const void*)&TRACE_Log,sizeof(TRACE_Log)),(ssize_t)sizeof(TRACE_Log));
+		close(file);
+		snprintf(command,sizeof(command),"%s %s",TEST_DECODER,path);
+		output=popen(command,"r");
+		TEST_CHECK(output!=NULL);
+		if (output!=NULL)
+		{
+			while (fgets(line,sizeof(line),output)!=NULL)
+			{
+				line[strcspn(line,"\n")]='\0';
+				row=&TEST_Decoded.rows[TEST_Decoded.rowsCount];
+				if (strncmp(line,"TRACE_Log:",10)==0)
+				{
+					snprintf(TEST_Decoded.title,sizeof(TEST_Decoded.title),"%s",line);
+				}
+				else if (strstr(line,"since the last record")!=NULL)
+				{
+					snprintf(TEST_Decoded.last,sizeof(TEST_Decoded.last),"%s",line);
+				}
+				else if ((TEST_Decoded.rowsCount<TEST_MAX_ROWS) &&
+				         (sscanf(line,"%15s %15s %31s %31[^\n]",row->time,row->delta,row->event,row->arg)>=3) &&
+				         (strncmp(row->event,"TRACE_",6)==0))
+				{
+					TEST_Decoded.rowsCount++;
+				}
+				else
+				{
+					//the header of the columns
+				}
+			}
+			TEST_CHECK_EQ(pclose(output),0);
+		}
+		unlink(path);
+	}
+}
+
+/**
+ * @brief Checks the title of the decoded timeline.
+ */
+static void TEST_Title(u8 count, const char *suffix)
+{
+	char title[TEST_LINE_SIZE];
+
+	snprintf(title,sizeof(title),"TRACE_Log: %u records of %u%s",count,TRACE_SIZE,suffix);
+	TEST_CHECK_EQ(strcmp(TEST_Decoded.title,title),0);
+	TEST_CHECK_EQ(TEST_Decoded.rowsCount,count);
+}
+
+/**
+ * @brief Checks a row of the decoded timeline.
+ */
+static void TEST_Row(u8 index, const char *time, const char *delta, const char *event, const char *arg)
+{
+	const TEST_Row_t *row=&TEST_Decoded.rows[index];
+
+	TEST_CHECK(index<TEST_Decoded.rowsCount);
+	if (index<TEST_Decoded.rowsCount)
+	{
+		printf("  %s %s %s %s\n",row->time,row->delta,row->event,row->arg);
+		TEST_CHECK_EQ(strcmp(row->time,time),0);
+		TEST_CHECK_EQ(strcmp(row->delta,delta),0);
+		TEST_CHECK_EQ(strcmp(row->event,event),0);
+		TEST_CHECK_EQ(strcmp(row->arg,arg),0);
+	}
+}
+
+/**
+ * @brief The deltas are stamped by the next tick: the first record of a tick gets the ticks since the previous
+ *        record, the next ones 0, TRACE_GetRecords() stamps the records of the current tick.
+ */
+static void TEST_Stamp(void)
+{
+	TRACE_Record_t records[TRACE_SIZE];
+	u8 count;
+
+	TRACE_Init(WDT_RESET_POWER_ON);
+	TRACE_RECORD(TRACE_KEY,'1');
+	TEST_Ticks(5);
+	TRACE_RECORD(TRACE_STATE,2);
+	TRACE_RECORD_ISR(TRACE_HEATER_ISR,1);
+	TEST_Ticks(301);
+	TRACE_RECORD(TRACE_ONOFF,1);
+
+	TEST_CHECK_EQ(TRACE_GetRecords(records,&count),STD_OK);
+	TEST_CHECK_EQ(count,5);
+	TEST_CHECK_EQ(records[0].event,TRACE_RESET);
+	TEST_CHECK_EQ(records[0].arg,WDT_RESET_POWER_ON);
+	TEST_CHECK_EQ(records[0].delta,TRACE_MAX_DELTA); /*< the time of the reset is unknown */
+	TEST_CHECK_EQ(records[1].event,TRACE_KEY);
+	TEST_CHECK_EQ(records[1].delta,0);               /*< the same tick */
+	TEST_CHECK_EQ(records[2].event,TRACE_STATE);
+	TEST_CHECK_EQ(records[2].delta,5);
+	TEST_CHECK_EQ(records[3].event,TRACE_HEATER_ISR);
+	TEST_CHECK_EQ(records[3].delta,0);
+	TEST_CHECK_EQ(records[4].event,TRACE_ONOFF);
+	TEST_CHECK_EQ(records[4].delta,301);             /*< not stamped by a tick yet */
+	TEST_CHECK_EQ(TRACE_GetRecords(NULL_PTR,&count),STD_NULL_POINTER);
+}
+
+/**
+ * @brief The decoder stamps the records of the current tick as the next tick would do it.
+ */
+static void TEST_DecodePending(void)
+{
+	TRACE_Restart();
+	TRACE_RECORD(TRACE_KEY,'1');
+	TEST_Ticks(10);
+	TRACE_RECORD_ISR(TRACE_HEATER_ISR,1);
+	TEST_Ticks(250);
+	TRACE_RECORD(TRACE_ONOFF,1);
+	TRACE_RECORD(TRACE_KEY,'0');   /*< not stamped */
+
+	printf("decoded, 2 records not stamped:\n");
+	TEST_Decode();
+	TEST_Title(4,"");
+	TEST_Row(0,"0","-","TRACE_KEY","'1'");
+	TEST_Row(1,"10","+10","TRACE_HEATER_ISR","heater ON");
+	TEST_Row(2,"260","+250","TRACE_ONOFF","ON");
+	TEST_Row(3,"260","+0","TRACE_KEY","'0'");
+	TEST_CHECK_EQ(strcmp(TEST_Decoded.last,"0 ticks since the last record"),0);
+}
+
+/**
+ * @brief More records than TRACE_SIZE: the oldest ones are overwritten, the decoder starts at the oldest one left.
+ */
+static void TEST_Wrap(void)
+{
+	TRACE_Record_t records[TRACE_SIZE];
+	u8 count;
+	u8 i;
+
+	TRACE_Restart();
+	for (i=0; i<TEST_WRAP_RECORDS; i++)
+	{
+		TRACE_RECORD(TRACE_KEY,'0'+i);
+		TEST_Ticks(2);
+	}
+
+	printf("decoded, %u records in a ring of %u:\n",TEST_WRAP_RECORDS,TRACE_SIZE);
+	TEST_Decode();
+	TEST_Title(TRACE_SIZE,"");
+	TEST_Row(0,"0","-","TRACE_KEY","'8'");
+	TEST_Row(1,"2","+2","TRACE_KEY","'9'");
+	TEST_Row(TRACE_SIZE-1,"62","+2","TRACE_KEY","'W'");
+	TEST_CHECK_EQ(strcmp(TEST_Decoded.last,"2 ticks since the last record"),0);
+
+	TEST_CHECK_EQ(TRACE_GetRecords(records,&count),STD_OK);
+	TEST_CHECK_EQ(count,TRACE_SIZE);
+	TEST_CHECK_EQ(records[0].arg,'0'+TEST_WRAP_RECORDS-TRACE_SIZE);
+	TEST_CHECK_EQ(records[TRACE_SIZE-1].arg,'0'+TEST_WRAP_RECORDS-1);
+}
+
+/**
+ * @brief A fault freezes the log (the fault is stamped), the next records are dropped until TRACE_Restart().
+ */
+static void TEST_Freeze(void)
+{
+	TRACE_Record_t records[TRACE_SIZE];
+	u8 count;
+
+	TRACE_Restart();
+	TRACE_RECORD(TRACE_KEY,'a');
+	TEST_Ticks(3);
+	TRACE_FAULT(TRACE_STACK_OVERFLOW,3);
+	TEST_CHECK_EQ(TRACE_IsFrozen(),STD_TRUE);
+	TRACE_RECORD(TRACE_KEY,'b');    /*< dropped */
+	TRACE_RECORD_ISR(TRACE_DOOR_ISR,0);
+	TEST_Ticks(7);
+
+	printf("decoded, frozen:\n");
+	TEST_Decode();
+	TEST_Title(2,", frozen (fault)");
+	TEST_Row(0,"0","-","TRACE_KEY","'a'");
+	TEST_Row(1,"3","+3","TRACE_STACK_OVERFLOW","priority 3");
+
+	TEST_CHECK_EQ(TRACE_GetRecords(records,&count),STD_OK);
+	TEST_CHECK_EQ(count,2);
+	TRACE_Restart();
+	TEST_CHECK_EQ(TRACE_IsFrozen(),STD_FALSE);
+	TRACE_RECORD(TRACE_KEY,'c');
+	TEST_CHECK_EQ(TRACE_GetRecords(records,&count),STD_OK);
+	TEST_CHECK_EQ(count,1);
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+int main(void)
+{
+	HOST_Init();
+	TEST_Stamp();
+	TEST_DecodePending();
+	TEST_Wrap();
+	TEST_Freeze();
+	return TEST_RESULT();
+}
@@ -0,0 +1,224 @@
+/**
+ * @file test_turntable.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the tests of the turntable rotation monitor (Turntable_Interface.h) on the host port:
+ *         an encoder pulse train is fed to ICP1 (HOST_Timer1Capture()) with TIMER1 running as in main.c
+ *         (CTC, 1s cycle), TURNTABLE_IsStalled() is called every TEST_POLL_MS as task_safety() does.
+ *         - the measured RPM of steady trains and of a speed step
+ *         - the stall detection time after the last pulse (TURNTABLE_STALL_TIMEOUT_MS)
+ *         - the stall of a slow train (TURNTABLE_MIN_RPM_X10)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+// lib
+#include "Std_Types.h"
+#include "Utils_interrupt.h"
+
+// MCAL
+#include "MCU_config.h"
+#include "TIMERS_Interfacing.h"
+#include "TIMERS_Lcfg.h"
+#include "TIMERS_Calc.h"
+
+// HAL
+#include "Turntable_Interface.h"
+#include "Turntable_Lcfg.h"
+
+// host port
+#include "HOST_Interface.h"
+
+#include "test.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+/* TIMER1 as main.c: CTC, 1s cycle */
+#define TEST_TIMER1_PERIOD_US     1000000UL
+#define TEST_TIMER1_DIV           TIMER_CALC_DIV(F_CPU,TEST_TIMER1_PERIOD_US,16)
+#define TEST_TIMER1_PRESCALER     TIMER_CALC_PRE_CLK(TEST_TIMER1_DIV)
+#define TEST_TIMER1_TOP           ((u16)TIMER_CALC_TOP(F_CPU,TEST_TIMER1_PERIOD_US,16))
+
+#define TEST_POLL_MS              5           /*< TASK_SAFETY_PERIOD (main.c) */
+#define TEST_CYCLES_PER_MS        (F_CPU/1000UL)
+#define TEST_PULSE_CYCLES(rpmX10) ((u64)F_CPU*600UL/((u32)(rpmX10)*TURNTABLE_PULSES_PER_REV))
+#define TEST_RPM_TOLERANCE_X10    1           /*< 0.1 RPM */
+#define TEST_NO_STALL             0xFFFFFFFFUL
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static u64 TEST_u64NextPoll;
+static u32 TEST_u32StallMs;      /*< the time of the first stall seen by a poll (TEST_NO_STALL) */
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief The virtual time in ms.
+ */
+static u32 TEST_NowMs(void)
+{
+	return (u32)(HOST_GetCycles()/TEST_CYCLES_PER_MS);
+}
+
+/**
+ * @brief Advances the virtual time to (cycles), polling the stall check every TEST_POLL_MS on the way.
+ */
+static void TEST_AdvanceTo(u64 cycles)
+{
+	u64 now=HOST_GetCycles();
+	u64 next;
+
+	while (now<cycles)
+	{
+		next=(TEST_u64NextPoll<cycles)? TEST_u64NextPoll : cycles;
+		HOST_Advance((u32)(next-now));
+		now=HOST_GetCycles();
+		if (now>=TEST_u64NextPoll)
+		{
+			TEST_u64NextPoll+=(u64)TEST_POLL_MS*TEST_CYCLES_PER_MS;
+			if ((TEST_u32StallMs==TEST_NO_STALL) && (TURNTABLE_IsStalled((u16)TEST_NowMs())==STD_TRUE))
+			{
+				TEST_u32StallMs=TEST_NowMs();
+			}
+		}
+	}
+}
+
+/**
+ * @brief Feeds count encoder pulses at a speed (tenths of RPM).
+ */
+static void TEST_Pulses(u16 rpmX10, u8 count)
+{
+	u8 i;
+
+	for (i=0; i<count; i++)
+	{
+		TEST_AdvanceTo(HOST_GetCycles()+TEST_PULSE_CYCLES(rpmX10));
+		HOST_Timer1Capture();
+		TEST_AdvanceTo(HOST_GetCycles()+1); /*< the capture ISR runs at the next step */
+	}
+}
+
+/**
+ * @brief TIMER1 as main.c, the monitor started: the motor is switched ON now.
+ */
+static void TEST_Start(void)
+{
+	HOST_Init();
+	TIMER1_Init(TIMER1_CTC_OCRN_TOP,TIMER_OCx_MODE_DICONNECTED,TIMER_OCx_MODE_DICONNECTED,TEST_TIMER1_PRESCALER);
+	TIMER1_SetCompare_A_Value(TEST_TIMER1_TOP);
+	TIMER1_SetCounterValue(0);
+	TURNTABLE_Init();
+	Global_Interrupt_Enable__asm();
+	TEST_CHECK_EQ(TURNTABLE_IsStalled(0),STD_FALSE); /*< not started */
+	TURNTABLE_Start((u16)TEST_NowMs());
+	TEST_u64NextPoll=HOST_GetCycles()+(u64)TEST_POLL_MS*TEST_CYCLES_PER_MS;
+	TEST_u32StallMs=TEST_NO_STALL;
+}
+
+/**
+ * @brief Steady trains and a speed step: the filtered RPM settles on the speed of the train, no stall.
+ */
+static void TEST_Rpm(void)
+{
+	u16 rpmX10;
+
+	TEST_Start();
+	TEST_CHECK_EQ(TURNTABLE_GetRpmX10(),0);
+	TEST_Pulses(60,2);
+	TEST_CHECK(TURNTABLE_GetRpmX10()!=0); /*< the first period */
+
+	TEST_Pulses(60,TURNTABLE_PULSES_PER_REV);
+	rpmX10=TURNTABLE_GetRpmX10();
+	printf("6.0 RPM train: %u.%u RPM\n",rpmX10/10,rpmX10%10);
+	TEST_CHECK((rpmX10>=60-TEST_RPM_TOLERANCE_X10) && (rpmX10<=60+TEST_RPM_TOLERANCE_X10));
+
+	TEST_Pulses(100,2*TURNTABLE_PULSES_PER_REV); /*< a step: 90% after 8 pulses */
+	rpmX10=TURNTABLE_GetRpmX10();
+	printf("10.0 RPM step: %u.%u RPM\n",rpmX10/10,rpmX10%10);
+	TEST_CHECK((rpmX10>=100-TEST_RPM_TOLERANCE_X10) && (rpmX10<=100+TEST_RPM_TOLERANCE_X10));
+
+	TEST_Pulses(45,2*TURNTABLE_PULSES_PER_REV);  /*< 0.56s per pulse, above the minimum speed */
+	rpmX10=TURNTABLE_GetRpmX10();
+	printf("4.5 RPM train: %u.%u RPM\n",rpmX10/10,rpmX10%10);
+	TEST_CHECK((rpmX10>=45-TEST_RPM_TOLERANCE_X10) && (rpmX10<=45+TEST_RPM_TOLERANCE_X10));
+
+	TEST_CHECK_EQ(TEST_u32StallMs,TEST_NO_STALL);
+}
+
+/**
+ * @brief The pulses stop: the stall is seen after TURNTABLE_STALL_TIMEOUT_MS, at the latest two polls later.
+ */
+static void TEST_StallTimeout(void)
+{
+	u32 lastPulseMs;
+	u32 detectionMs;
+
+	TEST_Start();
+	TEST_Pulses(60,TURNTABLE_PULSES_PER_REV);
+	TEST_CHECK_EQ(TEST_u32StallMs,TEST_NO_STALL);
+	lastPulseMs=TEST_NowMs();
+
+	TEST_AdvanceTo(HOST_GetCycles()+(u64)2*TURNTABLE_STALL_TIMEOUT_MS*TEST_CYCLES_PER_MS);
+	TEST_CHECK(TEST_u32StallMs!=TEST_NO_STALL);
+	if (TEST_u32StallMs!=TEST_NO_STALL)
+	{
+		detectionMs=TEST_u32StallMs-lastPulseMs;
+		printf("stall (no pulse): detected %lums after the last pulse\n",(unsigned long)detectionMs);
+		TEST_CHECK(detectionMs>TURNTABLE_STALL_TIMEOUT_MS);
+		/* the pulse is timestamped by the next poll, the stall is seen by the poll after the timeout */
+		TEST_CHECK(detectionMs<=TURNTABLE_STALL_TIMEOUT_MS+(2*TEST_POLL_MS));
+	}
+	TURNTABLE_Stop();
+	TEST_CHECK_EQ(TURNTABLE_IsStalled((u16)TEST_NowMs()),STD_FALSE); /*< not monitored */
+}
+
+/**
+ * @brief The turntable slows down under TURNTABLE_MIN_RPM_X10 (the pulses go on within the timeout):
+ *        the stall is seen when the filtered speed crosses the minimum.
+ */
+static void TEST_StallSlow(void)
+{
+	u8 pulses=0;
+	u16 rpmX10;
+
+	TEST_Start();
+	TEST_Pulses(60,TURNTABLE_PULSES_PER_REV);
+	TEST_CHECK_EQ(TEST_u32StallMs,TEST_NO_STALL);
+	while ((TEST_u32StallMs==TEST_NO_STALL) && (pulses<TURNTABLE_PULSES_PER_REV))
+	{
+		TEST_Pulses(TURNTABLE_MIN_RPM_X10-1,1);   /*< 0.86s per pulse: below the timeout */
+		pulses++;
+	}
+	rpmX10=TURNTABLE_GetRpmX10();
+	printf("stall (%u.%u RPM train): detected after %u pulses at %u.%u RPM\n",(TURNTABLE_MIN_RPM_X10-1)/10,
+	       (TURNTABLE_MIN_RPM_X10-1)%10,pulses,rpmX10/10,rpmX10%10);
+	TEST_CHECK(TEST_u32StallMs!=TEST_NO_STALL);
+	TEST_CHECK(pulses<=12);                           /*< the filter crosses the minimum from 6.0 RPM */
+	TEST_CHECK(rpmX10<TURNTABLE_MIN_RPM_X10);
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+int main(void)
+{
+	TEST_Rpm();
+	TEST_StallTimeout();
+	TEST_StallSlow();
+	return TEST_RESULT();
+}
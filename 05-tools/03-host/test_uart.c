@@ -0,0 +1,235 @@
+/**
+ * @file test_uart.c
+ * @author Abdelrahman Ahmed Moussa (abdelrahman.ahmed0599@gmail.com  , https://www.linkedin.com/in/-abdelrahman-ahmed)
+ * @brief  This file contains the tests of the USART driver (UART_Interface.h) on the host port:
+ *         - the TX idle state after UART_Init(), while sending and after the last byte
+ *         - a loopback: the bytes sent by the UDRE ISR are received back by the RXC ISR
+ *         - the zero-copy regions of both sides
+ *         - the lost RX bytes: the RX buffer overflow, the data overrun, the framing and parity errors
+ *
+ *         The host port has no USART model: the test is the line. It raises UDRE while UDRIE is set and takes the byte
+ *         the ISR wrote in UDR, sets TXC when the transmitter is empty (the write of 1 that clears it is not modeled),
+ *         puts the received bytes in UDR with their status in UCSRA and raises RXC.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+
+// lib
+#include "Std_Types.h"
+#include "Utils_BitMath.h"
+#include "Utils_interrupt.h"
+
+// MCAL
+#include "UART_Lcfg.h"
+#include "UART_Interface.h"
+
+// host port
+#include "HOST_Interface.h"
+
+#include "test.h"
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                                  MACROS                                      */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+#define TEST_UDR_ADDRESS          0x2C        /*< MemMap.h */
+#define TEST_UCSRA_ADDRESS        0x2B
+#define TEST_UCSRB_ADDRESS        0x2A
+#define TEST_UCSRA_PE             2
+#define TEST_UCSRA_DOR            3
+#define TEST_UCSRA_FE             4
+#define TEST_UCSRA_TXC            6
+#define TEST_UCSRB_UDRIE          5
+
+#define TEST_LINE_SIZE            (UART_TX_SIZE+UART_RX_SIZE)
+#define TEST_STEP_CYCLES          1           /*< the pending ISR runs in the step */
+
+/*------------------------------------------------------------------------------*/
+/*                                                                              */
+/*                         Static Global Vaiables                               */
+/*                                                                              */
+/*------------------------------------------------------------------------------*/
+static u8 TEST_arrLine[TEST_LINE_SIZE];       /*< the bytes sent on TXD */
+static u8 TEST_u8LineCount;
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PRIVATE Functions                              */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+
+/**
+ * @brief The transmitter: sends the bytes of the TX buffer until the UDRE ISR disables itself, then the last stop bit
+ *        is out (TXC).
+ */
+static void TEST_Transmit(void)
+{
+	while (get_bit(HOST_PeekIo(TEST_UCSRB_ADDRESS),TEST_UCSRB_UDRIE)==1)
+	{
+		*HOST_Io8(TEST_UDR_ADDRESS)=0;
+		clear_bit(*HOST_Io8(TEST_UCSRA_ADDRESS),TEST_UCSRA_TXC);
+		HOST_RaiseInterrupt(HOST_USART_UDRE);
+		HOST_Advance(TEST_STEP_CYCLES);
+		if ((get_bit(HOST_PeekIo(TEST_UCSRA_ADDRESS),TEST_UCSRA_TXC)==1) && (TEST_u8LineCount<TEST_LINE_SIZE))
+		{
+			TEST_arrLine[TEST_u8LineCount]=HOST_PeekIo(TEST_UDR_ADDRESS); /*< the ISR wrote a byte (TXC written) */
+			TEST_u8LineCount++;
+			TEST_CHECK_EQ(UART_IsTxIdle(),STD_FALSE); /*< the byte is on the line */
+		}
+	}
+	set_bit(*HOST_Io8(TEST_UCSRA_ADDRESS),TEST_UCSRA_TXC);
+}
+
+/**
+ * @brief The receiver: a byte and its status flags (FE, DOR, PE) arrive on RXD.
+ */
+static void TEST_Receive(u8 data, u8 status)
+{
+	*HOST_Io8(TEST_UDR_ADDRESS)=data;
+	*HOST_Io8(TEST_UCSRA_ADDRESS)=status;
+	HOST_RaiseInterrupt(HOST_USART_RXC);
+	HOST_Advance(TEST_STEP_CYCLES);
+	*HOST_Io8(TEST_UCSRA_ADDRESS)=0;
+}
+
+/**
+ * @brief A started driver, the line is empty.
+ */
+static void TEST_Start(void)
+{
+	HOST_Init();
+	UART_Init();
+	Global_Interrupt_Enable__asm();
+	TEST_u8LineCount=0;
+}
+
+/**
+ * @brief TX idle: TRUE after UART_Init() (TXC is 0 until a byte is sent), FALSE until the last byte is out.
+ */
+static void TEST_TxIdle(void)
+{
+	TEST_Start();
+	TEST_CHECK_EQ(get_bit(HOST_PeekIo(TEST_UCSRA_ADDRESS),TEST_UCSRA_TXC),0);
+	TEST_CHECK_EQ(UART_IsTxIdle(),STD_TRUE);
+
+	TEST_CHECK_EQ(UART_Write((const u8*)"OK",2),STD_OK);
+	TEST_CHECK_EQ(UART_IsTxIdle(),STD_FALSE);  /*< in the TX buffer */
+	TEST_Transmit();
+	TEST_CHECK_EQ(TEST_u8LineCount,2);
+	TEST_CHECK_EQ(UART_IsTxIdle(),STD_TRUE);
+
+	UART_Init();                               /*< UCSRA written: TXC reads 0 on the host */
+	TEST_CHECK_EQ(UART_IsTxIdle(),STD_TRUE);
+	TEST_CHECK_EQ(UART_Write(NULL_PTR,1),STD_NULL_POINTER);
+	TEST_CHECK_EQ(UART_IsTxIdle(),STD_TRUE);
+}
+
+/**
+ * @brief Loopback: the bytes written (UART_Write() and a frame built in place) are sent in order, received back and
+ *        read (UART_Read() and in place).
+ */
+static void TEST_Loopback(void)
+{
+	static const u8 text[]="Microwave\r\n";
+	u8 *frame;
+	const u8 *rx;
+	u8 received[TEST_LINE_SIZE];
+	u8 receivedCount=0;
+	u8 len;
+	u8 i;
+
+	TEST_Start();
+	TEST_CHECK_EQ(UART_Write(text,sizeof(text)-1),STD_OK);
+	TEST_CHECK(UART_TxGetRegion(&frame)>=3);
+	frame[0]=0x7E;
+	frame[1]=0x00;
+	frame[2]=0xFF;
+	TEST_CHECK_EQ(UART_TxCommit(3),STD_OK);
+	TEST_CHECK_EQ(UART_TxCommit(UART_TX_SIZE+1),STD_INVALID_ARG);
+	TEST_Transmit();
+	TEST_CHECK_EQ(TEST_u8LineCount,sizeof(text)-1+3);
+	TEST_CHECK_EQ(memcmp(TEST_arrLine,text,sizeof(text)-1),0);
+	TEST_CHECK_EQ(TEST_arrLine[sizeof(text)-1],0x7E);
+	TEST_CHECK_EQ(TEST_arrLine[sizeof(text)+1],0xFF);
+	TEST_CHECK_EQ(UART_IsTxIdle(),STD_TRUE);
+
+	for (i=0; i<TEST_u8LineCount; i++)
+	{
+		TEST_Receive(TEST_arrLine[i],0);
+	}
+	for (i=0; i<5; i++)
+	{
+		TEST_CHECK_EQ(UART_Read(&received[receivedCount]),STD_OK);
+		receivedCount++;
+	}
+	while ((len=UART_RxGetRegion(&rx))>0)      /*< in place, the region wraps once at most */
+	{
+		memcpy(&received[receivedCount],rx,len);
+		receivedCount+=len;
+		TEST_CHECK_EQ(UART_RxRelease(len),STD_OK);
+	}
+	TEST_CHECK_EQ(receivedCount,TEST_u8LineCount);
+	TEST_CHECK_EQ(memcmp(received,TEST_arrLine,TEST_u8LineCount),0);
+	TEST_CHECK_EQ(UART_Read(&received[0]),STD_BUFFER_EMPTY);
+	TEST_CHECK_EQ(UART_RxRelease(1),STD_INVALID_ARG);
+}
+
+/**
+ * @brief The lost RX bytes: a full RX buffer drops the next bytes, a byte with a framing or parity error is dropped,
+ *        a data overrun is counted and its byte kept. UART_Init() clears the counters.
+ */
+static void TEST_RxErrors(void)
+{
+	UART_Stats_t stats;
+	u8 data;
+	u8 i;
+
+	TEST_Start();
+	for (i=0; i<UART_RX_SIZE+3; i++)           /*< nobody reads */
+	{
+		TEST_Receive(i,0);
+	}
+	TEST_CHECK_EQ(UART_GetStats(&stats),STD_OK);
+	TEST_CHECK_EQ(stats.rxOverflows,3);
+	TEST_CHECK_EQ(stats.rxOverruns,0);
+	for (i=0; i<UART_RX_SIZE; i++)
+	{
+		TEST_CHECK_EQ(UART_Read(&data),STD_OK);
+		TEST_CHECK_EQ(data,i);                 /*< the oldest bytes are kept */
+	}
+
+	TEST_Receive('F',(1<<TEST_UCSRA_FE));
+	TEST_Receive('P',(1<<TEST_UCSRA_PE));
+	TEST_Receive('D',(1<<TEST_UCSRA_DOR));
+	TEST_CHECK_EQ(UART_GetStats(&stats),STD_OK);
+	TEST_CHECK_EQ(stats.framingErrors,1);
+	TEST_CHECK_EQ(stats.parityErrors,1);
+	TEST_CHECK_EQ(stats.rxOverruns,1);
+	TEST_CHECK_EQ(UART_Read(&data),STD_OK);
+	TEST_CHECK_EQ(data,'D');
+	TEST_CHECK_EQ(UART_Read(&data),STD_BUFFER_EMPTY);
+
+	UART_Init();
+	TEST_CHECK_EQ(UART_GetStats(&stats),STD_OK);
+	TEST_CHECK_EQ(stats.rxOverflows+stats.rxOverruns+stats.framingErrors+stats.parityErrors,0);
+	TEST_CHECK_EQ(UART_GetStats(NULL_PTR),STD_NULL_POINTER);
+}
+
+/*-----------------------------------------------------------------------------*/
+/*                                                                             */
+/*                              PUPLIC Functions                               */
+/*                                                                             */
+/*-----------------------------------------------------------------------------*/
+int main(void)
+{
+	TEST_TxIdle();
+	TEST_Loopback();
+	TEST_RxErrors();
+	return TEST_RESULT();
+}